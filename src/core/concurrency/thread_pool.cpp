@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2025 ConfigGUI Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ * thread_pool.cpp
+ * Fixed-size worker pool implementation
+ */
+
+#include "thread_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+namespace configgui::core::concurrency {
+
+std::size_t ThreadPool::resolve_thread_count(std::size_t requested) noexcept
+{
+    if (requested == 0) {
+        requested = std::thread::hardware_concurrency();
+    }
+    return std::max<std::size_t>(requested, 1);
+}
+
+ThreadPool::ThreadPool(std::size_t thread_count)
+{
+    const std::size_t count = resolve_thread_count(thread_count);
+    _workers.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        _workers.emplace_back([this]() { worker_loop(); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _cv.notify_all();
+    for (auto& worker : _workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void ThreadPool::enqueue(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tasks.push_back(std::move(task));
+    }
+    _cv.notify_one();
+}
+
+void ThreadPool::worker_loop()
+{
+    for (;;) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [this]() { return _stopping || !_tasks.empty(); });
+            if (_tasks.empty()) {
+                return; // stopping and fully drained
+            }
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void ThreadPool::parallel_for(std::size_t count, const std::function<void(std::size_t)>& body)
+{
+    if (count == 0) {
+        return;
+    }
+
+    // Shared between the caller and helpers; helpers that start after all
+    // indices are claimed exit without touching body.
+    struct State {
+        std::atomic<std::size_t> next{0};
+        std::size_t completed = 0;
+        std::exception_ptr first_error;
+        std::mutex mutex;
+        std::condition_variable done;
+    };
+    auto state = std::make_shared<State>();
+
+    auto drain = [state, count, &body]() {
+        for (std::size_t i = state->next.fetch_add(1); i < count; i = state->next.fetch_add(1)) {
+            std::exception_ptr error;
+            try {
+                body(i);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (error && !state->first_error) {
+                state->first_error = error;
+            }
+            if (++state->completed == count) {
+                state->done.notify_all();
+            }
+        }
+    };
+
+    // One helper per worker (bounded by the item count); the caller drains too
+    const std::size_t helpers = std::min(_workers.size(), count - 1);
+    for (std::size_t i = 0; i < helpers; ++i) {
+        enqueue(drain);
+    }
+
+    drain();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(lock, [&state, count]() { return state->completed == count; });
+    if (state->first_error) {
+        std::rethrow_exception(state->first_error);
+    }
+}
+
+} // namespace configgui::core::concurrency
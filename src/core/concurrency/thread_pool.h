@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2025 ConfigGUI Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ * thread_pool.h
+ * Fixed-size worker pool shared by core batch operations
+ */
+
+#ifndef CONFIGGUI_CORE_CONCURRENCY_THREAD_POOL_H
+#define CONFIGGUI_CORE_CONCURRENCY_THREAD_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace configgui::core::concurrency {
+
+/**
+ * @class ThreadPool
+ * Fixed-size pool of worker threads executing queued tasks
+ *
+ * Used by the batch I/O and validation APIs to bound parallelism:
+ * - submit() queues a callable and returns a std::future for its result
+ * - parallel_for() fans an index range out over the workers and blocks
+ *   until every index has been processed
+ *
+ * Exceptions raised inside submit() tasks are captured in the returned
+ * future; parallel_for() rethrows the first one on the calling thread.
+ */
+class ThreadPool {
+public:
+    /**
+     * Create a pool
+     * @param thread_count Number of workers (0 = std::thread::hardware_concurrency())
+     */
+    explicit ThreadPool(std::size_t thread_count = 0);
+
+    /// Drains queued tasks and joins all workers
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    /**
+     * Queue a callable for execution on a worker
+     * @param task Callable taking no arguments
+     * @return Future holding the callable's result
+     */
+    template <typename Fn>
+    auto submit(Fn&& task) -> std::future<std::invoke_result_t<std::decay_t<Fn>>>
+    {
+        using ReturnType = std::invoke_result_t<std::decay_t<Fn>>;
+        auto packaged = std::make_shared<std::packaged_task<ReturnType()>>(std::forward<Fn>(task));
+        std::future<ReturnType> future = packaged->get_future();
+        enqueue([packaged]() { (*packaged)(); });
+        return future;
+    }
+
+    /**
+     * Invoke body(i) for every i in [0, count) across the pool
+     *
+     * The calling thread participates and only waits for indices that are
+     * already claimed, so this is safe to call from a task running on the
+     * same pool. Indices are handed out dynamically, which keeps workers
+     * busy when per-item cost varies. The first exception thrown by body is
+     * rethrown on the calling thread once every index has finished.
+     *
+     * @param count Number of indices
+     * @param body Callable invoked once per index
+     */
+    void parallel_for(std::size_t count, const std::function<void(std::size_t)>& body);
+
+    /// Number of worker threads
+    std::size_t size() const noexcept { return _workers.size(); }
+
+    /// Resolve a requested worker count (0 = hardware concurrency, never less than 1)
+    static std::size_t resolve_thread_count(std::size_t requested) noexcept;
+
+private:
+    void enqueue(std::function<void()> task);
+    void worker_loop();
+
+    std::vector<std::thread> _workers;
+    std::deque<std::function<void()>> _tasks;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _stopping = false;
+};
+
+} // namespace configgui::core::concurrency
+
+#endif // CONFIGGUI_CORE_CONCURRENCY_THREAD_POOL_H
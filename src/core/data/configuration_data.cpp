@@ -60,11 +60,30 @@ void ConfigurationData::set_focused(const std::string& field_name, bool focused)
 void ConfigurationData::add_error(const std::string& field_name, const ValidationError& error)
 {
     field_states_[field_name].errors.push_back(error);
+    ++error_count_;
 }
 
 void ConfigurationData::clear_errors(const std::string& field_name)
 {
-    field_states_[field_name].errors.clear();
+    auto& errors = field_states_[field_name].errors;
+    error_count_ -= errors.size();
+    errors.clear();
+}
+
+void ConfigurationData::set_errors(const std::string& field_name, ValidationErrors errors)
+{
+    auto& current = field_states_[field_name].errors;
+    error_count_ = error_count_ - current.size() + errors.size();
+    current = std::move(errors);
+}
+
+void ConfigurationData::clear_all_errors()
+{
+    for (auto& [field, state] : field_states_)
+    {
+        state.errors.clear();
+    }
+    error_count_ = 0;
 }
 
 const std::vector<ValidationError>& ConfigurationData::get_errors(const std::string& field_name) const
@@ -89,14 +108,7 @@ ValidationErrors ConfigurationData::all_errors() const
 
 bool ConfigurationData::has_errors() const
 {
-    for (const auto& [field, state] : field_states_)
-    {
-        if (!state.errors.empty())
-        {
-            return true;
-        }
-    }
-    return false;
+    return error_count_ != 0;
 }
 
 bool ConfigurationData::has_errors(const std::string& field_name) const
@@ -121,9 +133,23 @@ bool ConfigurationData::is_dirty() const
     return false;
 }
 
+std::vector<std::string> ConfigurationData::dirty_fields() const
+{
+    std::vector<std::string> dirty;
+    for (const auto& [field, state] : field_states_)
+    {
+        if (state.is_dirty)
+        {
+            dirty.push_back(field);
+        }
+    }
+    return dirty;
+}
+
 void ConfigurationData::reset()
 {
     field_states_.clear();
+    error_count_ = 0;
 }
 
 std::string ConfigurationData::to_json_string() const
@@ -7,6 +7,7 @@
 #include <nlohmann/json.hpp>
 #include <map>
 #include <string>
+#include <vector>
 
 using json = nlohmann::ordered_json;
 
@@ -62,13 +63,19 @@ public:
     /// @brief Clear errors for field
     void clear_errors(const std::string& field_name);
 
+    /// @brief Replace all errors for field
+    void set_errors(const std::string& field_name, ValidationErrors errors);
+
+    /// @brief Clear errors for every field
+    void clear_all_errors();
+
     /// @brief Get all errors for field
     [[nodiscard]] const std::vector<ValidationError>& get_errors(const std::string& field_name) const;
 
     /// @brief Get all validation errors
     [[nodiscard]] ValidationErrors all_errors() const;
 
-    /// @brief Check if any field has errors
+    /// @brief Check if any field has errors (O(1): a running count is kept)
     [[nodiscard]] bool has_errors() const;
 
     /// @brief Check if specific field has errors
@@ -77,6 +84,9 @@ public:
     /// @brief Check if form is dirty (any field edited)
     [[nodiscard]] bool is_dirty() const;
 
+    /// @brief Get names of all edited fields
+    [[nodiscard]] std::vector<std::string> dirty_fields() const;
+
     /// @brief Reset form to clean state
     void reset();
 
@@ -86,6 +96,7 @@ public:
 private:
     json data_;
     std::map<std::string, FieldState> field_states_;
+    std::size_t error_count_ = 0;  ///< Total errors across field_states_
     static const std::vector<ValidationError> empty_errors_;
 };
 
@@ -7,12 +7,106 @@
  */
 
 #include "configuration_reader.h"
+#include "../concurrency/thread_pool.h"
+#include "../serializers/serializer_factory.h"
+#include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <filesystem>
+#include <mutex>
 #include <sstream>
 
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace configgui::core::io {
 
+namespace {
+
+/// Files hinted ahead of the current read position, per worker
+constexpr std::size_t kPrefetchPerWorker = 4;
+
+#if defined(__linux__)
+
+/// Ask the kernel to start reading a file into the page cache
+void prefetch_file(const std::string& file_path) noexcept
+{
+    const int fd = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC | O_NONBLOCK);
+    if (fd < 0) {
+        return;  // The real read reports the error
+    }
+    (void)::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    ::close(fd);
+}
+
+/// Read a whole regular file with one fstat and as few read() calls as possible
+Result<std::string> read_whole_file(const std::string& file_path)
+{
+    // O_NONBLOCK so opening a FIFO (or a device) cannot park the worker; it is
+    // cleared again once fstat has confirmed a regular file
+    const int fd = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC | O_NONBLOCK);
+    if (fd < 0) {
+        const int err = errno;
+        return Result<std::string>(
+            SerializationError::FILE_IO_ERROR,
+            (err == ENOENT ? "File does not exist: " : "File is not readable: ") + file_path);
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        ::close(fd);
+        return Result<std::string>(
+            SerializationError::FILE_IO_ERROR,
+            "Path is not a regular file: " + file_path);
+    }
+    const int flags = ::fcntl(fd, F_GETFL);
+    if (flags < 0 || ::fcntl(fd, F_SETFL, flags & ~O_NONBLOCK) != 0) {
+        const int err = errno;
+        ::close(fd);
+        return Result<std::string>(
+            SerializationError::FILE_IO_ERROR,
+            "Failed to read file: " + file_path + ": " + std::strerror(err));
+    }
+    (void)::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    std::string content(static_cast<std::size_t>(st.st_size), '\0');
+    std::size_t total = 0;
+    for (;;) {
+        if (total == content.size()) {
+            // The file may have grown since fstat; keep reading until EOF
+            content.resize(content.size() + 4096);
+        }
+        const ssize_t n = ::read(fd, content.data() + total, content.size() - total);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            const int err = errno;
+            ::close(fd);
+            return Result<std::string>(
+                SerializationError::FILE_IO_ERROR,
+                "Failed to read file: " + file_path + ": " + std::strerror(err));
+        }
+        if (n == 0) {
+            break;
+        }
+        total += static_cast<std::size_t>(n);
+    }
+    ::close(fd);
+
+    content.resize(total);
+    return Result<std::string>(std::move(content));
+}
+
+#endif // __linux__
+
+} // namespace
+
 Result<void> ConfigurationReader::validate_file_path(const std::string& file_path) const noexcept
 {
     try {
@@ -114,4 +208,98 @@ Result<json> ConfigurationReader::read_configuration_file(
     }
 }
 
+std::size_t ConfigurationReader::read_configuration_batch(
+    const std::vector<BatchReadItem>& items,
+    const BatchReadCallback& on_result,
+    std::size_t worker_count) noexcept
+{
+    std::size_t delivered = 0;
+    if (items.empty() || !on_result) {
+        return delivered;
+    }
+
+    try {
+        const std::size_t workers = std::min(
+            concurrency::ThreadPool::resolve_thread_count(worker_count), items.size());
+        const std::size_t lookahead = workers * kPrefetchPerWorker;
+        std::mutex deliver_mutex;
+
+#if defined(__linux__)
+        // Prime the window; each worker then keeps it `lookahead` files ahead of itself
+        for (std::size_t i = 0; i < std::min(lookahead, items.size()); ++i) {
+            prefetch_file(items[i].file_path);
+        }
+#endif
+
+        // A throw (bad_alloc on a huge file, a parser exception) fails only its own item
+        auto load = [&](const BatchReadItem& item) -> Result<json> {
+            try {
+                std::shared_ptr<FormatSerializer> serializer = item.serializer;
+                if (!serializer) {
+                    auto detected = SerializerFactory::create_serializer_from_path(item.file_path);
+                    if (!detected) {
+                        return Result<json>(detected.error_code(), detected.error_msg_or_default());
+                    }
+                    serializer = std::move(detected.value());
+                }
+#if defined(__linux__)
+                auto content = read_whole_file(item.file_path);
+                if (!content) {
+                    return Result<json>(content.error_code(), content.error_msg());
+                }
+                auto parsed = serializer->deserialize(content.value());
+                if (!parsed) {
+                    return Result<json>(parsed.error_code(), parsed.error_msg_or_default());
+                }
+                return parsed;
+#else
+                return read_configuration_file(item.file_path, serializer);
+#endif
+            } catch (const std::exception& e) {
+                return Result<json>(
+                    SerializationError::UNKNOWN_ERROR,
+                    std::string("Failed to read configuration file: ") + e.what());
+            } catch (...) {
+                return Result<json>(
+                    SerializationError::UNKNOWN_ERROR,
+                    "Failed to read configuration file: " + item.file_path);
+            }
+        };
+
+        concurrency::ThreadPool pool(workers);
+        pool.parallel_for(items.size(), [&](std::size_t i) {
+#if defined(__linux__)
+            if (i + lookahead < items.size()) {
+                prefetch_file(items[i + lookahead].file_path);
+            }
+#endif
+            const auto& item = items[i];
+            BatchReadResult entry{i, item.file_path, load(item)};
+
+            std::lock_guard<std::mutex> lock(deliver_mutex);
+            on_result(std::move(entry));
+            ++delivered;
+        });
+    } catch (...) {
+        // Only allocation failures or a throwing callback land here; report what was delivered
+    }
+    return delivered;
+}
+
+std::vector<BatchReadResult> ConfigurationReader::read_configuration_batch(
+    const std::vector<BatchReadItem>& items,
+    std::size_t worker_count) noexcept
+{
+    std::vector<BatchReadResult> results;
+    try {
+        results.reserve(items.size());
+        read_configuration_batch(items, [&results](BatchReadResult&& entry) {
+            results.push_back(std::move(entry));
+        }, worker_count);
+    } catch (...) {
+        // Allocation failure reserving the result vector: return what we have
+    }
+    return results;
+}
+
 } // namespace configgui::core::io
@@ -12,8 +12,11 @@
 
 #include "../models/serialization_result.h"
 #include "../serializers/format_serializer.h"
+#include <cstddef>
+#include <functional>
 #include <string>
 #include <memory>
+#include <vector>
 #include <nlohmann/json.hpp>
 
 using json = nlohmann::json;
@@ -23,6 +26,36 @@ namespace configgui::core::io {
 using namespace models;
 using namespace serializers;
 
+/**
+ * @struct BatchReadItem
+ * One configuration to load as part of a batch read
+ */
+struct BatchReadItem {
+    /// Source file path
+    std::string file_path;
+
+    /// Serializer used for deserialization (null = detect from file extension)
+    std::shared_ptr<FormatSerializer> serializer;
+};
+
+/**
+ * @struct BatchReadResult
+ * Outcome of loading one BatchReadItem
+ */
+struct BatchReadResult {
+    /// Position of the corresponding item in the input vector
+    std::size_t index;
+
+    /// Source file path of the corresponding item
+    std::string file_path;
+
+    /// Deserialized configuration, or the error that prevented loading it
+    Result<json> result;
+};
+
+/// Receives batch read results as they complete
+using BatchReadCallback = std::function<void(BatchReadResult&&)>;
+
 /**
  * @class ConfigurationReader
  * Handles file reading operations for configuration files
@@ -80,6 +113,46 @@ public:
      */
     Result<std::string> read_file_content(const std::string& file_path) noexcept;
 
+    /**
+     * Read and deserialize many configuration files in parallel
+     *
+     * @param items Files to load; serializers may be shared between items
+     * @param on_result Invoked once per item, in completion order
+     * @param worker_count Number of worker threads (0 = hardware concurrency)
+     * @return Number of results delivered to on_result
+     *
+     * @note Reading and parsing overlap across files on a bounded worker pool;
+     *       upcoming files are hinted to the kernel with posix_fadvise(WILLNEED)
+     *       so their pages are already cached when a worker reaches them
+     * @note on_result is called from worker threads, one call at a time, and
+     *       must not throw; it may run while other files are still loading
+     * @note A failure affects only its own item; other files are still read
+     *
+     * Example:
+     *   std::vector<BatchReadItem> items;
+     *   for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+     *       items.push_back({entry.path().string(), nullptr});
+     *   }
+     *   reader.read_configuration_batch(items, [&](BatchReadResult&& entry) {
+     *       if (entry.result) { import(entry.file_path, entry.result.value()); }
+     *   });
+     */
+    std::size_t read_configuration_batch(
+        const std::vector<BatchReadItem>& items,
+        const BatchReadCallback& on_result,
+        std::size_t worker_count = 0) noexcept;
+
+    /**
+     * Read and deserialize many configuration files in parallel
+     *
+     * @param items Files to load
+     * @param worker_count Number of worker threads (0 = hardware concurrency)
+     * @return One BatchReadResult per item, in completion order
+     */
+    std::vector<BatchReadResult> read_configuration_batch(
+        const std::vector<BatchReadItem>& items,
+        std::size_t worker_count = 0) noexcept;
+
 private:
     /**
      * Internal helper to validate file path
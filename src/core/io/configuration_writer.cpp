@@ -7,87 +7,170 @@
  */
 
 #include "configuration_writer.h"
+#include "content_hash.h"
+#include "durable_file.h"
+#include "../concurrency/thread_pool.h"
+#include <atomic>
+#include <map>
 #include <fstream>
 #include <filesystem>
+#include <cerrno>
 #include <cstring>
-#include <ctime>
-#include <random>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 namespace configgui::core::io {
 
-std::string ConfigurationWriter::generate_temp_path(const std::string& file_path) const noexcept
+namespace {
+
+#if defined(__linux__)
+
+Result<void> errno_error(const std::string& what, int err)
 {
-    try {
-        std::filesystem::path target_path(file_path);
-        std::filesystem::path dir = target_path.parent_path();
+    return Result<void>::error(
+        SerializationError::FILE_IO_ERROR,
+        what + ": " + std::strerror(err));
+}
 
-        // Create temp filename with timestamp and random suffix
-        auto now = std::time(nullptr);
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_int_distribution<> dis(1000, 9999);
+/// Temp files a batch keeps open between writing and syncing them; past this,
+/// items are synced as soon as they are written so a large batch cannot run
+/// the process out of descriptors
+constexpr std::size_t kMaxHeldTempFds = 256;
 
-        std::string temp_name = ".tmp_config_" + std::to_string(now) + "_" + std::to_string(dis(gen));
-        return (dir / temp_name).string();
-    } catch (const std::exception&) {
-        // Fallback temp path
-        return file_path + ".tmp";
+/// Sync a batch temp file's data, removing the temp file on failure
+Result<void> sync_temp(int fd, const std::string& temp_path)
+{
+    if (::fdatasync(fd) != 0) {
+        const int err = errno;
+        ::unlink(temp_path.c_str());
+        return errno_error("Failed to sync temporary file " + temp_path, err);
     }
+    return Result<void>::success();
 }
 
-Result<void> ConfigurationWriter::atomic_write(
+/**
+ * Create and fill a named temp file (batch phase 1)
+ *
+ * With hold set the file is left unsynced and its descriptor handed to
+ * held_fd for phase 2; otherwise it is synced and closed right away.
+ */
+Result<void> write_batch_temp(const std::string& temp_path, const std::string& content,
+                              bool hold, std::unique_ptr<ScopedFd>& held_fd)
+{
+    auto fd = std::make_unique<ScopedFd>(::open(temp_path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644));
+    if (!fd->valid()) {
+        return errno_error("Failed to open temporary file " + temp_path, errno);
+    }
+    if (!write_all(fd->get(), content)) {
+        const int err = errno;
+        ::unlink(temp_path.c_str());
+        return errno_error("Failed to write to temporary file " + temp_path, err);
+    }
+    if (!hold) {
+        return sync_temp(fd->get(), temp_path);
+    }
+    held_fd = std::move(fd);
+    return Result<void>::success();
+}
+
+#endif // __linux__
+
+} // namespace
+
+bool ConfigurationWriter::is_content_unchanged(
     const std::string& file_path,
-    const std::string& content) noexcept
+    const std::string& content) const noexcept
 {
     try {
-        std::string temp_path = generate_temp_path(file_path);
+        std::error_code ec;
+        const auto size = std::filesystem::file_size(file_path, ec);
+        if (ec || size != content.size()) {
+            return false;
+        }
+        const auto mtime = std::filesystem::last_write_time(file_path, ec);
+        if (ec) {
+            return false;
+        }
 
-        // Write to temporary file
         {
-            std::ofstream temp_file(temp_path, std::ios::binary | std::ios::trunc);
-            if (!temp_file.is_open()) {
-                return Result<void>::error(
-                    SerializationError::FILE_IO_ERROR,
-                    "Failed to open temporary file: " + temp_path);
+            std::lock_guard<std::mutex> lock(_cache_mutex);
+            const auto it = _hash_cache.find(file_path);
+            if (it != _hash_cache.end() && it->second.size == size && it->second.mtime == mtime &&
+                it->second.recorded - mtime >= kMtimeGranularity) {
+                return it->second.hash == content_hash(content);
             }
+        }
 
-            temp_file.write(content.c_str(), static_cast<std::streamsize>(content.size()));
-            if (!temp_file.good()) {
-                // Try to clean up temp file
-                std::filesystem::remove(temp_path);
-                return Result<void>::error(
-                    SerializationError::FILE_IO_ERROR,
-                    "Failed to write to temporary file: " + temp_path);
-            }
-        } // File closed here
-
-        // Atomically rename temp file to target path
-        try {
-            std::filesystem::rename(temp_path, file_path);
-        } catch (const std::filesystem::filesystem_error& e) {
-            // Clean up temp file if rename fails
-            std::filesystem::remove(temp_path);
-            return Result<void>::error(
-                SerializationError::FILE_IO_ERROR,
-                std::string("Failed to rename temporary file: ") + e.what());
+        // No usable cache entry, or a racy one: compare against the bytes on disk
+        std::ifstream existing(file_path, std::ios::binary);
+        if (!existing.is_open()) {
+            return false;
+        }
+        std::string on_disk(content.size(), '\0');
+        existing.read(on_disk.data(), static_cast<std::streamsize>(on_disk.size()));
+        if (existing.gcount() != static_cast<std::streamsize>(on_disk.size()) || on_disk != content) {
+            return false;
         }
 
-        return Result<void>::success();
-    } catch (const std::exception& e) {
-        return Result<void>::error(
-            SerializationError::FILE_IO_ERROR,
-            std::string("Atomic write failed: ") + e.what());
+        // Verified now: an entry re-read clear of the mtime tick is trusted from here on,
+        // so a file saved by this writer is read back once rather than on every check
+        std::lock_guard<std::mutex> lock(_cache_mutex);
+        if (_hash_cache.size() >= kMaxCachedFiles) {
+            _hash_cache.clear();
+        }
+        _hash_cache[file_path] = CachedFileState{
+            content_hash(content), size, mtime, std::filesystem::file_time_type::clock::now()};
+        return true;
+    } catch (const std::exception&) {
+        return false;
     }
 }
 
-Result<void> ConfigurationWriter::write_configuration_file(
+void ConfigurationWriter::remember_content(
+    const std::string& file_path,
+    std::uint64_t hash,
+    std::size_t size) const noexcept
+{
+    try {
+        std::error_code ec;
+        const auto mtime = std::filesystem::last_write_time(file_path, ec);
+        std::lock_guard<std::mutex> lock(_cache_mutex);
+        if (ec) {
+            _hash_cache.erase(file_path);
+            return;
+        }
+        if (_hash_cache.size() >= kMaxCachedFiles) {
+            _hash_cache.clear();
+        }
+        _hash_cache[file_path] = CachedFileState{
+            hash, static_cast<std::uintmax_t>(size), mtime, std::filesystem::file_time_type::clock::now()};
+    } catch (const std::exception&) {
+        // Cache is an optimization only; a missing entry just forces a re-read
+    }
+}
+
+Result<void> ConfigurationWriter::atomic_write(
+    const std::string& file_path,
+    const std::string& content) noexcept
+{
+    const std::string error = durable_replace_file(file_path, content);
+    if (!error.empty()) {
+        return Result<void>::error(SerializationError::FILE_IO_ERROR, error);
+    }
+    return Result<void>::success();
+}
+
+Result<std::string> ConfigurationWriter::serialize_for_file(
     const std::string& file_path,
     const json& data,
-    const std::shared_ptr<FormatSerializer>& serializer) noexcept
+    const std::shared_ptr<FormatSerializer>& serializer) const noexcept
 {
     try {
         if (!serializer) {
-            return Result<void>::error(
+            return Result<std::string>(
                 SerializationError::UNKNOWN_ERROR,
                 "Serializer pointer is null");
         }
@@ -104,6 +187,26 @@ Result<void> ConfigurationWriter::write_configuration_file(
 
         // Serialize data to format-specific content
         auto serialize_result = serializer->serialize(context);
+        if (!serialize_result) {
+            return Result<std::string>(
+                serialize_result.error_code(),
+                serialize_result.error_msg_or_default());
+        }
+        return serialize_result;
+    } catch (const std::exception& e) {
+        return Result<std::string>(
+            SerializationError::UNKNOWN_ERROR,
+            std::string("Failed to serialize configuration: ") + e.what());
+    }
+}
+
+Result<void> ConfigurationWriter::write_configuration_file(
+    const std::string& file_path,
+    const json& data,
+    const std::shared_ptr<FormatSerializer>& serializer) noexcept
+{
+    try {
+        auto serialize_result = serialize_for_file(file_path, data, serializer);
         if (!serialize_result) {
             return Result<void>::error(
                 serialize_result.error_code(),
@@ -119,6 +222,134 @@ Result<void> ConfigurationWriter::write_configuration_file(
     }
 }
 
+std::vector<BatchWriteResult> ConfigurationWriter::write_configuration_batch(
+    const std::vector<BatchWriteItem>& items,
+    std::size_t worker_count) noexcept
+{
+    std::vector<BatchWriteResult> results;
+    try {
+        results.reserve(items.size());
+        for (const auto& item : items) {
+            results.push_back({item.file_path, Result<void>::success()});
+        }
+        if (items.empty()) {
+            return results;
+        }
+
+        concurrency::ThreadPool pool(std::min(
+            concurrency::ThreadPool::resolve_thread_count(worker_count), items.size()));
+
+#if defined(__linux__)
+        // Phase 1 (parallel): serialize and write every temp file, deferring the syncs
+        std::vector<std::string> temp_paths(items.size());
+        std::vector<std::unique_ptr<ScopedFd>> temp_fds(items.size());
+        std::atomic<std::size_t> held_fds{0};
+        std::vector<std::pair<std::uint64_t, std::size_t>> written(items.size());
+        pool.parallel_for(items.size(), [&](std::size_t i) {
+            const auto& item = items[i];
+            auto serialized = serialize_for_file(item.file_path, item.data, item.serializer);
+            if (!serialized) {
+                results[i].result = Result<void>::error(
+                    serialized.error_code(), serialized.error_msg_or_default());
+                return;
+            }
+            const std::string& content = serialized.value();
+            if (_skip_unchanged && is_content_unchanged(item.file_path, content)) {
+                results[i].result = Result<void>::unchanged();
+                return;
+            }
+            temp_paths[i] = unique_temp_path(item.file_path);
+            written[i] = {content_hash(content), content.size()};
+            const bool hold = held_fds.fetch_add(1, std::memory_order_relaxed) < kMaxHeldTempFds;
+            results[i].result = write_batch_temp(temp_paths[i], content, hold, temp_fds[i]);
+        });
+
+        // Phase 2 (parallel): fdatasync every held temp file, so the device
+        // sees the flushes together and each file gets its own error
+        pool.parallel_for(items.size(), [&](std::size_t i) {
+            if (temp_fds[i]) {
+                if (results[i].result) {
+                    results[i].result = sync_temp(temp_fds[i]->get(), temp_paths[i]);
+                }
+                temp_fds[i].reset();
+            }
+        });
+
+        // Group written items by parent directory
+        std::map<std::string, std::vector<std::size_t>> by_directory;
+        for (std::size_t i = 0; i < items.size(); ++i) {
+            if (results[i].result && !results[i].result.is_unchanged()) {
+                by_directory[parent_dir_of(items[i].file_path).string()].push_back(i);
+            }
+        }
+
+        auto fail_all = [&](const std::vector<std::size_t>& indices, const Result<void>& error,
+                            bool remove_temp) {
+            for (std::size_t i : indices) {
+                if (results[i].result) {
+                    results[i].result = error;
+                    if (remove_temp) {
+                        ::unlink(temp_paths[i].c_str());
+                    }
+                }
+            }
+        };
+
+        std::map<std::string, std::unique_ptr<ScopedFd>> dir_fds;
+        for (const auto& [dir, indices] : by_directory) {
+            auto fd = std::make_unique<ScopedFd>(::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+            if (!fd->valid()) {
+                fail_all(indices, errno_error("Failed to open directory " + dir, errno), true);
+                continue;
+            }
+            dir_fds.emplace(dir, std::move(fd));
+        }
+
+        // Phase 3: publish every synced temp file, then make the renames durable
+        for (const auto& [dir, fd] : dir_fds) {
+            bool renamed_any = false;
+            for (std::size_t i : by_directory[dir]) {
+                if (!results[i].result) {
+                    continue;
+                }
+                if (::rename(temp_paths[i].c_str(), items[i].file_path.c_str()) != 0) {
+                    results[i].result = errno_error("Failed to rename temporary file", errno);
+                    ::unlink(temp_paths[i].c_str());
+                    continue;
+                }
+                renamed_any = true;
+            }
+            if (renamed_any && ::fsync(fd->get()) != 0) {
+                fail_all(by_directory[dir], errno_error("Failed to sync directory " + dir, errno), false);
+            }
+        }
+
+        if (_skip_unchanged) {
+            for (std::size_t i = 0; i < items.size(); ++i) {
+                if (results[i].result && !results[i].result.is_unchanged()) {
+                    remember_content(items[i].file_path, written[i].first, written[i].second);
+                }
+            }
+        }
+#else
+        // Portable fallback: independent atomic writes, still serialized in parallel
+        pool.parallel_for(items.size(), [&](std::size_t i) {
+            results[i].result = write_configuration_file(
+                items[i].file_path, items[i].data, items[i].serializer);
+        });
+#endif
+    } catch (const std::exception& e) {
+        for (auto& entry : results) {
+            if (entry.result) {
+                entry.result = Result<void>::error(
+                    SerializationError::UNKNOWN_ERROR,
+                    std::string("Batch write failed: ") + e.what());
+            }
+        }
+    }
+    return results;
+}
+
 Result<void> ConfigurationWriter::write_file_content(
     const std::string& file_path,
     const std::string& content,
@@ -126,7 +357,15 @@ Result<void> ConfigurationWriter::write_file_content(
 {
     (void)mime_type; // Currently unused, may be used for file type tracking in future
 
-    return atomic_write(file_path, content);
+    if (_skip_unchanged && is_content_unchanged(file_path, content)) {
+        return Result<void>::unchanged();
+    }
+
+    auto result = atomic_write(file_path, content);
+    if (result && _skip_unchanged) {
+        remember_content(file_path, content_hash(content), content.size());
+    }
+    return result;
 }
 
 } // namespace configgui::core::io
@@ -12,8 +12,15 @@
 
 #include "../models/serialization_result.h"
 #include "../serializers/format_serializer.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
 #include <string>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 #include <nlohmann/json.hpp>
 
 using json = nlohmann::json;
@@ -23,24 +30,66 @@ namespace configgui::core::io {
 using namespace models;
 using namespace serializers;
 
+/**
+ * @struct BatchWriteItem
+ * One configuration to save as part of a batch write
+ */
+struct BatchWriteItem {
+    /// Target file path
+    std::string file_path;
+
+    /// Configuration data (JSON format)
+    json data;
+
+    /// Serializer used for format conversion (may be shared between items)
+    std::shared_ptr<FormatSerializer> serializer;
+};
+
+/**
+ * @struct BatchWriteResult
+ * Outcome of saving one BatchWriteItem
+ */
+struct BatchWriteResult {
+    /// Target file path of the corresponding item
+    std::string file_path;
+
+    /// Success, or the error that prevented this file from being saved
+    Result<void> result;
+};
+
 /**
  * @class ConfigurationWriter
  * Handles atomic file writing operations for configuration files
  *
  * Provides safe, atomic file write operations with error handling:
  * - Writes to temporary file first
- * - Verifies write success
+ * - Verifies write success and flushes it to stable storage
  * - Atomically renames to target path
  * - Graceful error handling with detailed error messages
  *
  * This ensures that configuration files are either completely written
  * or left untouched, preventing file corruption on failure.
+ *
+ * Saves whose serialized bytes already match the file on disk are skipped
+ * and reported via Result<void>::is_unchanged(). A per-writer cache of
+ * content hashes (XXH64, keyed by path and validated against file size and
+ * mtime) avoids re-reading files this writer saved or checked before. A save
+ * is recorded in the same mtime tick it wrote, so the first check after it
+ * still reads the file; once a check has matched the bytes more than
+ * kMtimeGranularity after the file's mtime, later checks use the hash alone.
+ *
+ * Thread-safe: the hash cache is guarded internally, so one writer may be
+ * shared between threads (e.g. HTTP request handlers).
  */
 class ConfigurationWriter {
 public:
     ConfigurationWriter() = default;
     ~ConfigurationWriter() = default;
 
+    // Non-copyable (owns the content hash cache)
+    ConfigurationWriter(const ConfigurationWriter&) = delete;
+    ConfigurationWriter& operator=(const ConfigurationWriter&) = delete;
+
     /**
      * Write configuration data to file in specified format
      *
@@ -78,6 +127,8 @@ public:
      * @note Uses atomic write: temp file + rename to prevent corruption
      * @note Useful when content is already serialized (e.g., from HTTP response)
      * @note Returns FILE_IO_ERROR on write failures
+     * @note Returns Result<void>::unchanged() without touching the file when
+     *       it already holds exactly this content (see set_skip_unchanged)
      *
      * Example:
      *   ConfigurationWriter writer;
@@ -92,11 +143,102 @@ public:
         const std::string& content,
         const std::string& mime_type = "application/octet-stream") noexcept;
 
+    /**
+     * Save many configurations at once (group commit)
+     *
+     * @param items Files to write; each carries its own path, data and serializer
+     * @param worker_count Worker threads for serialization (0 = hardware concurrency)
+     * @return One BatchWriteResult per item, in input order
+     *
+     * @note Items are serialized and their temp files written in parallel,
+     *       then the temp files are fdatasync'd in parallel (so an I/O error
+     *       fails only the file it hit) before they are renamed into place
+     *       and each parent directory is fsync'd once
+     * @note A failure affects only its own item; other files are still saved
+     * @note Items whose content is already on disk report is_unchanged()
+     * @note Non-Linux platforms fall back to parallel write_configuration_file calls
+     *
+     * Example:
+     *   std::vector<BatchWriteItem> items;
+     *   items.push_back({"/etc/app/a.json", data_a, json_serializer});
+     *   items.push_back({"/etc/app/b.ini", data_b, ini_serializer});
+     *   for (const auto& entry : writer.write_configuration_batch(items)) {
+     *       if (!entry.result) { report(entry.file_path, entry.result.error_msg_or_default()); }
+     *   }
+     */
+    std::vector<BatchWriteResult> write_configuration_batch(
+        const std::vector<BatchWriteItem>& items,
+        std::size_t worker_count = 0) noexcept;
+
+    /**
+     * Enable or disable skipping writes whose content is unchanged (default: enabled)
+     * @param enabled When false every save rewrites the file
+     */
+    void set_skip_unchanged(bool enabled) noexcept { _skip_unchanged = enabled; }
+
+    /// Check whether unchanged saves are skipped
+    bool skip_unchanged() const noexcept { return _skip_unchanged; }
+
+    /**
+     * Check whether a file already holds exactly the given content
+     *
+     * @param file_path The target file path
+     * @param content The content about to be written
+     * @return true if the file exists and its bytes equal content
+     *
+     * @note Sizes are compared first; a cached hash is used when the file's
+     *       size and mtime match the last save and that save was recorded
+     *       clearly after the mtime tick, otherwise the file is read
+     */
+    bool is_content_unchanged(const std::string& file_path, const std::string& content) const noexcept;
+
 private:
+    /// Content hash of a file as last written or verified by this writer
+    struct CachedFileState {
+        std::uint64_t hash;
+        std::uintmax_t size;
+        std::filesystem::file_time_type mtime;
+        std::filesystem::file_time_type recorded;  ///< When the bytes were last written or read back
+    };
+
+    /// Coarsest mtime granularity we allow for (FAT: 2 s). An entry recorded
+    /// within this long of the file's mtime is "racy": a same-size rewrite in
+    /// the same tick would leave size and mtime unchanged, so it is verified
+    /// against the bytes on disk instead of trusted (as git does for its index)
+    static constexpr std::chrono::seconds kMtimeGranularity{2};
+
+    /// Upper bound on cached entries; the cache is cleared when exceeded
+    static constexpr std::size_t kMaxCachedFiles = 4096;
+
+    /**
+     * Record the content hash of a file that now holds content
+     * @param file_path The file path
+     * @param hash Hash of content
+     * @param size Size of content
+     */
+    void remember_content(const std::string& file_path, std::uint64_t hash, std::size_t size) const noexcept;
+
+    /**
+     * Serialize data with the given serializer for writing to file_path
+     *
+     * @param file_path The target file path (stored in the serialization context)
+     * @param data The configuration data
+     * @param serializer The serializer to use
+     * @return Serialized content or the serializer's error
+     */
+    Result<std::string> serialize_for_file(
+        const std::string& file_path,
+        const json& data,
+        const std::shared_ptr<FormatSerializer>& serializer) const noexcept;
+
     /**
      * Internal helper for atomic file write
      * Writes to temporary file then atomically renames to target path
      *
+     * @note Delegates to durable_replace_file() (durable_file.h): on Linux
+     *       the data is fdatasync'd before the rename and the parent directory
+     *       fsync'd, so a crash leaves either the old or the new file.
+     *
      * @param file_path The target file path
      * @param content The content to write
      * @return Result indicating success or error
@@ -105,14 +247,9 @@ private:
         const std::string& file_path,
         const std::string& content) noexcept;
 
-    /**
-     * Generate temporary file path in the same directory as target
-     * Ensures temp file is on same filesystem for atomic rename
-     *
-     * @param file_path The target file path
-     * @return Temporary file path
-     */
-    std::string generate_temp_path(const std::string& file_path) const noexcept;
+    bool _skip_unchanged = true;
+    mutable std::mutex _cache_mutex;
+    mutable std::unordered_map<std::string, CachedFileState> _hash_cache;
 };
 
 } // namespace configgui::core::io
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2025 ConfigGUI Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ * content_hash.h
+ * Fast non-cryptographic content hashing (XXH64) for change detection
+ */
+
+#ifndef CONFIGGUI_CORE_IO_CONTENT_HASH_H
+#define CONFIGGUI_CORE_IO_CONTENT_HASH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace configgui::core::io {
+
+/**
+ * Compute the 64-bit XXH64 hash of a byte range
+ *
+ * @param data Pointer to the bytes to hash (may be null when size is 0)
+ * @param size Number of bytes
+ * @param seed Optional seed
+ * @return 64-bit hash value
+ *
+ * @note Not cryptographic: used to detect unchanged file content, not to
+ *       authenticate it
+ * @note Reads input in native byte order; values match the reference
+ *       XXH64 on little-endian hosts and are stable within a process
+ */
+std::uint64_t content_hash(const void* data, std::size_t size, std::uint64_t seed = 0) noexcept;
+
+/// Convenience overload for string content
+inline std::uint64_t content_hash(std::string_view content, std::uint64_t seed = 0) noexcept
+{
+    return content_hash(content.data(), content.size(), seed);
+}
+
+} // namespace configgui::core::io
+
+#endif // CONFIGGUI_CORE_IO_CONTENT_HASH_H
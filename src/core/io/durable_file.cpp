@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2025 ConfigGUI Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ * durable_file.cpp
+ * Crash-safe file replacement implementation
+ */
+
+#include "durable_file.h"
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <cstdio>
+#endif
+
+namespace configgui::core::io {
+
+namespace {
+
+/// Process-wide counter used to make temp names unique without reseeding an RNG per call
+std::atomic<unsigned long> g_temp_counter{0};
+
+#if defined(__linux__)
+
+std::string errno_message(const std::string& what, int err)
+{
+    return what + ": " + std::strerror(err);
+}
+
+/**
+ * Durable atomic write for Linux
+ *
+ * Fast path: an unnamed O_TMPFILE inode is written and fdatasync'd, then
+ * linked under a private name and renamed over the target. linkat() cannot
+ * replace an existing file, hence the extra rename. Filesystems without
+ * O_TMPFILE support fall back to an O_EXCL named temp file. In both cases
+ * the parent directory is fsync'd so the rename itself survives a crash.
+ */
+std::string durable_write_linux(
+    const std::filesystem::path& target_path,
+    const std::string& temp_path,
+    const std::string& content)
+{
+    const std::filesystem::path dir = parent_dir_of(target_path);
+    const std::string temp_name = std::filesystem::path(temp_path).filename().string();
+    const std::string target_name = target_path.filename().string();
+
+    ScopedFd dir_fd(::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    if (!dir_fd.valid()) {
+        return errno_message("Failed to open directory " + dir.string(), errno);
+    }
+
+    ScopedFd file_fd(::open(dir.c_str(), O_TMPFILE | O_WRONLY | O_CLOEXEC, 0644));
+    const bool anonymous = file_fd.valid();
+    if (!anonymous) {
+        if (errno != EOPNOTSUPP && errno != EISDIR && errno != EINVAL) {
+            return errno_message("Failed to create temporary file in " + dir.string(), errno);
+        }
+        // Filesystem does not support O_TMPFILE: use a named temp file instead
+        file_fd.reset(::openat(dir_fd.get(), temp_name.c_str(),
+                               O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644));
+        if (!file_fd.valid()) {
+            return errno_message("Failed to open temporary file " + temp_path, errno);
+        }
+    }
+
+    auto discard_named_temp = [&]() {
+        ::unlinkat(dir_fd.get(), temp_name.c_str(), 0);
+    };
+
+    if (!write_all(file_fd.get(), content)) {
+        const int err = errno;
+        if (!anonymous) {
+            discard_named_temp();
+        }
+        return errno_message("Failed to write to temporary file " + temp_path, err);
+    }
+
+    if (::fdatasync(file_fd.get()) != 0) {
+        const int err = errno;
+        if (!anonymous) {
+            discard_named_temp();
+        }
+        return errno_message("Failed to sync temporary file " + temp_path, err);
+    }
+
+    if (anonymous) {
+        char proc_path[64];
+        std::snprintf(proc_path, sizeof(proc_path), "/proc/self/fd/%d", file_fd.get());
+        if (::linkat(AT_FDCWD, proc_path, dir_fd.get(), temp_name.c_str(), AT_SYMLINK_FOLLOW) != 0) {
+            return errno_message("Failed to link temporary file " + temp_path, errno);
+        }
+    }
+    file_fd.reset();
+
+    if (::renameat(dir_fd.get(), temp_name.c_str(), dir_fd.get(), target_name.c_str()) != 0) {
+        const int err = errno;
+        discard_named_temp();
+        return errno_message("Failed to rename temporary file", err);
+    }
+
+    if (::fsync(dir_fd.get()) != 0) {
+        return errno_message("Failed to sync directory " + dir.string(), errno);
+    }
+
+    return {};
+}
+
+#endif // __linux__
+
+} // namespace
+
+std::filesystem::path parent_dir_of(const std::filesystem::path& target_path)
+{
+    std::filesystem::path dir = target_path.parent_path();
+    return dir.empty() ? std::filesystem::path(".") : dir;
+}
+
+std::string unique_temp_path(const std::string& file_path) noexcept
+{
+    try {
+        std::filesystem::path target_path(file_path);
+        std::filesystem::path dir = target_path.parent_path();
+
+        // Create temp filename with timestamp and a process-wide sequence number
+        auto now = std::time(nullptr);
+        const unsigned long sequence = g_temp_counter.fetch_add(1, std::memory_order_relaxed);
+
+        std::string temp_name = ".tmp_config_" + std::to_string(now) + "_" + std::to_string(sequence);
+#if defined(__linux__)
+        temp_name += "_" + std::to_string(::getpid());
+#endif
+        return (dir / temp_name).string();
+    } catch (const std::exception&) {
+        // Fallback temp path
+        return file_path + ".tmp";
+    }
+}
+
+#if defined(__linux__)
+
+bool write_all(int fd, const std::string& content) noexcept
+{
+    const char* data = content.data();
+    std::size_t remaining = content.size();
+    while (remaining > 0) {
+        const ssize_t written = ::write(fd, data, remaining);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        remaining -= static_cast<std::size_t>(written);
+    }
+    return true;
+}
+
+#endif // __linux__
+
+std::string durable_replace_file(const std::string& file_path, const std::string& content) noexcept
+{
+    try {
+        std::string temp_path = unique_temp_path(file_path);
+
+#if defined(__linux__)
+        return durable_write_linux(std::filesystem::path(file_path), temp_path, content);
+#else
+        // Write to temporary file
+        {
+            std::ofstream temp_file(temp_path, std::ios::binary | std::ios::trunc);
+            if (!temp_file.is_open()) {
+                return "Failed to open temporary file: " + temp_path;
+            }
+
+            temp_file.write(content.c_str(), static_cast<std::streamsize>(content.size()));
+            if (!temp_file.good()) {
+                // Try to clean up temp file
+                std::filesystem::remove(temp_path);
+                return "Failed to write to temporary file: " + temp_path;
+            }
+        } // File closed here
+
+        // Atomically rename temp file to target path
+        try {
+            std::filesystem::rename(temp_path, file_path);
+        } catch (const std::filesystem::filesystem_error& e) {
+            // Clean up temp file if rename fails
+            std::filesystem::remove(temp_path);
+            return std::string("Failed to rename temporary file: ") + e.what();
+        }
+
+        return {};
+#endif
+    } catch (const std::exception& e) {
+        return std::string("Atomic write failed: ") + e.what();
+    }
+}
+
+} // namespace configgui::core::io
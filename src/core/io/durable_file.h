@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2025 ConfigGUI Contributors
+ * SPDX-License-Identifier: MIT
+ *
+ * durable_file.h
+ * Crash-safe file replacement (unique temp file + fsync + rename)
+ */
+
+#ifndef CONFIGGUI_CORE_IO_DURABLE_FILE_H
+#define CONFIGGUI_CORE_IO_DURABLE_FILE_H
+
+#include <filesystem>
+#include <string>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace configgui::core::io {
+
+/// Parent directory of a target path ("." for bare filenames)
+std::filesystem::path parent_dir_of(const std::filesystem::path& target_path);
+
+/**
+ * Generate a unique temporary file path in the same directory as file_path
+ *
+ * @param file_path The target file path
+ * @return Sibling path (same filesystem, so a rename onto the target is atomic)
+ *
+ * @note Names combine a timestamp, a process-wide sequence number and the
+ *       process id, so concurrent writers never share a temp file
+ */
+std::string unique_temp_path(const std::string& file_path) noexcept;
+
+/**
+ * Atomically and durably replace file_path with content
+ *
+ * @param file_path The target file path
+ * @param content The bytes to write
+ * @return Empty string on success, otherwise a description of the failure
+ *
+ * @note On Linux the data is written to an unnamed O_TMPFILE inode (or an
+ *       O_EXCL unique temp file where O_TMPFILE is unsupported), fdatasync'd,
+ *       renamed over the target and the parent directory fsync'd, so a crash
+ *       leaves either the old or the new file, never a torn one.
+ *       Other platforms use the portable ofstream + rename path.
+ * @note The target is created with mode 0644 (before umask)
+ */
+std::string durable_replace_file(const std::string& file_path, const std::string& content) noexcept;
+
+#if defined(__linux__)
+
+/// Owns a POSIX file descriptor and closes it on scope exit
+class ScopedFd {
+public:
+    explicit ScopedFd(int fd) noexcept : _fd(fd) {}
+    ~ScopedFd() { reset(); }
+
+    ScopedFd(const ScopedFd&) = delete;
+    ScopedFd& operator=(const ScopedFd&) = delete;
+
+    int get() const noexcept { return _fd; }
+    bool valid() const noexcept { return _fd >= 0; }
+
+    void reset(int fd = -1) noexcept
+    {
+        if (_fd >= 0) {
+            ::close(_fd);
+        }
+        _fd = fd;
+    }
+
+private:
+    int _fd;
+};
+
+/// Write the whole buffer, retrying on short writes and EINTR
+bool write_all(int fd, const std::string& content) noexcept;
+
+#endif // __linux__
+
+} // namespace configgui::core::io
+
+#endif // CONFIGGUI_CORE_IO_DURABLE_FILE_H
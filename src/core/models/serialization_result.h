@@ -147,6 +147,15 @@ public:
         return Result<void>(code, message);
     }
 
+    /// Construct success result for a write that was skipped because the
+    /// target already held identical content
+    static Result<void> unchanged() noexcept
+    {
+        Result<void> result(SerializationError::SUCCESS, "");
+        result._unchanged = true;
+        return result;
+    }
+
     /// Check if result is successful
     explicit operator bool() const noexcept
     {
@@ -159,6 +168,12 @@ public:
         return _error != SerializationError::SUCCESS;
     }
 
+    /// Check if the operation succeeded without changing anything on disk
+    bool is_unchanged() const noexcept
+    {
+        return _unchanged;
+    }
+
     /// Get the error code
     SerializationError error_code() const noexcept
     {
@@ -186,6 +201,7 @@ private:
 
     SerializationError _error;
     std::string _error_message;
+    bool _unchanged = false;
 };
 
 } // namespace configgui::core::models
@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: MIT
+// BatchValidator - Implementation
+
+#include "batch_validator.h"
+#include "schema_validator.h"
+#include "../concurrency/thread_pool.h"
+#include "../io/json_reader.h"
+#include "../io/yaml_reader.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+
+namespace configgui {
+namespace core {
+
+namespace
+{
+
+bool isYamlPath(const std::string& file_path)
+{
+    std::string extension = std::filesystem::path(file_path).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".yaml" || extension == ".yml";
+}
+
+} // namespace
+
+BatchValidator::BatchValidator(std::shared_ptr<const SchemaValidator> validator, std::size_t worker_count)
+    : validator_(std::move(validator))
+{
+    // The calling thread drains alongside the pool, so it needs one worker fewer
+    const std::size_t threads = concurrency::ThreadPool::resolve_thread_count(worker_count);
+    if (threads > 1)
+    {
+        pool_ = std::make_unique<concurrency::ThreadPool>(threads - 1);
+    }
+}
+
+BatchValidator::~BatchValidator() = default;
+
+std::size_t BatchValidator::workerCount() const
+{
+    return pool_ ? pool_->size() + 1 : 1;
+}
+
+BatchValidationStats BatchValidator::validateFiles(const std::vector<std::string>& file_paths,
+                                                   const BatchValidationCallback& on_result) const
+{
+    return run(file_paths.size(), [&](BatchValidationResult& result) {
+        result.path = file_paths[result.index];
+        auto loaded = isYamlPath(result.path) ? ::configgui::io::YamlReader::readFile(result.path)
+                                              : ::configgui::io::JsonReader::readFile(result.path);
+        if (loaded.is_failure())
+        {
+            result.load_error = loaded.error();
+            return;
+        }
+        result.valid = validator_->validate(loaded.value(), [&result](const ValidationError& error) {
+            result.errors.push_back(error);
+        });
+    }, on_result);
+}
+
+BatchValidationStats BatchValidator::validateDocuments(const std::vector<json>& documents,
+                                                       const BatchValidationCallback& on_result) const
+{
+    return run(documents.size(), [&](BatchValidationResult& result) {
+        result.valid = validator_->validate(documents[result.index], [&result](const ValidationError& error) {
+            result.errors.push_back(error);
+        });
+    }, on_result);
+}
+
+std::vector<BatchValidationResult> BatchValidator::validateDocuments(const std::vector<json>& documents) const
+{
+    std::vector<BatchValidationResult> results(documents.size());
+    validateDocuments(documents, [&results](BatchValidationResult&& result) {
+        const std::size_t index = result.index;
+        results[index] = std::move(result);
+    });
+    return results;
+}
+
+BatchValidationStats BatchValidator::run(std::size_t count,
+                                         const std::function<void(BatchValidationResult&)>& process,
+                                         const BatchValidationCallback& on_result) const
+{
+    BatchValidationStats stats;
+    stats.workers = std::min(workerCount(), std::max<std::size_t>(count, 1));
+    std::mutex report_mutex;
+
+    const auto start = std::chrono::steady_clock::now();
+    auto body = [&](std::size_t index) {
+        BatchValidationResult result;
+        result.index = index;
+        try
+        {
+            process(result);
+        }
+        catch (const std::exception& e)
+        {
+            result.valid = false;
+            result.load_error = e.what();
+        }
+
+        // Only the bookkeeping and the callback are serialized; validation is not
+        std::lock_guard<std::mutex> lock(report_mutex);
+        ++stats.documents;
+        stats.errors += result.errors.size();
+        if (!result.load_error.empty())
+        {
+            ++stats.load_failures;
+        }
+        else if (result.valid)
+        {
+            ++stats.valid;
+        }
+        else
+        {
+            ++stats.invalid;
+        }
+        if (on_result)
+        {
+            on_result(std::move(result));
+        }
+    };
+
+    if (pool_)
+    {
+        pool_->parallel_for(count, body);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            body(i);
+        }
+    }
+
+    stats.elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+} // namespace core
+} // namespace configgui
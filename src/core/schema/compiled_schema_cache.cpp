@@ -0,0 +1,451 @@
+// SPDX-License-Identifier: MIT
+// CompiledSchemaCache - Implementation
+
+#include "compiled_schema_cache.h"
+#include "schema.h"
+#include "schema_artifact.h"
+#include "schema_bundle.h"
+#include "schema_normalizer.h"
+#include "schema_validator.h"
+#include "../io/content_hash.h"
+#include "../io/yaml_reader.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+
+namespace configgui {
+namespace core {
+
+namespace
+{
+
+using CompiledResult = Result<std::shared_ptr<const CompiledSchema>, FileError>;
+using Clock = std::filesystem::file_time_type::clock;
+
+/// @brief Hash seeds keep JSON and YAML sources with identical bytes apart
+constexpr std::uint64_t kJsonSeed = 0;
+constexpr std::uint64_t kYamlSeed = 1;
+
+bool isYamlPath(const std::string& file_path)
+{
+    std::string extension = std::filesystem::path(file_path).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".yaml" || extension == ".yml";
+}
+
+bool readBytes(const std::string& file_path, std::string& content)
+{
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    content = buffer.str();
+    return true;
+}
+
+/// @brief Whether a same-size edit in mtime's tick could have gone unseen by a read at verified
+bool isRacy(std::filesystem::file_time_type mtime, std::filesystem::file_time_type verified)
+{
+    return verified - mtime < CompiledSchemaCache::kMtimeGranularity;
+}
+
+/// @brief Stamp file_path with its current size, mtime and content hash
+/// @return False if the file cannot be stat'ed or read
+bool stampFile(const std::string& file_path, FileStamp& stamp)
+{
+    std::error_code ec;
+    stamp.path = file_path;
+    stamp.recorded = Clock::now();
+    stamp.mtime = std::filesystem::last_write_time(file_path, ec);
+    stamp.size = ec ? std::uintmax_t{0} : std::filesystem::file_size(file_path, ec);
+    std::string content;
+    if (ec || !readBytes(file_path, content))
+    {
+        return false;
+    }
+    stamp.hash = io::content_hash(content);
+    return true;
+}
+
+/// @brief dependenciesFresh() "verified" for callers that never checked the stamps themselves
+/// (not file_time_type{}, which libstdc++ places after any real mtime)
+constexpr std::filesystem::file_time_type kNeverVerified = std::filesystem::file_time_type::min();
+
+/// @brief Whether every external document of compiled is unchanged since it was stamped
+/// @param verified When the caller last confirmed the stamps against the bytes
+/// @param reread Set when a racy stamp had to be confirmed against the bytes
+bool dependenciesFresh(const CompiledSchema& compiled, std::filesystem::file_time_type verified, bool& reread)
+{
+    std::string content;
+    for (const auto& dependency : compiled.dependencies)
+    {
+        std::error_code ec;
+        const auto mtime = std::filesystem::last_write_time(dependency.path, ec);
+        const auto size = ec ? std::uintmax_t{0} : std::filesystem::file_size(dependency.path, ec);
+        if (ec || mtime != dependency.mtime || size != dependency.size)
+        {
+            return false;
+        }
+        if (isRacy(mtime, std::max(dependency.recorded, verified)))
+        {
+            reread = true;
+            if (!readBytes(dependency.path, content) || io::content_hash(content) != dependency.hash)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/// @brief Whether compiled was built from exactly these bytes in this directory
+bool sameSource(const CompiledSchema& compiled, const std::string& content, const std::string& base_dir)
+{
+    return compiled.source_text == content && compiled.source_dir == base_dir;
+}
+
+/// @brief Build the shared entry from an analysed schema
+/// @param schema_known_valid Skip compiling json_validator up front (see SchemaValidator)
+/// @param source_text, source_dir What the schema was read from (see sameSource)
+std::shared_ptr<const CompiledSchema> assemble(json schema_json, std::shared_ptr<const SchemaBundle> bundle,
+                                               bool schema_known_valid, std::uint64_t hash,
+                                               std::string source_text, std::string source_dir)
+{
+    auto compiled = std::make_shared<CompiledSchema>();
+    compiled->bundle = std::move(bundle);
+    if (compiled->bundle)
+    {
+        // A referenced file that cannot be stamped gets a stamp that never matches
+        for (const auto& path : compiled->bundle->externalDocuments())
+        {
+            FileStamp stamp;
+            if (!stampFile(path, stamp))
+            {
+                stamp.size = static_cast<std::uintmax_t>(-1);
+            }
+            compiled->dependencies.push_back(std::move(stamp));
+        }
+    }
+    const json& effective = compiled->bundle ? compiled->bundle->dereferenced() : schema_json;
+
+    auto validator = std::make_shared<SchemaValidator>(effective, schema_known_valid);
+    compiled->normalizer = std::make_shared<const SchemaNormalizer>(effective);
+    compiled->json_text = effective.dump();
+    compiled->schema = std::make_shared<const JSONSchema>(std::move(schema_json), validator);
+    compiled->validator = std::move(validator);
+    compiled->content_hash = hash;
+    compiled->source_text = std::move(source_text);
+    compiled->source_dir = std::move(source_dir);
+    return compiled;
+}
+
+CompiledResult compileSchema(const std::string& content, bool yaml, std::uint64_t hash,
+                             const std::filesystem::path& base_dir)
+{
+    try
+    {
+        json schema_json;
+        if (yaml)
+        {
+            auto parsed = ::configgui::io::YamlReader::readString(content);
+            if (parsed.is_failure())
+            {
+                return CompiledResult(FileError::ParseError);
+            }
+            schema_json = std::move(parsed).value();
+        }
+        else
+        {
+            schema_json = json::parse(content);
+        }
+
+        if (!schema_json.is_object())
+        {
+            return CompiledResult(FileError::InvalidJson);
+        }
+
+        // Consumers prefer the bundled view; schemas with cyclic or unresolvable
+        // $refs keep working from the parsed tree
+        std::shared_ptr<const SchemaBundle> bundle;
+        auto bundled = SchemaBundle::fromSchema(schema_json, base_dir);
+        if (bundled.is_success())
+        {
+            bundle = std::make_shared<const SchemaBundle>(std::move(bundled).value());
+        }
+        return CompiledResult(assemble(std::move(schema_json), std::move(bundle), false, hash, content,
+                                       base_dir.string()));
+    }
+    catch (const json::exception& /*e*/)
+    {
+        return CompiledResult(FileError::ParseError);
+    }
+    catch (const std::exception& /*e*/)
+    {
+        return CompiledResult(FileError::UnknownError);
+    }
+}
+
+/// @brief Entry from a precompiled artifact, or nullptr when it is missing or stale
+std::shared_ptr<const CompiledSchema> loadArtifact(const std::string& file_path, std::uint64_t hash,
+                                                   const std::string& content, const std::string& base_dir)
+{
+    auto artifact = SchemaArtifact::read(SchemaArtifact::pathFor(file_path), hash);
+    if (artifact.is_failure())
+    {
+        return nullptr;
+    }
+    try
+    {
+        SchemaArtifact& loaded = artifact.value();
+        return assemble(std::move(loaded.source), std::move(loaded.bundle), loaded.schema_valid, hash, content,
+                        base_dir);
+    }
+    catch (const std::exception& /*e*/)
+    {
+        return nullptr;
+    }
+}
+
+/// @brief Cache key for schemas that did not come from a file
+std::string contentKey(std::uint64_t hash)
+{
+    return "content:" + std::to_string(hash);
+}
+
+} // namespace
+
+CompiledSchemaCache::CompiledSchemaCache(std::size_t capacity) : capacity_(std::max<std::size_t>(capacity, 1)) {}
+
+CompiledSchemaCache& CompiledSchemaCache::instance()
+{
+    static CompiledSchemaCache cache;
+    return cache;
+}
+
+Result<std::shared_ptr<const CompiledSchema>, FileError> CompiledSchemaCache::get(const std::string& file_path)
+{
+    std::error_code ec;
+    const auto mtime = std::filesystem::last_write_time(file_path, ec);
+    const auto size = ec ? std::uintmax_t{0} : std::filesystem::file_size(file_path, ec);
+    if (ec)
+    {
+        return CompiledResult(FileError::NotFound);
+    }
+
+    std::shared_ptr<const CompiledSchema> cached;
+    std::filesystem::file_time_type verified;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = entries_.find(file_path);
+        if (it != entries_.end() && it->second.mtime == mtime && it->second.size == size)
+        {
+            cached = it->second.compiled;
+            verified = it->second.verified;
+        }
+    }
+
+    const std::string base_dir = std::filesystem::path(file_path).parent_path().string();
+    std::string content;
+    bool have_content = false;
+    auto read_at = Clock::now();
+
+    // Files are stat'ed and, when racy, read outside the lock
+    if (cached)
+    {
+        bool reread = false;
+        if (isRacy(mtime, verified))
+        {
+            reread = true;
+            if (!readBytes(file_path, content))
+            {
+                return CompiledResult(FileError::NotFound);
+            }
+            have_content = true;
+            if (!sameSource(*cached, content, base_dir))
+            {
+                cached = nullptr;
+            }
+        }
+        if (cached && dependenciesFresh(*cached, verified, reread))
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            const auto it = entries_.find(file_path);
+            if (it != entries_.end() && it->second.compiled == cached)
+            {
+                lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+                if (reread)
+                {
+                    it->second.verified = read_at;
+                }
+            }
+            ++stats_.hits;
+            return CompiledResult(std::move(cached));
+        }
+    }
+
+    if (!have_content)
+    {
+        read_at = Clock::now();
+        if (!readBytes(file_path, content))
+        {
+            return CompiledResult(FileError::NotFound);
+        }
+    }
+
+    const bool yaml = isYamlPath(file_path);
+    const std::uint64_t directory_hash = io::content_hash(base_dir, yaml ? kYamlSeed : kJsonSeed);
+    const std::uint64_t hash = io::content_hash(content, directory_hash);
+
+    // Touched file, or content already compiled for another path
+    std::shared_ptr<const CompiledSchema> shared;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shared = findByHash(hash);
+    }
+    bool reread = false;
+    if (shared && sameSource(*shared, content, base_dir) && dependenciesFresh(*shared, kNeverVerified, reread))
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        store(file_path, Entry{mtime, size, read_at, shared, {}});
+        ++stats_.hits;
+        return CompiledResult(std::move(shared));
+    }
+
+    // OPTIMIZATION: A fresh artifact from an earlier run skips parsing, $ref
+    // resolution and json_validator compilation
+    if (artifacts_enabled_.load(std::memory_order_relaxed))
+    {
+        if (auto precompiled = loadArtifact(file_path, hash, content, base_dir))
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ++stats_.artifact_loads;
+            by_hash_[hash] = precompiled;
+            store(file_path, Entry{mtime, size, read_at, precompiled, {}});
+            return CompiledResult(std::move(precompiled));
+        }
+    }
+
+    // Compile outside the lock so slow schemas do not block other lookups
+    auto compiled = compileSchema(content, yaml, hash, base_dir);
+    if (compiled.is_failure())
+    {
+        return compiled;
+    }
+    if (artifacts_enabled_.load(std::memory_order_relaxed))
+    {
+        // Best effort: a read-only schema directory just means no artifact
+        (void)SchemaArtifact::write(SchemaArtifact::pathFor(file_path), hash, *compiled.value());
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.misses;
+    by_hash_[hash] = compiled.value();
+    store(file_path, Entry{mtime, size, read_at, compiled.value(), {}});
+    return compiled;
+}
+
+Result<std::shared_ptr<const CompiledSchema>, FileError> CompiledSchemaCache::getFromString(
+    const std::string& json_text)
+{
+    // Same key as a file in the working directory; relative $refs resolve there too
+    const std::uint64_t hash = io::content_hash(json_text, io::content_hash(std::string_view{}, kJsonSeed));
+    const std::string key = contentKey(hash);
+
+    std::shared_ptr<const CompiledSchema> shared;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shared = findByHash(hash);
+    }
+    bool reread = false;
+    if (shared && sameSource(*shared, json_text, std::string()) && dependenciesFresh(*shared, kNeverVerified, reread))
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        store(key, Entry{{}, json_text.size(), {}, shared, {}});
+        ++stats_.hits;
+        return CompiledResult(std::move(shared));
+    }
+
+    auto compiled = compileSchema(json_text, false, hash, {});
+    if (compiled.is_failure())
+    {
+        return compiled;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.misses;
+    by_hash_[hash] = compiled.value();
+    store(key, Entry{{}, json_text.size(), {}, compiled.value(), {}});
+    return compiled;
+}
+
+void CompiledSchemaCache::setArtifactsEnabled(bool enabled)
+{
+    artifacts_enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+bool CompiledSchemaCache::artifactsEnabled() const
+{
+    return artifacts_enabled_.load(std::memory_order_relaxed);
+}
+
+void CompiledSchemaCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+    by_hash_.clear();
+    stats_.entries = 0;
+}
+
+CompiledSchemaCache::Stats CompiledSchemaCache::stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+std::shared_ptr<const CompiledSchema> CompiledSchemaCache::findByHash(std::uint64_t hash) const
+{
+    const auto it = by_hash_.find(hash);
+    return (it != by_hash_.end()) ? it->second.lock() : nullptr;
+}
+
+void CompiledSchemaCache::store(const std::string& file_path, Entry entry)
+{
+    const auto existing = entries_.find(file_path);
+    if (existing != entries_.end())
+    {
+        lru_.splice(lru_.begin(), lru_, existing->second.lru_position);
+        entry.lru_position = existing->second.lru_position;
+        existing->second = std::move(entry);
+        return;
+    }
+
+    lru_.push_front(file_path);
+    entry.lru_position = lru_.begin();
+    entries_.emplace(file_path, std::move(entry));
+
+    while (entries_.size() > capacity_)
+    {
+        entries_.erase(lru_.back());
+        lru_.pop_back();
+        ++stats_.evictions;
+    }
+
+    // Drop hash slots whose schema is no longer held by any entry or caller
+    if (by_hash_.size() > 2 * capacity_)
+    {
+        for (auto it = by_hash_.begin(); it != by_hash_.end();)
+        {
+            it = it->second.expired() ? by_hash_.erase(it) : std::next(it);
+        }
+    }
+    stats_.entries = entries_.size();
+}
+
+} // namespace core
+} // namespace configgui
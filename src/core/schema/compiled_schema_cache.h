@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: MIT
+// CompiledSchemaCache - Process-wide cache of parsed and compiled schemas
+
+#pragma once
+
+#include "../error_types.h"
+#include "../result.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// NOTE: No `json` alias in this header. It is shared with the HTML server, whose
+// handlers use nlohmann::json rather than the core's nlohmann::ordered_json.
+
+namespace configgui {
+namespace core {
+
+class JSONSchema;
+class SchemaBundle;
+class SchemaNormalizer;
+class SchemaValidator;
+
+/// @brief Size, mtime and content hash of a file as it was when a schema was compiled from it
+struct FileStamp
+{
+    std::string path;
+    std::filesystem::file_time_type mtime;
+    std::uintmax_t size = 0;
+    std::uint64_t hash = 0;                    ///< XXH64 of the bytes
+    std::filesystem::file_time_type recorded;  ///< When the bytes were read
+};
+
+/// @brief One schema file, parsed and compiled once and shared read-only
+struct CompiledSchema
+{
+    std::shared_ptr<const JSONSchema> schema;           ///< Parsed schema (ordered, with validator)
+    std::shared_ptr<const SchemaValidator> validator;   ///< Compiled validator for the schema
+    std::shared_ptr<const SchemaBundle> bundle;         ///< $ref-free view (null if a $ref cannot be inlined)
+    std::shared_ptr<const SchemaNormalizer> normalizer; ///< Default filling / coercion pass
+    std::string json_text;                              ///< Bundled (else parsed) schema as compact JSON
+    std::uint64_t content_hash = 0;                     ///< XXH64 of the file bytes and directory
+    std::string source_text;                            ///< File bytes (or JSON text) compiled from
+    std::string source_dir;                             ///< Directory relative $refs resolved against
+    std::vector<FileStamp> dependencies;                ///< External $ref documents, stamped when bundled
+};
+
+/// @brief Thread-safe LRU cache of compiled schemas keyed by file path and content
+///
+/// OPTIMIZATION: A lookup whose file mtime and size are unchanged is answered
+/// without touching the file. When they changed, the file is re-read and hashed;
+/// identical content (a touch, or the same schema under another path) reuses
+/// the compiled entry, so parsing and validator compilation only happen for
+/// content that has never been seen. Entries are only shared when the bytes
+/// and directory match, not on the hash alone.
+///
+/// A file whose bytes were read within kMtimeGranularity of its mtime is
+/// "racy": a same-size edit in the same tick would leave mtime and size
+/// unchanged. Hits on racy files re-read and compare the bytes until a check
+/// lands clearly after the mtime, as ConfigurationWriter does for its cache.
+///
+/// Relative-file $refs are resolved against the schema's directory, so the
+/// directory is part of the content hash. The files those $refs pull in are
+/// stamped (size, mtime and hash) when the schema is compiled, and every hit
+/// also checks their stamps under the same rule, so an edit made only to a
+/// referenced file recompiles.
+///
+/// Content that was never seen in this process is first looked up as a
+/// precompiled SchemaArtifact next to the file; every compile from source
+/// writes one, so the next process start skips the analysis.
+class CompiledSchemaCache
+{
+public:
+    /// @brief Cache counters
+    struct Stats
+    {
+        std::size_t hits = 0;           ///< Lookups served without compiling
+        std::size_t misses = 0;         ///< Lookups that parsed and compiled the schema
+        std::size_t artifact_loads = 0; ///< Lookups served from a precompiled artifact
+        std::size_t evictions = 0;      ///< Entries dropped to respect the capacity
+        std::size_t entries = 0;        ///< Paths currently cached
+    };
+
+    static constexpr std::size_t kDefaultCapacity = 64;
+
+    /// @brief Coarsest mtime granularity allowed for (FAT: 2 s)
+    static constexpr std::chrono::seconds kMtimeGranularity{2};
+
+    /// @brief Create a cache holding at most capacity paths (minimum 1)
+    explicit CompiledSchemaCache(std::size_t capacity = kDefaultCapacity);
+    ~CompiledSchemaCache() = default;
+
+    // Non-copyable, non-movable
+    CompiledSchemaCache(const CompiledSchemaCache&) = delete;
+    CompiledSchemaCache& operator=(const CompiledSchemaCache&) = delete;
+    CompiledSchemaCache(CompiledSchemaCache&&) = delete;
+    CompiledSchemaCache& operator=(CompiledSchemaCache&&) = delete;
+
+    /// @brief Cache shared by the whole process (Qt and HTML front-ends)
+    static CompiledSchemaCache& instance();
+
+    /// @brief Get the compiled schema for a .json, .yaml or .yml file
+    /// @return Shared immutable entry, or NotFound/ParseError/InvalidJson
+    [[nodiscard]] Result<std::shared_ptr<const CompiledSchema>, FileError> get(const std::string& file_path);
+
+    /// @brief Get the compiled schema for JSON text (cached by content hash only)
+    [[nodiscard]] Result<std::shared_ptr<const CompiledSchema>, FileError> getFromString(const std::string& json_text);
+
+    /// @brief Read and write "<schema>.compiled" artifacts for file lookups (default: enabled)
+    void setArtifactsEnabled(bool enabled);
+
+    /// @brief Whether precompiled artifacts are used
+    [[nodiscard]] bool artifactsEnabled() const;
+
+    /// @brief Drop every entry (counters are kept)
+    void clear();
+
+    /// @brief Snapshot of the counters
+    [[nodiscard]] Stats stats() const;
+
+private:
+    struct Entry
+    {
+        std::filesystem::file_time_type mtime;
+        std::uintmax_t size = 0;
+        std::filesystem::file_time_type verified;  ///< Last time the bytes were read and matched
+        std::shared_ptr<const CompiledSchema> compiled;
+        std::list<std::string>::iterator lru_position;
+    };
+
+    [[nodiscard]] std::shared_ptr<const CompiledSchema> findByHash(std::uint64_t hash) const;
+    void store(const std::string& file_path, Entry entry);
+
+    std::size_t capacity_;
+    std::atomic<bool> artifacts_enabled_{true};
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::list<std::string> lru_;  ///< Most recently used path first
+    std::unordered_map<std::uint64_t, std::weak_ptr<const CompiledSchema>> by_hash_;
+    Stats stats_;
+};
+
+} // namespace core
+} // namespace configgui
@@ -0,0 +1,297 @@
+// SPDX-License-Identifier: MIT
+// ConfigMigrator - Implementation
+
+#include "config_migrator.h"
+#include "schema_bundle.h"
+#include "schema_validator.h"
+#include "../concurrency/thread_pool.h"
+#include "../io/durable_file.h"
+#include "../io/json_reader.h"
+#include "../io/yaml_reader.h"
+#include "../io/yaml_writer.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+
+namespace configgui {
+namespace core {
+
+namespace
+{
+
+bool isYamlPath(const std::string& file_path)
+{
+    std::string extension = std::filesystem::path(file_path).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".yaml" || extension == ".yml";
+}
+
+bool isArrayIndex(const std::string& token)
+{
+    return !token.empty() && std::all_of(token.begin(), token.end(), [](char c) { return c >= '0' && c <= '9'; });
+}
+
+/// @brief Target schema with every $ref inlined, so defaults behind external refs are filled
+json normalizerSchema(const JSONSchema& to, const std::filesystem::path& base_dir)
+{
+    auto bundle = SchemaBundle::fromSchema(to.raw_schema(), base_dir);
+    return bundle.is_success() ? bundle.value().dereferenced() : to.raw_schema();
+}
+
+} // namespace
+
+MigrationPlan::MigrationPlan(const JSONSchema& from, const JSONSchema& to, const std::filesystem::path& base_dir)
+    : diff_(SchemaDiff::compute(from, to))
+    , normalizer_(normalizerSchema(to, base_dir))
+{
+    // Additions and retypes are left to the normalizer; only object members move here
+    for (const auto& change : diff_.changes())
+    {
+        if (change.kind != SchemaChangeKind::Renamed && change.kind != SchemaChangeKind::Removed)
+        {
+            continue;
+        }
+
+        Operation operation;
+        operation.rename = (change.kind == SchemaChangeKind::Renamed);
+        operation.parent = SchemaDiff::splitPointer(change.path);
+        if (operation.parent.empty())
+        {
+            continue;  // The root itself cannot be renamed or removed
+        }
+        operation.key = std::move(operation.parent.back());
+        operation.parent.pop_back();
+        if (operation.rename)
+        {
+            const auto target = SchemaDiff::splitPointer(change.new_path);
+            operation.new_key = target.empty() ? std::string() : target.back();
+        }
+        else if (operation.key == JSONSchema::kArrayItemToken || isArrayIndex(operation.key))
+        {
+            continue;  // Dropping an items schema does not delete array elements
+        }
+        operations_.push_back(std::move(operation));
+    }
+}
+
+bool MigrationPlan::apply(json& document, NormalizeStats* stats) const
+{
+    bool changed = false;
+    for (const auto& operation : operations_)
+    {
+        applyAt(operation, document, 0, changed);
+    }
+
+    NormalizeStats local;
+    NormalizeOptions options;
+    options.fill_defaults = true;
+    options.coerce_types = true;
+    options.strip_unknown = false;  // Members the plan does not know about belong to the user
+    normalizer_.normalizeInPlace(document, options, &local);
+    if (stats)
+    {
+        *stats = local;
+    }
+    return changed || local.defaults_filled > 0 || local.coerced > 0;
+}
+
+void MigrationPlan::applyAt(const Operation& operation, json& value, std::size_t depth, bool& changed)
+{
+    if (depth == operation.parent.size())
+    {
+        if (!value.is_object())
+        {
+            return;
+        }
+        const auto it = value.find(operation.key);
+        if (it == value.end())
+        {
+            return;
+        }
+        if (operation.rename)
+        {
+            if (value.contains(operation.new_key))
+            {
+                return;  // Never overwrite a value the config already has
+            }
+            json moved = std::move(*it);
+            value.erase(operation.key);
+            value[operation.new_key] = std::move(moved);
+        }
+        else
+        {
+            value.erase(operation.key);
+        }
+        changed = true;
+        return;
+    }
+
+    const std::string& token = operation.parent[depth];
+    if (value.is_array())
+    {
+        if (token == JSONSchema::kArrayItemToken)
+        {
+            for (auto& element : value)
+            {
+                applyAt(operation, element, depth + 1, changed);
+            }
+        }
+        else if (isArrayIndex(token))
+        {
+            const std::size_t index = std::stoul(token);
+            if (index < value.size())
+            {
+                applyAt(operation, value[index], depth + 1, changed);
+            }
+        }
+        return;
+    }
+
+    if (value.is_object())
+    {
+        const auto it = value.find(token);
+        if (it != value.end())
+        {
+            applyAt(operation, *it, depth + 1, changed);
+        }
+    }
+}
+
+ConfigMigrator::ConfigMigrator(std::shared_ptr<const MigrationPlan> plan,
+                               std::shared_ptr<const SchemaValidator> target_validator, std::size_t worker_count)
+    : plan_(std::move(plan))
+    , validator_(std::move(target_validator))
+{
+    // The calling thread drains alongside the pool, so it needs one worker fewer
+    const std::size_t threads = concurrency::ThreadPool::resolve_thread_count(worker_count);
+    if (threads > 1)
+    {
+        pool_ = std::make_unique<concurrency::ThreadPool>(threads - 1);
+    }
+}
+
+ConfigMigrator::~ConfigMigrator() = default;
+
+std::size_t ConfigMigrator::workerCount() const
+{
+    return pool_ ? pool_->size() + 1 : 1;
+}
+
+void ConfigMigrator::migrateOne(json& document, MigrationResult& result) const
+{
+    result.changed = plan_->apply(document);
+    if (validator_)
+    {
+        result.valid = validator_->validate(document, [&result](const ValidationError& error) {
+            result.errors.push_back(error);
+        });
+    }
+}
+
+MigrationStats ConfigMigrator::migrateFiles(const std::vector<std::string>& file_paths,
+                                            const MigrationCallback& on_result, bool write_back) const
+{
+    return run(file_paths.size(), [&](MigrationResult& result) {
+        result.path = file_paths[result.index];
+        const bool yaml = isYamlPath(result.path);
+        auto loaded = yaml ? ::configgui::io::YamlReader::readFile(result.path)
+                           : ::configgui::io::JsonReader::readFile(result.path);
+        if (loaded.is_failure())
+        {
+            result.error = loaded.error();
+            return;
+        }
+
+        json document = std::move(loaded.value());
+        migrateOne(document, result);
+        if (!write_back || !result.changed)
+        {
+            return;
+        }
+
+        std::string content;
+        if (yaml)
+        {
+            auto serialized = ::configgui::io::YamlWriter::toString(document);
+            if (serialized.is_failure())
+            {
+                result.error = serialized.error().message;
+                return;
+            }
+            content = std::move(serialized.value());
+        }
+        else
+        {
+            content = document.dump(4);  // Same layout as JsonWriter's pretty print
+        }
+        result.error = ::configgui::core::io::durable_replace_file(result.path, content);
+    }, on_result);
+}
+
+MigrationStats ConfigMigrator::migrateDocuments(std::vector<json>& documents, const MigrationCallback& on_result) const
+{
+    // Each worker touches only its own element, so in-place updates need no locking
+    return run(documents.size(), [&](MigrationResult& result) {
+        migrateOne(documents[result.index], result);
+    }, on_result);
+}
+
+MigrationStats ConfigMigrator::run(std::size_t count, const std::function<void(MigrationResult&)>& process,
+                                   const MigrationCallback& on_result) const
+{
+    MigrationStats stats;
+    stats.workers = std::min(workerCount(), std::max<std::size_t>(count, 1));
+    std::mutex report_mutex;
+
+    const auto start = std::chrono::steady_clock::now();
+    auto body = [&](std::size_t index) {
+        MigrationResult result;
+        result.index = index;
+        try
+        {
+            process(result);
+        }
+        catch (const std::exception& e)
+        {
+            result.error = e.what();
+        }
+
+        // Only the bookkeeping and the callback are serialized; migration is not
+        std::lock_guard<std::mutex> lock(report_mutex);
+        ++stats.documents;
+        if (!result.error.empty())
+        {
+            ++stats.failures;
+        }
+        else
+        {
+            stats.changed += result.changed ? 1 : 0;
+            stats.invalid += result.valid ? 0 : 1;
+        }
+        if (on_result)
+        {
+            on_result(std::move(result));
+        }
+    };
+
+    if (pool_)
+    {
+        pool_->parallel_for(count, body);
+    }
+    else
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            body(i);
+        }
+    }
+
+    stats.elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+} // namespace core
+} // namespace configgui
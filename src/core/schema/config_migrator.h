@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: MIT
+// ConfigMigrator - Applies a schema migration plan to many configs in parallel
+
+#pragma once
+
+#include "schema_diff.h"
+#include "schema_normalizer.h"
+#include "validation_error.h"
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace configgui {
+namespace core {
+
+class SchemaValidator;
+
+namespace concurrency {
+class ThreadPool;
+} // namespace concurrency
+
+/// @brief Transform plan that upgrades configs from one schema version to the next
+///
+/// Compiled once from a SchemaDiff: renames and removals become object-member
+/// operations addressed by pre-split parent paths ("*" fans out over array
+/// elements), and additions and retypes are handled by the target schema's
+/// SchemaNormalizer (defaults filled, scalars coerced when lossless), built
+/// from the bundled view so defaults behind $refs are filled too.
+/// Immutable after construction, so one plan is shared by every worker.
+class MigrationPlan
+{
+public:
+    /// @param base_dir Directory relative-file $refs in to are resolved against
+    MigrationPlan(const JSONSchema& from, const JSONSchema& to, const std::filesystem::path& base_dir = {});
+
+    /// @brief Upgrade document in place
+    /// @return True if the document changed
+    bool apply(json& document, NormalizeStats* stats = nullptr) const;
+
+    /// @brief The diff the plan was compiled from
+    [[nodiscard]] const SchemaDiff& diff() const { return diff_; }
+
+    /// @brief Number of rename/remove operations
+    [[nodiscard]] std::size_t operationCount() const { return operations_.size(); }
+
+private:
+    struct Operation
+    {
+        bool rename = false;              ///< Rename key to new_key, otherwise remove key
+        std::vector<std::string> parent;  ///< Reference tokens of the containing object
+        std::string key;
+        std::string new_key;
+    };
+
+    static void applyAt(const Operation& operation, json& value, std::size_t depth, bool& changed);
+
+    SchemaDiff diff_;
+    std::vector<Operation> operations_;
+    SchemaNormalizer normalizer_;
+};
+
+/// @brief Outcome for one config of a migration batch
+struct MigrationResult
+{
+    std::size_t index = 0;    ///< Position of the config in the input
+    std::string path;         ///< Source file, or "" for in-memory documents
+    bool changed = false;     ///< The plan modified the config
+    bool valid = true;        ///< Passed target-schema validation (true when not validated)
+    ValidationErrors errors;  ///< Target-schema violations left after migration
+    std::string error;        ///< Non-empty when the file could not be read, parsed or written
+};
+
+/// @brief Aggregate figures for a migration batch
+struct MigrationStats
+{
+    std::size_t documents = 0;  ///< Configs processed
+    std::size_t changed = 0;    ///< Configs the plan modified
+    std::size_t invalid = 0;    ///< Configs still violating the target schema
+    std::size_t failures = 0;   ///< Files that could not be read, parsed or written
+    std::size_t workers = 0;    ///< Threads that took part (including the caller)
+    double elapsed_ms = 0.0;    ///< Wall-clock time of the batch
+
+    /// @brief Throughput of the batch
+    [[nodiscard]] double documentsPerSecond() const
+    {
+        return elapsed_ms > 0.0 ? 1000.0 * static_cast<double>(documents) / elapsed_ms : 0.0;
+    }
+};
+
+/// @brief Receives each result as soon as its config finishes
+/// Calls are serialized (never concurrent) but arrive in completion order
+using MigrationCallback = std::function<void(MigrationResult&&)>;
+
+/// @brief Streams configs through a MigrationPlan on a thread pool
+///
+/// OPTIMIZATION: Each worker loads, migrates, validates and writes back one
+/// file at a time, so memory stays bounded by the worker count rather than
+/// the batch size, and no step waits for the whole batch. Workers claim the
+/// next file from a shared counter; only result reporting is serialized.
+class ConfigMigrator
+{
+public:
+    /// @param plan Compiled migration shared by all workers
+    /// @param target_validator Optional validator for the new schema (nullptr = skip validation)
+    /// @param worker_count Threads to use (0 = hardware concurrency)
+    ConfigMigrator(std::shared_ptr<const MigrationPlan> plan,
+                   std::shared_ptr<const SchemaValidator> target_validator = nullptr,
+                   std::size_t worker_count = 0);
+    ~ConfigMigrator();
+
+    // Non-copyable, non-movable (owns a thread pool)
+    ConfigMigrator(const ConfigMigrator&) = delete;
+    ConfigMigrator& operator=(const ConfigMigrator&) = delete;
+    ConfigMigrator(ConfigMigrator&&) = delete;
+    ConfigMigrator& operator=(ConfigMigrator&&) = delete;
+
+    /// @brief Migrate .json/.yaml/.yml files, rewriting the changed ones when write_back is set
+    MigrationStats migrateFiles(const std::vector<std::string>& file_paths, const MigrationCallback& on_result,
+                                bool write_back = true) const;
+
+    /// @brief Migrate documents in memory, in place
+    MigrationStats migrateDocuments(std::vector<json>& documents, const MigrationCallback& on_result) const;
+
+    /// @brief Threads used per batch (including the calling thread)
+    [[nodiscard]] std::size_t workerCount() const;
+
+private:
+    void migrateOne(json& document, MigrationResult& result) const;
+    MigrationStats run(std::size_t count, const std::function<void(MigrationResult&)>& process,
+                       const MigrationCallback& on_result) const;
+
+    std::shared_ptr<const MigrationPlan> plan_;
+    std::shared_ptr<const SchemaValidator> validator_;
+    std::unique_ptr<concurrency::ThreadPool> pool_;
+};
+
+} // namespace core
+} // namespace configgui
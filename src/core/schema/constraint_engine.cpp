@@ -0,0 +1,289 @@
+// SPDX-License-Identifier: MIT
+// ConstraintEngine - Implementation
+
+#include "constraint_engine.h"
+#include "instance_index.h"
+#include <algorithm>
+#include <memory>
+#include <unordered_set>
+
+namespace configgui {
+namespace core {
+
+namespace
+{
+
+/// @brief Value at a JSON Pointer inside document, or nullptr when it does not exist
+const json* resolvePointer(const json& document, const std::string& pointer)
+{
+    const json* current = &document;
+    std::size_t start = 1;
+    while (current != nullptr && start <= pointer.size())
+    {
+        const std::size_t end = std::min(pointer.find('/', start), pointer.size());
+        std::string token;
+        for (std::size_t i = start; i < end; ++i)
+        {
+            if (pointer[i] == '~' && i + 1 < end)
+            {
+                token.push_back(pointer[i + 1] == '1' ? '/' : '~');
+                ++i;
+            }
+            else
+            {
+                token.push_back(pointer[i]);
+            }
+        }
+        start = end + 1;
+
+        if (current->is_object())
+        {
+            const auto member = current->find(token);
+            current = (member != current->end()) ? &*member : nullptr;
+        }
+        else if (current->is_array() && !token.empty() && token.size() < 10 &&
+                 token.find_first_not_of("0123456789") == std::string::npos &&
+                 std::stoul(token) < current->size())
+        {
+            current = &(*current)[std::stoul(token)];
+        }
+        else
+        {
+            current = nullptr;
+        }
+    }
+    return current;
+}
+
+/// @brief Collect the root members a sub-schema of the root object reads
+/// @return False when the sub-schema depends on the document as a whole (member counts,
+/// additionalProperties, enum/const of the object), so any change must re-run it
+bool collectTriggers(const ValidationPlan& plan, std::size_t index, std::vector<std::string>& triggers,
+                     std::unordered_set<std::size_t>& visited)
+{
+    if (index == ValidationPlan::npos || !visited.insert(index).second)
+    {
+        return true;
+    }
+
+    const PlanNode& node = plan.node(index);
+    if (node.ref != ValidationPlan::npos)
+    {
+        return collectTriggers(plan, node.ref, triggers, visited);
+    }
+    if (node.has_min_properties || node.has_max_properties || node.additional != ValidationPlan::npos ||
+        !node.additional_allowed || node.has_enum || node.has_const)
+    {
+        return false;
+    }
+
+    auto add = [&triggers](const std::string& name) {
+        std::string pointer;
+        ValidationPlan::appendPointerToken(pointer, name);
+        triggers.push_back(std::move(pointer));
+    };
+
+    for (const auto& property : node.properties)
+    {
+        add(property.first);
+    }
+    for (const auto& name : node.required)
+    {
+        add(name);
+    }
+
+    bool known = true;
+    for (const auto& dependency : node.dependencies)
+    {
+        add(dependency.property);
+        for (const auto& name : dependency.required)
+        {
+            add(name);
+        }
+        known = collectTriggers(plan, dependency.schema, triggers, visited) && known;
+    }
+
+    std::vector<std::size_t> subschemas = {node.not_node, node.if_node, node.then_node, node.else_node};
+    subschemas.insert(subschemas.end(), node.all_of.begin(), node.all_of.end());
+    subschemas.insert(subschemas.end(), node.any_of.begin(), node.any_of.end());
+    subschemas.insert(subschemas.end(), node.one_of.begin(), node.one_of.end());
+    for (const std::size_t sub : subschemas)
+    {
+        known = collectTriggers(plan, sub, triggers, visited) && known;
+    }
+    return known;
+}
+
+/// @brief Trigger list for the given sub-schemas, or {""} when it cannot be narrowed down
+std::vector<std::string> triggersFor(const ValidationPlan& plan, std::vector<std::string> triggers,
+                                     const std::vector<std::size_t>& subschemas)
+{
+    std::unordered_set<std::size_t> visited;
+    for (const std::size_t sub : subschemas)
+    {
+        if (!collectTriggers(plan, sub, triggers, visited))
+        {
+            return {""};
+        }
+    }
+    std::sort(triggers.begin(), triggers.end());
+    triggers.erase(std::unique(triggers.begin(), triggers.end()), triggers.end());
+    return triggers;
+}
+
+} // namespace
+
+ConstraintEngine ConstraintEngine::fromPlan(const ValidationPlan& plan)
+{
+    ConstraintEngine engine;
+    const std::size_t root = plan.findNode("");
+    if (root == ValidationPlan::npos)
+    {
+        return engine;
+    }
+    const PlanNode& node = plan.node(root);
+
+    for (const auto& dependency : node.dependencies)
+    {
+        std::vector<std::string> triggers;
+        std::vector<std::string> names = dependency.required;
+        names.push_back(dependency.property);
+        for (const auto& name : names)
+        {
+            std::string pointer;
+            ValidationPlan::appendPointerToken(pointer, name);
+            triggers.push_back(std::move(pointer));
+        }
+
+        CrossFieldRule rule;
+        rule.name = "dependencies/" + dependency.property;
+        rule.triggers = triggersFor(plan, std::move(triggers), {dependency.schema});
+        rule.from_schema = true;
+        const PlanDependency* entry = &dependency;
+        rule.check = [&plan, entry](const json& document, const ValidationErrorHandler& handler) {
+            std::string path;
+            plan.validateDependency(*entry, document, path, &handler);
+        };
+        engine.addRule(std::move(rule));
+    }
+
+    if (node.if_node != ValidationPlan::npos)
+    {
+        CrossFieldRule rule;
+        rule.name = "if";
+        rule.triggers = triggersFor(plan, {}, {node.if_node, node.then_node, node.else_node});
+        rule.from_schema = true;
+        rule.check = [&plan, &node](const json& document, const ValidationErrorHandler& handler) {
+            std::string path;
+            plan.validateConditional(node, document, path, &handler);
+        };
+        engine.addRule(std::move(rule));
+    }
+
+    return engine;
+}
+
+void ConstraintEngine::addRule(CrossFieldRule rule)
+{
+    rules_.push_back(RuleState{std::move(rule), {}});
+    evaluated_ = false;  // The new rule has no cached errors to replay
+}
+
+void ConstraintEngine::addUniqueKey(const std::string& array_pointer, const std::string& key_pointer)
+{
+    // The index keeps its buckets between passes, so steady-state passes do not rehash
+    auto index = std::make_shared<InstanceIndex>();
+
+    CrossFieldRule rule;
+    rule.name = "unique " + array_pointer + key_pointer;
+    rule.triggers = {array_pointer};
+    rule.check = [index, array_pointer, key_pointer](const json& document, const ValidationErrorHandler& handler) {
+        const json* items = resolvePointer(document, array_pointer);
+        if (items == nullptr || !items->is_array())
+        {
+            return;
+        }
+
+        index->reserve(items->size());
+        for (std::size_t i = 0; i < items->size(); ++i)
+        {
+            const json* key = resolvePointer((*items)[i], key_pointer);
+            if (key == nullptr)
+            {
+                continue;
+            }
+            const std::size_t first = index->insert(*key, i);
+            if (first != InstanceIndex::npos)
+            {
+                handler(ValidationError(array_pointer + "/" + std::to_string(i) + key_pointer,
+                                        ValidationErrorType::CustomValidationFailed,
+                                        "Value " + key->dump() + " is already used by item " + std::to_string(first),
+                                        ""));
+            }
+        }
+        index->clear();  // Drop the references into document
+    };
+    addRule(std::move(rule));
+}
+
+ConstraintReport ConstraintEngine::evaluate(const json& document)
+{
+    return run(document, nullptr);
+}
+
+ConstraintReport ConstraintEngine::evaluateChanged(const json& document,
+                                                   const std::vector<std::string>& changed_pointers)
+{
+    return run(document, evaluated_ ? &changed_pointers : nullptr);
+}
+
+bool ConstraintEngine::pointersOverlap(const std::string& a, const std::string& b)
+{
+    const std::string& shorter = a.size() <= b.size() ? a : b;
+    const std::string& longer = a.size() <= b.size() ? b : a;
+    return longer.compare(0, shorter.size(), shorter) == 0 &&
+           (longer.size() == shorter.size() || longer[shorter.size()] == '/');
+}
+
+ConstraintReport ConstraintEngine::run(const json& document, const std::vector<std::string>* changed_pointers)
+{
+    ConstraintReport report;
+    for (auto& state : rules_)
+    {
+        const bool triggered =
+            changed_pointers == nullptr ||
+            std::any_of(state.rule.triggers.begin(), state.rule.triggers.end(), [&](const std::string& trigger) {
+                return std::any_of(changed_pointers->begin(), changed_pointers->end(),
+                                   [&](const std::string& changed) { return pointersOverlap(trigger, changed); });
+            });
+
+        if (triggered)
+        {
+            for (const auto& error : state.errors)
+            {
+                report.changed_locations.push_back(error.field());
+            }
+            state.errors.clear();
+            state.rule.check(document, [&state](const ValidationError& error) { state.errors.push_back(error); });
+            for (const auto& error : state.errors)
+            {
+                report.changed_locations.push_back(error.field());
+            }
+            ++report.rules_run;
+        }
+        report.errors.insert(report.errors.end(), state.errors.begin(), state.errors.end());
+        if (!state.rule.from_schema)
+        {
+            report.custom_errors.insert(report.custom_errors.end(), state.errors.begin(), state.errors.end());
+        }
+    }
+
+    std::sort(report.changed_locations.begin(), report.changed_locations.end());
+    report.changed_locations.erase(std::unique(report.changed_locations.begin(), report.changed_locations.end()),
+                                   report.changed_locations.end());
+    evaluated_ = true;
+    return report;
+}
+
+} // namespace core
+} // namespace configgui
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT
+// ConstraintEngine - Cross-field rules re-evaluated only when their inputs change
+
+#pragma once
+
+#include "validation_error.h"
+#include "validation_plan.h"
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::ordered_json;
+
+namespace configgui {
+namespace core {
+
+/// @brief A constraint that ties several locations of a document together
+struct CrossFieldRule
+{
+    /// @brief Name used in diagnostics
+    std::string name;
+
+    /// @brief JSON Pointers the rule reads; a change at, above or below one re-runs it ("" = any change)
+    std::vector<std::string> triggers;
+
+    /// @brief Checks the whole document, reporting violations (with their JSON Pointer) to handler
+    std::function<void(const json& document, const ValidationErrorHandler& handler)> check;
+
+    /// @brief True for rules derived from the schema, which a full ValidationPlan pass already reports
+    bool from_schema = false;
+};
+
+/// @brief Result of one ConstraintEngine pass
+struct ConstraintReport
+{
+    ValidationErrors errors;                     ///< Every current cross-field error (re-run and replayed)
+    ValidationErrors custom_errors;              ///< The errors of rules not derived from the schema
+    std::vector<std::string> changed_locations;  ///< Pointers of errors the re-run rules raised or cleared
+    std::size_t rules_run = 0;                   ///< Rules actually evaluated by this pass
+};
+
+/// @brief Evaluates cross-field constraints: "dependencies", "if"/"then"/"else" at the
+/// document root, and custom rules such as unique keys across an array of objects
+///
+/// OPTIMIZATION: Each rule declares the locations it reads. After an edit,
+/// evaluateChanged() re-runs only the rules whose triggers overlap the changed
+/// pointers and replays the cached errors of every other rule. Unique-key rules
+/// build one hash index per pass, so checking N items is O(N).
+///
+/// Not thread-safe: a pass updates the per-rule error cache.
+class ConstraintEngine
+{
+public:
+    ConstraintEngine() = default;
+
+    /// @brief Derive rules from the root constraints of a compiled plan
+    /// The plan must outlive the engine.
+    [[nodiscard]] static ConstraintEngine fromPlan(const ValidationPlan& plan);
+
+    /// @brief Register a rule
+    void addRule(CrossFieldRule rule);
+
+    /// @brief Require the value at key_pointer to be unique across the items of an array
+    /// @param array_pointer JSON Pointer of the array (e.g. "/servers")
+    /// @param key_pointer JSON Pointer inside each item (e.g. "/id"); items without the key are skipped
+    void addUniqueKey(const std::string& array_pointer, const std::string& key_pointer);
+
+    /// @brief Number of registered rules
+    [[nodiscard]] std::size_t ruleCount() const { return rules_.size(); }
+
+    /// @brief Run every rule
+    ConstraintReport evaluate(const json& document);
+
+    /// @brief Run only the rules triggered by the changed pointers, replaying cached errors for the rest
+    /// Runs every rule when the engine has not evaluated a document yet.
+    ConstraintReport evaluateChanged(const json& document, const std::vector<std::string>& changed_pointers);
+
+    /// @brief True when one pointer equals, contains or is contained in the other
+    [[nodiscard]] static bool pointersOverlap(const std::string& a, const std::string& b);
+
+private:
+    struct RuleState
+    {
+        CrossFieldRule rule;
+        ValidationErrors errors;  ///< Errors of the last evaluation
+    };
+
+    ConstraintReport run(const json& document, const std::vector<std::string>* changed_pointers);
+
+    std::vector<RuleState> rules_;
+    bool evaluated_ = false;
+};
+
+} // namespace core
+} // namespace configgui
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: MIT
+// IncrementalValidator - Implementation
+
+#include "incremental_validator.h"
+#include <algorithm>
+#include <map>
+
+namespace configgui {
+namespace core {
+
+namespace
+{
+
+/// @brief Top-level field owning an error at pointer ("" for the document itself)
+std::string owningField(const std::string& pointer)
+{
+    if (pointer.size() < 2 || pointer[0] != '/')
+    {
+        return "";
+    }
+    const std::size_t end = std::min(pointer.find('/', 1), pointer.size());
+    std::string field;
+    for (std::size_t i = 1; i < end; ++i)
+    {
+        if (pointer[i] == '~' && i + 1 < end)
+        {
+            field.push_back(pointer[i + 1] == '1' ? '/' : '~');
+            ++i;
+        }
+        else
+        {
+            field.push_back(pointer[i]);
+        }
+    }
+    return field;
+}
+
+} // namespace
+
+IncrementalValidator::IncrementalValidator(const SchemaValidator& validator)
+    : validator_(validator),
+      constraints_(validator.plan() != nullptr ? ConstraintEngine::fromPlan(*validator.plan()) : ConstraintEngine())
+{
+}
+
+bool IncrementalValidator::supportsIncremental() const
+{
+    const ValidationPlan* plan = validator_.plan();
+    if (plan == nullptr || !plan->isComplete())
+    {
+        return false;
+    }
+    const std::size_t root = plan->findNode("");  // Root with $refs followed
+    if (root == ValidationPlan::npos)
+    {
+        return false;
+    }
+    const PlanNode& node = plan->node(root);
+    return !node.reject_all && node.all_of.empty() && node.any_of.empty() && node.one_of.empty() &&
+           node.not_node == ValidationPlan::npos;
+}
+
+bool IncrementalValidator::revalidateDirty(ConfigurationData& config) const
+{
+    return revalidate(config, config.dirty_fields());
+}
+
+bool IncrementalValidator::revalidate(ConfigurationData& config, const std::vector<std::string>& fields) const
+{
+    const json& data = config.data();
+    if (!supportsIncremental() || !data.is_object())
+    {
+        return validateAll(config);
+    }
+
+    const ValidationPlan& plan = *validator_.plan();
+    const std::size_t root_index = plan.findNode("");
+    const PlanNode& root = plan.node(root_index);
+
+    // Cross-field rules first: a field whose rule errors appeared or cleared is refiled too
+    std::vector<std::string> changed;
+    for (const auto& field : fields)
+    {
+        changed.emplace_back();
+        ValidationPlan::appendPointerToken(changed.back(), field);
+    }
+    const ConstraintReport report = constraints_.evaluateChanged(data, changed);
+
+    std::map<std::string, ValidationErrors> rule_errors;
+    for (const auto& error : report.errors)
+    {
+        rule_errors[owningField(error.field())].push_back(error);
+    }
+    std::vector<std::string> affected = fields;
+    for (const auto& location : report.changed_locations)
+    {
+        const std::string owner = owningField(location);
+        if (!owner.empty() && std::find(affected.begin(), affected.end(), owner) == affected.end())
+        {
+            affected.push_back(owner);
+        }
+    }
+
+    for (const auto& field : affected)
+    {
+        ValidationErrors errors;
+        const ValidationErrorHandler collect = [&errors](const ValidationError& error) { errors.push_back(error); };
+
+        const auto value = data.find(field);
+        if (value == data.end())
+        {
+            std::string path;
+            ValidationPlan::appendPointerToken(path, field);
+            // A removed field only matters to the parent's "required" list
+            if (std::find(root.required.begin(), root.required.end(), field) != root.required.end())
+            {
+                errors.emplace_back(path, ValidationErrorType::Required,
+                                    "Required property '" + field + "' is missing", "");
+            }
+        }
+        else
+        {
+            std::string root_path;
+            validator_.validateMember(root_index, field, *value, root_path, &collect);
+        }
+
+        const auto cross_field = rule_errors.find(field);
+        if (cross_field != rule_errors.end())
+        {
+            errors.insert(errors.end(), cross_field->second.begin(), cross_field->second.end());
+        }
+        config.set_errors(field, std::move(errors));
+    }
+
+    // Property counts depend on every field, but are O(1) to recheck
+    ValidationErrors document_errors;
+    if (root.has_min_properties && data.size() < root.min_properties)
+    {
+        document_errors.emplace_back("", ValidationErrorType::MinLengthViolation,
+                                     "Object has fewer than " + std::to_string(root.min_properties) + " properties", "");
+    }
+    if (root.has_max_properties && data.size() > root.max_properties)
+    {
+        document_errors.emplace_back("", ValidationErrorType::MaxLengthViolation,
+                                     "Object has more than " + std::to_string(root.max_properties) + " properties", "");
+    }
+    const auto document_rules = rule_errors.find("");
+    if (document_rules != rule_errors.end())
+    {
+        document_errors.insert(document_errors.end(), document_rules->second.begin(), document_rules->second.end());
+    }
+    config.set_errors("", std::move(document_errors));
+
+    return !config.has_errors();
+}
+
+bool IncrementalValidator::validateAll(ConfigurationData& config) const
+{
+    std::map<std::string, ValidationErrors> by_field;
+    validator_.validate(config.data(), [&by_field](const ValidationError& error) {
+        by_field[owningField(error.field())].push_back(error);
+    });
+
+    // Schema-derived rules were covered by the full pass; the run still refreshes their cache
+    const ConstraintReport report = constraints_.evaluate(config.data());
+    for (const auto& error : report.custom_errors)
+    {
+        by_field[owningField(error.field())].push_back(error);
+    }
+
+    config.clear_all_errors();
+    for (auto& [field, errors] : by_field)
+    {
+        config.set_errors(field, std::move(errors));
+    }
+    return !config.has_errors();
+}
+
+} // namespace core
+} // namespace configgui
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: MIT
+// IncrementalValidator - Revalidates only the fields a user has edited
+
+#pragma once
+
+#include "../data/configuration_data.h"
+#include "constraint_engine.h"
+#include "schema_validator.h"
+#include <string>
+#include <vector>
+
+namespace configgui {
+namespace core {
+
+/// @brief Keeps ConfigurationData field errors current by re-checking edited fields only
+///
+/// OPTIMIZATION: After an edit, only the dirty top-level fields are validated
+/// against their compiled sub-schemas, together with the root constraints that
+/// depend on them ("required", "additionalProperties", property counts).
+/// Errors are written back into the fields' FieldState in place. Schemas whose
+/// root ties fields together (allOf/anyOf/oneOf/not, or keywords the compiled
+/// plan does not implement) fall back to a full pass.
+///
+/// Root "dependencies", "if"/"then"/"else" and custom rules registered with
+/// constraints() are evaluated by a ConstraintEngine, which re-runs only the
+/// rules an edit can affect; fields whose cross-field errors changed are
+/// revalidated with the edited ones.
+///
+/// Errors are filed under the top-level field they belong to; errors about the
+/// document itself are filed under "".
+class IncrementalValidator
+{
+public:
+    /// @brief Create an incremental validator; validator must outlive this object
+    explicit IncrementalValidator(const SchemaValidator& validator);
+
+    /// @brief Revalidate the fields currently marked dirty in config
+    /// @return True if config has no errors afterwards
+    bool revalidateDirty(ConfigurationData& config) const;
+
+    /// @brief Revalidate the given top-level fields of config
+    /// @return True if config has no errors afterwards
+    bool revalidate(ConfigurationData& config, const std::vector<std::string>& fields) const;
+
+    /// @brief Validate the whole document and replace every field's errors
+    /// @return True if config has no errors afterwards
+    bool validateAll(ConfigurationData& config) const;
+
+    /// @brief Check if revalidate() can avoid a full pass for this schema
+    [[nodiscard]] bool supportsIncremental() const;
+
+    /// @brief Cross-field rules checked with the schema; register custom rules here
+    [[nodiscard]] ConstraintEngine& constraints() { return constraints_; }
+
+private:
+    const SchemaValidator& validator_;
+    mutable ConstraintEngine constraints_;  ///< Caches each rule's errors between passes
+};
+
+} // namespace core
+} // namespace configgui
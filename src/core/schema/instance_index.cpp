@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: MIT
+// InstanceIndex - Implementation
+
+#include "instance_index.h"
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+
+namespace configgui {
+namespace core {
+
+namespace
+{
+
+std::size_t combine(std::size_t seed, std::size_t value)
+{
+    return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+}
+
+/// @brief Integral numbers hash as int64 whatever their JSON representation
+bool integralValue(const json& number, std::int64_t& out)
+{
+    if (number.is_number_integer())
+    {
+        if (number.is_number_unsigned() &&
+            number.get<std::uint64_t>() > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+        {
+            return false;
+        }
+        out = number.get<std::int64_t>();
+        return true;
+    }
+    const double value = number.get<double>();
+    if (!std::isfinite(value) || std::fpclassify(value - std::trunc(value)) != FP_ZERO ||
+        std::fabs(value) >= 9.2e18)
+    {
+        return false;
+    }
+    out = static_cast<std::int64_t>(value);
+    return true;
+}
+
+} // namespace
+
+bool instancesEqual(const json& a, const json& b)
+{
+    if (a.is_number() && b.is_number())
+    {
+        return a == b;  // nlohmann compares mixed integer/float numbers by value
+    }
+    if (a.type() != b.type())
+    {
+        return false;
+    }
+    if (a.is_array())
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            if (!instancesEqual(a[i], b[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (a.is_object())
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+        for (auto it = a.begin(); it != a.end(); ++it)
+        {
+            const auto other = b.find(it.key());
+            if (other == b.end() || !instancesEqual(it.value(), *other))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    return a == b;
+}
+
+std::size_t hashInstance(const json& instance)
+{
+    switch (instance.type())
+    {
+        case json::value_t::null:
+            return 0x6e756c6cu;
+        case json::value_t::boolean:
+            return instance.get<bool>() ? 0x74727565u : 0x66616c73u;
+        case json::value_t::number_integer:
+        case json::value_t::number_unsigned:
+        case json::value_t::number_float:
+        {
+            std::int64_t integral = 0;
+            if (integralValue(instance, integral))
+            {
+                return std::hash<std::int64_t>{}(integral);
+            }
+            if (instance.is_number_float())
+            {
+                return std::hash<double>{}(instance.get<double>());
+            }
+            return std::hash<std::uint64_t>{}(instance.get<std::uint64_t>());
+        }
+        case json::value_t::string:
+            return std::hash<std::string>{}(instance.get_ref<const std::string&>());
+        case json::value_t::array:
+        {
+            std::size_t seed = 0x61727261u + instance.size();
+            for (const auto& element : instance)
+            {
+                seed = combine(seed, hashInstance(element));
+            }
+            return seed;
+        }
+        case json::value_t::object:
+        {
+            // Member order does not matter: sum the member hashes
+            std::size_t sum = 0x6f626a65u + instance.size();
+            for (auto it = instance.begin(); it != instance.end(); ++it)
+            {
+                sum += combine(std::hash<std::string>{}(it.key()), hashInstance(it.value()));
+            }
+            return sum;
+        }
+        default:
+            return 0;
+    }
+}
+
+void InstanceIndex::reserve(std::size_t count)
+{
+    entries_.reserve(count);
+}
+
+std::size_t InstanceIndex::insert(const json& instance, std::size_t position)
+{
+    const std::size_t hash = hashInstance(instance);
+    const auto range = entries_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (instancesEqual(*it->second.instance, instance))
+        {
+            return it->second.position;
+        }
+    }
+    entries_.emplace(hash, Entry{&instance, position});
+    return npos;
+}
+
+void InstanceIndex::clear()
+{
+    entries_.clear();
+}
+
+} // namespace core
+} // namespace configgui
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+// InstanceIndex - Hash set of JSON instances compared by JSON Schema equality
+
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::ordered_json;
+
+namespace configgui {
+namespace core {
+
+/// @brief JSON Schema equality: numbers by value (1 == 1.0), objects regardless of member order
+[[nodiscard]] bool instancesEqual(const json& a, const json& b);
+
+/// @brief Hash consistent with instancesEqual()
+[[nodiscard]] std::size_t hashInstance(const json& instance);
+
+/// @brief Finds repeated instances in one pass
+///
+/// OPTIMIZATION: Each instance is hashed once and compared only against
+/// earlier instances with the same hash, so checking N values for
+/// duplicates is O(N) instead of the O(N^2) pairwise comparison.
+/// Instances are referenced, not copied: they must outlive the index
+/// (or the next clear()).
+class InstanceIndex
+{
+public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /// @brief Prepare for count instances
+    void reserve(std::size_t count);
+
+    /// @brief Add an instance
+    /// @param position Caller's identifier for the instance (e.g. array index)
+    /// @return Position of an earlier equal instance, or npos if this one is the first
+    std::size_t insert(const json& instance, std::size_t position);
+
+    /// @brief Forget every instance, keeping the buckets
+    void clear();
+
+private:
+    struct Entry
+    {
+        const json* instance;
+        std::size_t position;
+    };
+
+    std::unordered_multimap<std::size_t, Entry> entries_;  ///< Hash -> instances with that hash
+};
+
+} // namespace core
+} // namespace configgui
@@ -0,0 +1,521 @@
+// SPDX-License-Identifier: MIT
+// RuleParser - Implementation
+
+#include "rule_parser.h"
+#include <charconv>
+#include <cmath>
+#include <unordered_map>
+
+namespace configgui {
+namespace core {
+
+namespace
+{
+
+/// @brief Distinct shorthands kept before the cache starts over
+constexpr std::size_t kMaxCachedRules = 4096;
+
+std::mutex& cacheMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::unordered_map<std::string, std::shared_ptr<const CompiledRule>>& cacheEntries()
+{
+    static std::unordered_map<std::string, std::shared_ptr<const CompiledRule>> entries;
+    return entries;
+}
+
+// MISRA C++ compliant float comparison
+bool isFloatEqual(double a, double b)
+{
+    return std::fabs(a - b) < 1e-9;
+}
+
+bool hasMinimum(const RuleDefinition& rule)
+{
+    return !isFloatEqual(rule.minimum, std::numeric_limits<double>::lowest());
+}
+
+bool hasMaximum(const RuleDefinition& rule)
+{
+    return !isFloatEqual(rule.maximum, std::numeric_limits<double>::max());
+}
+
+std::string_view trim(std::string_view text)
+{
+    const std::size_t first = text.find_first_not_of(" \t");
+    if (first == std::string_view::npos)
+    {
+        return {};
+    }
+    return text.substr(first, text.find_last_not_of(" \t") - first + 1);
+}
+
+bool startsWith(std::string_view text, std::string_view prefix)
+{
+    return text.size() >= prefix.size() && text.compare(0, prefix.size(), prefix) == 0;
+}
+
+/// @brief Parse a range bound; empty and "+" mean unbounded, malformed text is ignored
+void parseBound(std::string_view text, double& out)
+{
+    text = trim(text);
+    if (!text.empty() && text.front() == '+')
+    {
+        text.remove_prefix(1);
+    }
+    if (text.empty())
+    {
+        return;
+    }
+    double value = 0.0;
+    const auto parsed = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (parsed.ec == std::errc())
+    {
+        out = value;
+    }
+}
+
+} // namespace
+
+const json& CompiledRule::schema() const
+{
+    std::call_once(schema_once_, [this] { schema_ = RuleParser::toSchema(rule); });
+    return schema_;
+}
+
+RuleDefinition RuleParser::parseShorthand(const std::string& field_name, const std::string& shorthand)
+{
+    RuleDefinition rule = compile(shorthand)->rule;
+    rule.name = field_name;
+    return rule;
+}
+
+std::shared_ptr<const CompiledRule> RuleParser::compile(const std::string& shorthand)
+{
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex());
+        const auto found = cacheEntries().find(shorthand);
+        if (found != cacheEntries().end())
+        {
+            return found->second;
+        }
+    }
+
+    auto compiled = std::make_shared<CompiledRule>();
+    compiled->rule = parse(shorthand);
+
+    std::lock_guard<std::mutex> lock(cacheMutex());
+    auto& entries = cacheEntries();
+    if (entries.size() >= kMaxCachedRules)
+    {
+        entries.clear();  // Rule sets are small; only generated shorthands can get here
+    }
+    return entries.emplace(shorthand, std::move(compiled)).first->second;
+}
+
+std::size_t RuleParser::cachedRuleCount()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex());
+    return cacheEntries().size();
+}
+
+RuleDefinition RuleParser::parse(std::string_view shorthand)
+{
+    RuleDefinition rule;
+
+    // The type runs up to the first delimiter
+    std::size_t pos = shorthand.find_first_of("[{?");
+    rule.type = std::string(shorthand.substr(0, pos));
+
+    bool optional = false;
+    bool has_required = false;  // {required}/{optional} override the '?' marker
+    while (pos < shorthand.size())
+    {
+        const char c = shorthand[pos];
+        if (c == '?')
+        {
+            optional = true;
+            ++pos;
+        }
+        else if (c == '[')
+        {
+            const std::size_t close = shorthand.find(']', pos);
+            if (close == std::string_view::npos)
+            {
+                ++pos;
+                continue;
+            }
+            if (rule.type == "integer" || rule.type == "float")
+            {
+                parseRange(shorthand.substr(pos + 1, close - pos - 1), rule.minimum, rule.maximum);
+            }
+            pos = close + 1;
+        }
+        else if (c == '{')
+        {
+            const std::size_t close = shorthand.rfind('}');
+            if (close == std::string_view::npos || close < pos)
+            {
+                ++pos;
+                continue;
+            }
+            parseModifiers(shorthand.substr(pos + 1, close - pos - 1), rule, has_required);
+            pos = close + 1;
+        }
+        else
+        {
+            ++pos;
+        }
+    }
+
+    if (!has_required)
+    {
+        rule.required = !optional;
+    }
+    rule.allow_empty = !rule.required;
+    return rule;
+}
+
+void RuleParser::parseRange(std::string_view range, double& min, double& max)
+{
+    const std::size_t comma = range.find(',');
+    if (comma == std::string_view::npos)
+    {
+        return;
+    }
+    parseBound(range.substr(0, comma), min);
+    parseBound(range.substr(comma + 1), max);
+}
+
+void RuleParser::parseModifiers(std::string_view modifiers, RuleDefinition& rule, bool& has_required)
+{
+    std::size_t pos = 0;
+    while (pos <= modifiers.size())
+    {
+        const std::size_t comma = std::min(modifiers.find(',', pos), modifiers.size());
+        const std::string_view modifier = trim(modifiers.substr(pos, comma - pos));
+
+        if (startsWith(modifier, "pattern:"))
+        {
+            // Always last: the regex may itself contain ','
+            const std::string_view rest = trim(modifiers.substr(pos));
+            rule.pattern = std::string(rest.substr(8));
+            return;
+        }
+        if (modifier == "required")
+        {
+            rule.required = true;
+            has_required = true;
+        }
+        else if (modifier == "optional")
+        {
+            rule.required = false;
+            has_required = true;
+        }
+        else if (startsWith(modifier, "enum:"))
+        {
+            std::string_view values = modifier.substr(5);
+            while (!values.empty())
+            {
+                const std::size_t bar = std::min(values.find('|'), values.size());
+                const std::string_view value = trim(values.substr(0, bar));
+                if (!value.empty())
+                {
+                    rule.enum_values.emplace_back(value);
+                }
+                values.remove_prefix(std::min(bar + 1, values.size()));
+            }
+        }
+        pos = comma + 1;
+    }
+}
+
+std::string RuleParser::toShorthand(const RuleDefinition& rule)
+{
+    std::string result = rule.type;
+
+    // Add range constraints for numeric types
+    if ((rule.type == "integer" || rule.type == "float") && (hasMinimum(rule) || hasMaximum(rule)))
+    {
+        result += "[";
+        if (hasMinimum(rule))
+        {
+            result += std::to_string(static_cast<int>(rule.minimum));
+        }
+        result += ",";
+        if (hasMaximum(rule))
+        {
+            result += std::to_string(static_cast<int>(rule.maximum));
+        }
+        result += "]";
+    }
+
+    // Add modifiers if needed
+    const bool has_enum = !rule.enum_values.empty();
+    const bool has_pattern = !rule.pattern.empty();
+    if (has_enum || has_pattern || !rule.required)
+    {
+        result += "{";
+        result += rule.required ? "required" : "optional";
+
+        if (has_enum)
+        {
+            result += ",enum:";
+            for (std::size_t i = 0; i < rule.enum_values.size(); ++i)
+            {
+                if (i > 0)
+                {
+                    result += "|";
+                }
+                result += rule.enum_values[i];
+            }
+        }
+
+        if (has_pattern)
+        {
+            result += ",pattern:" + rule.pattern;
+        }
+
+        result += "}";
+    }
+
+    return result;
+}
+
+json RuleParser::toSchema(const RuleDefinition& rule)
+{
+    json schema = json::object();
+    const bool is_string = rule.type == "string";
+    const bool is_numeric = rule.type == "integer" || rule.type == "float";
+
+    if (is_string || is_numeric || rule.type == "boolean")
+    {
+        schema["type"] = rule.type == "float" ? "number" : rule.type;
+    }
+    if (is_numeric && hasMinimum(rule))
+    {
+        schema["minimum"] = rule.minimum;
+    }
+    if (is_numeric && hasMaximum(rule))
+    {
+        schema["maximum"] = rule.maximum;
+    }
+    if (is_string && !rule.allow_empty)
+    {
+        schema["minLength"] = 1;
+    }
+    if (!is_numeric && !rule.enum_values.empty())
+    {
+        schema["enum"] = rule.enum_values;
+    }
+    if (!is_numeric && !rule.pattern.empty())
+    {
+        schema["pattern"] = rule.pattern;
+    }
+    return schema;
+}
+
+json RuleParser::rulesToSchema(const json& rules_obj)
+{
+    json schema = {{"type", "object"}, {"properties", json::object()}, {"required", json::array()}};
+    if (!rules_obj.is_object())
+    {
+        return schema;
+    }
+
+    for (auto it = rules_obj.begin(); it != rules_obj.end(); ++it)
+    {
+        bool required = true;
+        if (it.value().is_string())
+        {
+            const auto compiled = compile(it.value().get_ref<const std::string&>());
+            schema["properties"][it.key()] = compiled->schema();
+            required = compiled->rule.required;
+        }
+        else if (it.value().is_object())
+        {
+            const RuleDefinition rule = parseInline(it.key(), it.value());
+            schema["properties"][it.key()] = toSchema(rule);
+            required = rule.required;
+        }
+        else
+        {
+            continue;
+        }
+
+        if (required)
+        {
+            schema["required"].push_back(it.key());
+        }
+    }
+    return schema;
+}
+
+RuleDefinition RuleParser::parseInline(const std::string& field_name, const json& inline_rule)
+{
+    // Inline rule object format: { "type": "string", "allowEmpty": false, "enum": [...] }
+    RuleDefinition rule;
+    rule.name = field_name;
+
+    const auto type = inline_rule.find("type");
+    if (type != inline_rule.end() && type->is_string())
+    {
+        rule.type = type->get<std::string>();
+    }
+    const auto allow_empty = inline_rule.find("allowEmpty");
+    if (allow_empty != inline_rule.end() && allow_empty->is_boolean())
+    {
+        rule.allow_empty = allow_empty->get<bool>();
+    }
+    const auto pattern = inline_rule.find("pattern");
+    if (pattern != inline_rule.end() && pattern->is_string())
+    {
+        rule.pattern = pattern->get<std::string>();
+    }
+    const auto minimum = inline_rule.find("minimum");
+    if (minimum != inline_rule.end() && minimum->is_number())
+    {
+        rule.minimum = minimum->get<double>();
+    }
+    const auto maximum = inline_rule.find("maximum");
+    if (maximum != inline_rule.end() && maximum->is_number())
+    {
+        rule.maximum = maximum->get<double>();
+    }
+    const auto enums = inline_rule.find("enum");
+    if (enums != inline_rule.end() && enums->is_array())
+    {
+        for (const auto& value : *enums)
+        {
+            if (value.is_string())
+            {
+                rule.enum_values.push_back(value.get<std::string>());
+            }
+        }
+    }
+    return rule;
+}
+
+json RuleParser::convertOldFormatToNew(const json& old_rules)
+{
+    json new_format = json::object();
+
+    if (!old_rules.is_array())
+    {
+        return new_format;
+    }
+
+    for (const auto& rule_obj : old_rules)
+    {
+        if (!rule_obj.is_object() || !rule_obj.contains("name"))
+        {
+            continue;
+        }
+
+        const std::string field_name = rule_obj["name"].get<std::string>();
+
+        RuleDefinition rule;
+        rule.name = field_name;
+
+        if (rule_obj.contains("type"))
+        {
+            rule.type = rule_obj["type"].get<std::string>();
+        }
+        if (rule_obj.contains("minimum"))
+        {
+            rule.minimum = rule_obj["minimum"].get<double>();
+        }
+        if (rule_obj.contains("maximum"))
+        {
+            rule.maximum = rule_obj["maximum"].get<double>();
+        }
+
+        // allowEmpty is the inverse of required
+        if (rule_obj.contains("allowEmpty"))
+        {
+            rule.allow_empty = rule_obj["allowEmpty"].get<bool>();
+            rule.required = !rule.allow_empty;
+        }
+
+        if (rule_obj.contains("enum") && rule_obj["enum"].is_array())
+        {
+            for (const auto& enum_item : rule_obj["enum"])
+            {
+                if (enum_item.is_string())
+                {
+                    rule.enum_values.push_back(enum_item.get<std::string>());
+                }
+            }
+        }
+
+        if (rule_obj.contains("pattern"))
+        {
+            rule.pattern = rule_obj["pattern"].get<std::string>();
+        }
+
+        new_format[field_name] = toShorthand(rule);
+    }
+
+    return new_format;
+}
+
+json RuleParser::convertNewFormatToOld(const json& rules_obj)
+{
+    json old_format = json::array();
+
+    if (!rules_obj.is_object())
+    {
+        return old_format;
+    }
+
+    for (auto it = rules_obj.begin(); it != rules_obj.end(); ++it)
+    {
+        RuleDefinition rule;
+        if (it.value().is_string())
+        {
+            rule = parseShorthand(it.key(), it.value().get<std::string>());
+        }
+        else if (it.value().is_object())
+        {
+            rule = parseInline(it.key(), it.value());
+        }
+        else
+        {
+            continue;  // Unsupported format
+        }
+
+        json old_rule = json::object();
+        old_rule["name"] = rule.name;
+        old_rule["type"] = rule.type;
+
+        if (hasMinimum(rule))
+        {
+            old_rule["minimum"] = rule.minimum;
+        }
+        if (hasMaximum(rule))
+        {
+            old_rule["maximum"] = rule.maximum;
+        }
+
+        old_rule["allowEmpty"] = rule.allow_empty;
+
+        if (!rule.enum_values.empty())
+        {
+            old_rule["enum"] = rule.enum_values;
+        }
+        if (!rule.pattern.empty())
+        {
+            old_rule["pattern"] = rule.pattern;
+        }
+
+        old_format.push_back(old_rule);
+    }
+
+    return old_format;
+}
+
+} // namespace core
+} // namespace configgui
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: MIT
+// RuleParser - Shorthand rule format ("integer[0,5]?", "string{required,enum:A|B}")
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::ordered_json;
+
+namespace configgui {
+namespace core {
+
+/// @brief A parsed rule in structured format
+struct RuleDefinition
+{
+    std::string name;         ///< Field name
+    std::string type;         ///< "string", "integer", "float", "boolean"
+    bool required = true;     ///< False if "?" or {optional}
+    bool allow_empty = true;  ///< False if {required}
+
+    double minimum = std::numeric_limits<double>::lowest();
+    double maximum = std::numeric_limits<double>::max();
+    std::vector<std::string> enum_values;
+    std::string pattern;  ///< Regex pattern
+};
+
+/// @brief A shorthand rule parsed once, with the JSON Schema it compiles to
+struct CompiledRule
+{
+    RuleDefinition rule;  ///< Parsed rule (name is empty: shared by every field using the shorthand)
+
+    /// @brief Sub-schema for one field (see RuleParser::toSchema()), built on first use
+    [[nodiscard]] const json& schema() const;
+
+private:
+    mutable std::once_flag schema_once_;
+    mutable json schema_;
+};
+
+/// @brief Parses the shorthand rule format to and from structured rules and JSON Schema
+///
+/// Grammar: type ["[" min "," max "]"] ["?"] ["{" modifier ("," modifier)* "}"], where a
+/// modifier is "required", "optional", "enum:A|B|C" or "pattern:<regex>". The pattern
+/// modifier runs to the closing brace, so the regex may contain ',' and '}'.
+///
+/// OPTIMIZATION: Shorthands are tokenized in one pass over a string_view, and each
+/// distinct shorthand is parsed once per process; forms that reload rules, and the
+/// rule editor's preview, are then answered from the cache.
+class RuleParser
+{
+public:
+    /// @brief Parse a shorthand string into a rule for field_name
+    [[nodiscard]] static RuleDefinition parseShorthand(const std::string& field_name, const std::string& shorthand);
+
+    /// @brief Parsed rule and JSON Schema for a shorthand, cached by shorthand string (thread-safe)
+    [[nodiscard]] static std::shared_ptr<const CompiledRule> compile(const std::string& shorthand);
+
+    /// @brief Convert a rule back to shorthand format
+    [[nodiscard]] static std::string toShorthand(const RuleDefinition& rule);
+
+    /// @brief JSON Schema for one field's value ("float" maps to "number";
+    /// a string that may not be empty gets minLength 1)
+    [[nodiscard]] static json toSchema(const RuleDefinition& rule);
+
+    /// @brief Object schema for a rules object ({field: shorthand or inline rule object})
+    /// The result uses only keywords ValidationPlan implements, so it compiles completely.
+    [[nodiscard]] static json rulesToSchema(const json& rules_obj);
+
+    /// @brief Convert the old verbose format (array of objects) to {field_name: shorthand}
+    [[nodiscard]] static json convertOldFormatToNew(const json& old_rules);
+
+    /// @brief Convert {field_name: shorthand or inline rule} back to the old verbose format
+    [[nodiscard]] static json convertNewFormatToOld(const json& rules_obj);
+
+    /// @brief Number of shorthands currently cached
+    [[nodiscard]] static std::size_t cachedRuleCount();
+
+private:
+    static RuleDefinition parse(std::string_view shorthand);
+    static RuleDefinition parseInline(const std::string& field_name, const json& inline_rule);
+    static void parseRange(std::string_view range, double& min, double& max);
+    static void parseModifiers(std::string_view modifiers, RuleDefinition& rule, bool& has_required);
+};
+
+} // namespace core
+} // namespace configgui
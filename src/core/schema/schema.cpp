@@ -2,56 +2,197 @@
 // JSONSchema - Implementation
 
 #include "schema.h"
+#include <algorithm>
+#include <functional>
 #include <vector>
 
 namespace configgui {
 namespace core {
 
-JSONSchema::JSONSchema(const json& schema_json) : schema_(schema_json)
+namespace
+{
+
+/// @brief Upper bound on chained local $refs (a -> b -> c ...) followed per node
+constexpr int kMaxRefHops = 32;
+
+bool isArrayIndex(std::string_view token)
+{
+    return !token.empty() && std::all_of(token.begin(), token.end(), [](char c) { return c >= '0' && c <= '9'; });
+}
+
+void appendPointerToken(std::string& pointer, const std::string& token)
+{
+    pointer.push_back('/');
+    for (const char c : token)
+    {
+        if (c == '~')
+        {
+            pointer.append("~0");
+        }
+        else if (c == '/')
+        {
+            pointer.append("~1");
+        }
+        else
+        {
+            pointer.push_back(c);
+        }
+    }
+}
+
+/// @brief Follow document-local "$ref"s from schema to the schema they name
+const json& followLocalRefs(const json& root, const json& schema)
+{
+    const json* current = &schema;
+    for (int hop = 0; hop < kMaxRefHops && current->is_object(); ++hop)
+    {
+        const auto ref = current->find("$ref");
+        if (ref == current->end() || !ref->is_string())
+        {
+            break;
+        }
+        const std::string& target = ref->get_ref<const std::string&>();
+        if (target.empty() || target[0] != '#')
+        {
+            break;
+        }
+        try
+        {
+            const json::json_pointer pointer(target.substr(1));
+            if (!root.contains(pointer))
+            {
+                break;
+            }
+            current = &root.at(pointer);
+        }
+        catch (const json::exception& /*e*/)
+        {
+            break;
+        }
+    }
+    return *current;
+}
+
+} // namespace
+
+JSONSchema::JSONSchema(const json& schema_json) : schema_(std::make_shared<const json>(schema_json))
 {
     buildIndex();
 }
 
 JSONSchema::JSONSchema(const json& schema_json, std::shared_ptr<SchemaValidator> validator)
-    : schema_(schema_json)
+    : schema_(std::make_shared<const json>(schema_json))
     , validator_(std::move(validator))
 {
     buildIndex();
 }
 
+const json& JSONSchema::raw_schema() const
+{
+    static const json empty_schema;
+    return schema_ ? *schema_ : empty_schema;
+}
+
 void JSONSchema::buildIndex()
 {
-    // OPTIMIZATION: Pre-build index of property names for O(1) lookups
-    property_index_.clear();
-    
-    if (schema_.contains("properties"))
+    // OPTIMIZATION: Walk the schema once and record every properties/items
+    // sub-schema under its JSON Pointer and dotted path
+    auto index = std::make_shared<PathIndex>();
+    const json& root = raw_schema();
+
+    std::vector<const json*> on_path;  // Guards against recursive $refs
+    std::string pointer;
+    std::string dotted;
+
+    auto add = [&index](std::unordered_map<std::string_view, const json*>& table, const std::string& key,
+                        const json* schema) {
+        const std::string& stored = index->key_storage.emplace_back(key);
+        table.emplace(std::string_view(stored), schema);
+    };
+
+    std::function<void(const json&)> visit = [&](const json& node) {
+        const json& schema = followLocalRefs(root, node);
+        add(index->by_pointer, pointer, &schema);
+        add(index->by_dotted_path, dotted, &schema);
+
+        if (!schema.is_object() || std::find(on_path.begin(), on_path.end(), &schema) != on_path.end())
+        {
+            return;
+        }
+        on_path.push_back(&schema);
+
+        const std::size_t pointer_length = pointer.size();
+        const std::size_t dotted_length = dotted.size();
+        auto descend = [&](const std::string& pointer_token, const std::string& dotted_token, const json& child) {
+            appendPointerToken(pointer, pointer_token);
+            if (!dotted.empty())
+            {
+                dotted.push_back('.');
+            }
+            dotted.append(dotted_token);
+            visit(child);
+            pointer.resize(pointer_length);
+            dotted.resize(dotted_length);
+        };
+
+        const auto properties = schema.find("properties");
+        if (properties != schema.end() && properties->is_object())
+        {
+            for (auto it = properties->begin(); it != properties->end(); ++it)
+            {
+                descend(it.key(), it.key(), it.value());
+            }
+        }
+
+        const auto items = schema.find("items");
+        if (items != schema.end() && items->is_object())
+        {
+            const std::string token(kArrayItemToken);
+            descend(token, token, *items);
+        }
+        else if (items != schema.end() && items->is_array())
+        {
+            for (std::size_t i = 0; i < items->size(); ++i)
+            {
+                descend(std::to_string(i), std::to_string(i), (*items)[i]);
+            }
+        }
+
+        on_path.pop_back();
+    };
+
+    if (schema_)
     {
-        const auto& props = schema_["properties"];
-        if (props.is_object())
+        visit(root);
+
+        const json& resolved_root = followLocalRefs(root, root);
+        const auto properties = resolved_root.is_object() ? resolved_root.find("properties") : resolved_root.end();
+        if (properties != resolved_root.end() && properties->is_object())
         {
-            // Iterate once and store all property names in hash set
-            for (auto it = props.begin(); it != props.end(); ++it)
+            for (auto it = properties->begin(); it != properties->end(); ++it)
             {
-                property_index_.insert(it.key());
+                add(index->top_level, it.key(), &it.value());
             }
         }
     }
+
+    index_ = std::move(index);
 }
 
 std::string JSONSchema::title() const
 {
-    if (schema_.contains("title"))
+    if (raw_schema().contains("title"))
     {
-        return schema_["title"].get<std::string>();
+        return raw_schema()["title"].get<std::string>();
     }
     return "";
 }
 
 std::string JSONSchema::description() const
 {
-    if (schema_.contains("description"))
+    if (raw_schema().contains("description"))
     {
-        return schema_["description"].get<std::string>();
+        return raw_schema()["description"].get<std::string>();
     }
     return "";
 }
@@ -59,9 +200,9 @@ std::string JSONSchema::description() const
 std::vector<std::string> JSONSchema::required_fields() const
 {
     std::vector<std::string> required;
-    if (schema_.contains("required"))
+    if (raw_schema().contains("required"))
     {
-        const auto& req = schema_["required"];
+        const auto& req = raw_schema()["required"];
         if (req.is_array())
         {
             for (const auto& field : req)
@@ -79,33 +220,110 @@ std::vector<std::string> JSONSchema::required_fields() const
 const json& JSONSchema::properties() const
 {
     static const json empty_object = json::object();
-    if (schema_.contains("properties"))
+    if (raw_schema().contains("properties"))
     {
-        return schema_["properties"];
+        return raw_schema()["properties"];
     }
     return empty_object;
 }
 
 bool JSONSchema::hasProperty(const std::string& name) const
 {
-    // OPTIMIZATION: O(1) lookup using hash set index
+    // OPTIMIZATION: O(1) lookup using hash map index
     // Instead of: properties().contains(name) which requires JSON traversal
-    return property_index_.find(name) != property_index_.end();
+    return getProperty(name) != nullptr;
 }
 
 const json* JSONSchema::getProperty(const std::string& name) const
 {
-    // OPTIMIZATION: Only access JSON if property exists in index
-    // Prevents expensive JSON operations for non-existent properties
-    if (hasProperty(name) && schema_.contains("properties"))
+    // OPTIMIZATION: The index stores the property itself, so no JSON access is needed
+    if (!index_)
+    {
+        return nullptr;
+    }
+    const auto it = index_->top_level.find(name);
+    return (it != index_->top_level.end()) ? it->second : nullptr;
+}
+
+const json* JSONSchema::findSchema(std::string_view path) const
+{
+    return (!path.empty() && path[0] == '/') ? findByPointer(path) : findByDottedPath(path);
+}
+
+const json* JSONSchema::findByPointer(std::string_view pointer) const
+{
+    return index_ ? findIndexed(index_->by_pointer, pointer, '/') : nullptr;
+}
+
+const json* JSONSchema::findByDottedPath(std::string_view dotted_path) const
+{
+    return index_ ? findIndexed(index_->by_dotted_path, dotted_path, '.') : nullptr;
+}
+
+std::size_t JSONSchema::indexedPathCount() const
+{
+    return index_ ? index_->by_pointer.size() : 0;
+}
+
+void JSONSchema::forEachIndexedPath(
+    const std::function<void(std::string_view pointer, const json& schema)>& visitor) const
+{
+    if (!index_)
+    {
+        return;
+    }
+    for (const auto& [pointer, schema] : index_->by_pointer)
+    {
+        visitor(pointer, *schema);
+    }
+}
+
+const json* JSONSchema::findIndexed(const std::unordered_map<std::string_view, const json*>& table,
+                                    std::string_view path, char separator)
+{
+    const auto exact = table.find(path);
+    if (exact != table.end())
+    {
+        return exact->second;
+    }
+
+    // Not indexed verbatim: resolve token by token, mapping array indices
+    // onto the "items" schema
+    const bool pointer_syntax = (separator == '/');
+    if (path.empty() || (pointer_syntax && path[0] != '/'))
+    {
+        return nullptr;
+    }
+
+    std::string key;
+    const json* found = nullptr;
+    std::size_t start = pointer_syntax ? 1 : 0;
+    while (start <= path.size())
     {
-        const auto& props = schema_["properties"];
-        if (props.contains(name))
+        const std::size_t end = std::min(path.find(separator, start), path.size());
+        const std::string_view token = path.substr(start, end - start);
+        if (pointer_syntax || !key.empty())
+        {
+            key.push_back(separator);
+        }
+        const std::size_t prefix_length = key.size();
+
+        key.append(token);
+        auto it = table.find(key);
+        if (it == table.end() && isArrayIndex(token))
+        {
+            key.resize(prefix_length);
+            key.append(kArrayItemToken);
+            it = table.find(key);
+        }
+        if (it == table.end())
         {
-            return &props[name];
+            return nullptr;
         }
+        found = it->second;
+        start = end + 1;
     }
-    return nullptr;
+    return found;
 }
 
 } // namespace core
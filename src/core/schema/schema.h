@@ -3,11 +3,15 @@
 
 #pragma once
 
+#include <cstddef>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <string>
+#include <string_view>
 #include <unordered_map>
-#include <unordered_set>
+#include <vector>
 
 using json = nlohmann::ordered_json;
 
@@ -19,8 +23,10 @@ class SchemaValidator;
 
 /// @brief Represents a JSON Schema (Draft 7) with validation support
 /// 
-/// OPTIMIZATION: Builds field index on schema load for O(1) lookups
-/// instead of O(n) iteration through properties.
+/// OPTIMIZATION: Builds a recursive path index on schema load, so nested
+/// lookups ("Server.Http.Port" or "/Server/Http/Port") are one hash probe
+/// instead of O(n) ordered_json scans per level. The schema and its index are
+/// immutable and shared between copies, so copying a JSONSchema is cheap.
 class JSONSchema
 {
 public:
@@ -34,7 +40,7 @@ public:
     JSONSchema(const json& schema_json, std::shared_ptr<SchemaValidator> validator);
 
     /// @brief Get the underlying JSON schema
-    [[nodiscard]] const json& raw_schema() const { return schema_; }
+    [[nodiscard]] const json& raw_schema() const;
 
     /// @brief Get the title of the schema
     [[nodiscard]] std::string title() const;
@@ -60,25 +66,60 @@ public:
     /// @return Pointer to property or nullptr if not found
     [[nodiscard]] const json* getProperty(const std::string& name) const;
 
+    /// @brief Reference token used for "every array element" in indexed paths
+    static constexpr std::string_view kArrayItemToken = "*";
+
+    /// @brief Find a sub-schema by dotted path or JSON Pointer
+    /// A leading '/' selects JSON Pointer syntax. Array elements match the
+    /// "items" schema, written as "*" or any index ("servers.0.host").
+    /// Local "$ref"s are followed while the index is built.
+    /// @return Pointer into raw_schema(), or nullptr if the path is not described
+    [[nodiscard]] const json* findSchema(std::string_view path) const;
+
+    /// @brief Find a sub-schema by JSON Pointer ("" = root)
+    [[nodiscard]] const json* findByPointer(std::string_view pointer) const;
+
+    /// @brief Find a sub-schema by dotted path ("" = root)
+    [[nodiscard]] const json* findByDottedPath(std::string_view dotted_path) const;
+
+    /// @brief Number of sub-schemas reachable through properties/items
+    [[nodiscard]] std::size_t indexedPathCount() const;
+
+    /// @brief Visit every indexed sub-schema with its JSON Pointer (unordered)
+    void forEachIndexedPath(const std::function<void(std::string_view pointer, const json& schema)>& visitor) const;
+
     /// @brief Equality operator
-    bool operator==(const JSONSchema& other) const { return schema_ == other.schema_; }
+    bool operator==(const JSONSchema& other) const { return raw_schema() == other.raw_schema(); }
 
     /// @brief Inequality operator
-    bool operator!=(const JSONSchema& other) const { return schema_ != other.schema_; }
+    bool operator!=(const JSONSchema& other) const { return raw_schema() != other.raw_schema(); }
 
     /// @brief Get the validator (for internal use)
     [[nodiscard]] std::shared_ptr<SchemaValidator> validator() const { return validator_; }
 
 private:
+    /// @brief Path tables built once per schema
+    /// Keys are views into key_storage, so lookups take string_view without allocating
+    struct PathIndex
+    {
+        std::deque<std::string> key_storage;
+        std::unordered_map<std::string_view, const json*> by_pointer;
+        std::unordered_map<std::string_view, const json*> by_dotted_path;
+        std::unordered_map<std::string_view, const json*> top_level;  ///< Root "properties" members
+    };
+
     /// @brief Build index for fast property lookups
     /// Called automatically in constructors
     void buildIndex();
 
-    json schema_;
+    static const json* findIndexed(const std::unordered_map<std::string_view, const json*>& table,
+                                   std::string_view path, char separator);
+
+    std::shared_ptr<const json> schema_;
     std::shared_ptr<SchemaValidator> validator_;
     
-    // OPTIMIZATION: Hash set index for O(1) property existence checks
-    std::unordered_set<std::string> property_index_;
+    // OPTIMIZATION: Shared, immutable path index for O(1) nested lookups
+    std::shared_ptr<const PathIndex> index_;
 };
 
 } // namespace core
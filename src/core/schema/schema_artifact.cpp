@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: MIT
+// SchemaArtifact - Implementation
+
+#include "schema_artifact.h"
+#include "compiled_schema_cache.h"
+#include "schema.h"
+#include "schema_bundle.h"
+#include "schema_validator.h"
+#include "../io/content_hash.h"
+#include "../io/durable_file.h"
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace configgui {
+namespace core {
+
+namespace
+{
+
+using ArtifactResult = Result<SchemaArtifact, std::string>;
+
+bool readBytes(const std::string& file_path, std::string& bytes)
+{
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file.is_open())
+    {
+        return false;
+    }
+    bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return !file.bad();
+}
+
+} // namespace
+
+std::string SchemaArtifact::pathFor(const std::string& schema_path)
+{
+    return schema_path + ".compiled";
+}
+
+Result<SchemaArtifact, std::string> SchemaArtifact::read(const std::string& artifact_path, std::uint64_t fingerprint)
+{
+    std::string bytes;
+    if (!readBytes(artifact_path, bytes))
+    {
+        return ArtifactResult("No artifact: " + artifact_path);
+    }
+
+    try
+    {
+        json stored = json::from_cbor(bytes);
+        if (!stored.is_object() || stored.value("format", std::uint64_t{0}) != kFormatVersion)
+        {
+            return ArtifactResult(std::string("Artifact format mismatch"));
+        }
+        if (stored.value("fingerprint", std::uint64_t{0}) != fingerprint)
+        {
+            return ArtifactResult(std::string("Artifact is stale"));
+        }
+
+        SchemaArtifact artifact;
+        artifact.source = std::move(stored.at("source"));
+        artifact.schema_valid = stored.at("schema_valid").get<bool>();
+
+        json& bundle = stored.at("bundle");
+        if (bundle.is_object())
+        {
+            // Files pulled in through $ref may have changed since the artifact was written
+            std::vector<std::string> external_documents;
+            std::string content;
+            for (const auto& dependency : bundle.at("external"))
+            {
+                const std::string path = dependency.at("path").get<std::string>();
+                if (!readBytes(path, content) ||
+                    io::content_hash(content) != dependency.at("hash").get<std::uint64_t>())
+                {
+                    return ArtifactResult("Artifact is stale: " + path + " changed");
+                }
+                external_documents.push_back(path);
+            }
+
+            std::shared_ptr<const SchemaBundle> rebuilt;
+            const std::string view = bundle.at("view").get<std::string>();
+            const std::size_t ref_count = bundle.at("ref_count").get<std::size_t>();
+            if (view == "stored")
+            {
+                rebuilt = std::make_shared<const SchemaBundle>(SchemaBundle::fromDereferenced(
+                    std::move(bundle.at("dereferenced")), std::move(external_documents), ref_count));
+            }
+            else if (view == "source")
+            {
+                rebuilt = std::make_shared<const SchemaBundle>(
+                    SchemaBundle::fromDereferenced(artifact.source, std::move(external_documents), ref_count));
+            }
+            else
+            {
+                auto local = SchemaBundle::fromSchema(artifact.source);
+                if (local.is_failure())
+                {
+                    return ArtifactResult("Artifact is stale: " + local.error());
+                }
+                rebuilt = std::make_shared<const SchemaBundle>(std::move(local).value());
+            }
+            artifact.path_count = bundle.at("path_count").get<std::size_t>();
+            if (rebuilt->pathCount() != artifact.path_count)
+            {
+                return ArtifactResult(std::string("Artifact path index does not match its schema"));
+            }
+            artifact.bundle = std::move(rebuilt);
+        }
+        return ArtifactResult(std::move(artifact));
+    }
+    catch (const json::exception& e)
+    {
+        return ArtifactResult("Damaged artifact: " + std::string(e.what()));
+    }
+}
+
+Result<std::size_t, std::string> SchemaArtifact::write(const std::string& artifact_path, std::uint64_t fingerprint,
+                                                       const CompiledSchema& compiled)
+{
+    using WriteResult = Result<std::size_t, std::string>;
+    if (!compiled.schema || !compiled.validator)
+    {
+        return WriteResult(std::string("Nothing to write"));
+    }
+
+    json stored = {
+        {"format", kFormatVersion},
+        {"fingerprint", fingerprint},
+        {"schema_valid", compiled.validator->validateSchemaFormat()},
+        {"source", compiled.schema->raw_schema()},
+        {"bundle", nullptr}
+    };
+    if (compiled.bundle)
+    {
+        json external = json::array();
+        std::string content;
+        for (const auto& path : compiled.bundle->externalDocuments())
+        {
+            if (!readBytes(path, content))
+            {
+                return WriteResult("Cannot read referenced schema: " + path);
+            }
+            external.push_back({{"path", path}, {"hash", io::content_hash(content)}});
+        }
+        // Decoding a second tree costs about as much as resolving document-local
+        // references in memory, so the view is only stored when it inlines other files
+        const json& dereferenced = compiled.bundle->dereferenced();
+        std::string view = "rebuild";
+        if (dereferenced == compiled.schema->raw_schema())
+        {
+            view = "source";
+        }
+        else if (!compiled.bundle->externalDocuments().empty())
+        {
+            view = "stored";
+        }
+        stored["bundle"] = {
+            {"view", view},
+            {"dereferenced", view == "stored" ? dereferenced : json()},
+            {"ref_count", compiled.bundle->refCount()},
+            {"path_count", compiled.bundle->pathCount()},
+            {"external", std::move(external)}
+        };
+    }
+
+    std::string bytes;
+    json::to_cbor(stored, bytes);
+    // Unique temp + rename: concurrent compiles of one schema never share a temp file
+    const std::string error = io::durable_replace_file(artifact_path, bytes);
+    if (!error.empty())
+    {
+        return WriteResult(error);
+    }
+    return WriteResult(bytes.size());
+}
+
+} // namespace core
+} // namespace configgui
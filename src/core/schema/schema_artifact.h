@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: MIT
+// SchemaArtifact - Precompiled schema analysis stored next to the schema file
+
+#pragma once
+
+#include "../result.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <nlohmann/json.hpp>
+
+// NOTE: No `json` alias in this header (see compiled_schema_cache.h).
+
+namespace configgui {
+namespace core {
+
+class SchemaBundle;
+struct CompiledSchema;
+
+/// @brief The expensive-to-derive parts of a compiled schema, serialized once
+///
+/// OPTIMIZATION: A schema's analysis (parsing, $ref resolution including the
+/// external files it reads, and the json_validator check that the schema is
+/// well-formed) is written as CBOR to "<schema file>.compiled" after the first
+/// compile. Later process starts decode the binary artifact instead of
+/// re-parsing text or YAML, skip reference resolution, and defer json_validator
+/// compilation until a fallback needs it.
+///
+/// The $ref-free view is stored only when it inlines other files: a view equal
+/// to the source is shared with it, and document-local references are
+/// re-resolved in memory, which costs no more than decoding a second tree. The
+/// path index is rebuilt from the view in one walk, and regexes are compiled
+/// by the ValidationPlan (once per distinct pattern), since compiled regex
+/// automata have no serialized form.
+///
+/// An artifact is only used when its format version and fingerprint (the
+/// cache's content hash of the schema bytes and directory) match and every
+/// external document it was bundled from still hashes to the recorded value.
+struct SchemaArtifact
+{
+    /// @brief Bumped whenever the artifact layout or its meaning changes
+    static constexpr std::uint64_t kFormatVersion = 1;
+
+    nlohmann::ordered_json source;             ///< Schema as parsed from the file
+    std::shared_ptr<const SchemaBundle> bundle; ///< $ref-free view (null if bundling failed)
+    bool schema_valid = false;                  ///< json_validator accepted the schema
+    std::size_t path_count = 0;                 ///< Indexed bundle paths, checked on load
+
+    /// @brief Artifact location for a schema file
+    [[nodiscard]] static std::string pathFor(const std::string& schema_path);
+
+    /// @brief Load an artifact, rejecting it when stale or damaged
+    /// @param fingerprint Expected content hash of the schema source
+    [[nodiscard]] static Result<SchemaArtifact, std::string> read(const std::string& artifact_path,
+                                                                  std::uint64_t fingerprint);
+
+    /// @brief Serialize a compiled schema (unique temp file + fsync + rename, so readers never see partial data)
+    /// @return Bytes written, or an error message
+    static Result<std::size_t, std::string> write(const std::string& artifact_path, std::uint64_t fingerprint,
+                                                  const CompiledSchema& compiled);
+};
+
+} // namespace core
+} // namespace configgui
@@ -0,0 +1,429 @@
+// SPDX-License-Identifier: MIT
+// SchemaBundle - Implementation
+
+#include "schema_bundle.h"
+#include "validation_plan.h"
+#include "../io/yaml_reader.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace configgui {
+namespace core {
+
+namespace
+{
+
+/// @brief Raised while resolving; turned into the bundle's error result
+class BundleError : public std::runtime_error
+{
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/// @brief Keywords whose values are instance data, never sub-schemas
+bool isDataKeyword(const std::string& keyword)
+{
+    return keyword == "enum" || keyword == "const" || keyword == "default" || keyword == "examples";
+}
+
+/// @brief Keywords whose value maps property names (not keywords) to sub-schemas
+/// ("dependencies" values may also be name lists, which resolve to themselves)
+bool isNameKeyedKeyword(const std::string& keyword)
+{
+    return keyword == "properties" || keyword == "patternProperties" || keyword == "dependencies";
+}
+
+/// @brief Keywords copied from a $ref object over the referenced schema
+bool isAnnotationKeyword(const std::string& keyword)
+{
+    return keyword == "title" || keyword == "description" || keyword == "default" || keyword == "examples" ||
+           keyword.rfind("x-", 0) == 0;
+}
+
+bool isYamlPath(const std::filesystem::path& path)
+{
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".yaml" || extension == ".yml";
+}
+
+json loadDocument(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        throw BundleError("Cannot open referenced schema: " + path.string());
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+
+    if (isYamlPath(path))
+    {
+        auto parsed = ::configgui::io::YamlReader::readString(buffer.str());
+        if (parsed.is_failure())
+        {
+            throw BundleError("Invalid YAML in referenced schema " + path.string() + ": " + parsed.error());
+        }
+        return std::move(parsed).value();
+    }
+    try
+    {
+        return json::parse(buffer.str());
+    }
+    catch (const json::exception& e)
+    {
+        throw BundleError("Invalid JSON in referenced schema " + path.string() + ": " + e.what());
+    }
+}
+
+/// @brief Decode %XX escapes in a URI fragment
+std::string percentDecode(const std::string& fragment)
+{
+    std::string decoded;
+    decoded.reserve(fragment.size());
+    for (std::size_t i = 0; i < fragment.size(); ++i)
+    {
+        if (fragment[i] == '%' && i + 2 < fragment.size() && std::isxdigit(static_cast<unsigned char>(fragment[i + 1])) &&
+            std::isxdigit(static_cast<unsigned char>(fragment[i + 2])))
+        {
+            decoded.push_back(static_cast<char>(std::stoi(fragment.substr(i + 1, 2), nullptr, 16)));
+            i += 2;
+        }
+        else
+        {
+            decoded.push_back(fragment[i]);
+        }
+    }
+    return decoded;
+}
+
+/// @brief Inlines references, memoizing every resolved target
+class Resolver
+{
+public:
+    /// @brief A loaded document; path is empty for the in-memory root
+    struct Document
+    {
+        const json* root = nullptr;
+        std::filesystem::path path;
+        std::filesystem::path base_dir;
+    };
+
+    json resolve(const json& node, const Document& document)
+    {
+        if (node.is_array())
+        {
+            json result = json::array();
+            for (const auto& element : node)
+            {
+                result.push_back(resolve(element, document));
+            }
+            return result;
+        }
+        if (!node.is_object())
+        {
+            return node;
+        }
+
+        const auto ref = node.find("$ref");
+        if (ref != node.end() && ref->is_string())
+        {
+            json result = resolveRef(ref->get<std::string>(), document);
+            for (auto it = node.begin(); it != node.end(); ++it)
+            {
+                if (isAnnotationKeyword(it.key()))
+                {
+                    result[it.key()] = it.value();
+                }
+            }
+            return result;
+        }
+
+        // node is a schema here: its keys are keywords
+        json result = json::object();
+        for (auto it = node.begin(); it != node.end(); ++it)
+        {
+            if (it.key() == "definitions" || it.key() == "$defs")
+            {
+                continue;
+            }
+            if (isDataKeyword(it.key()))
+            {
+                result[it.key()] = it.value();
+            }
+            else if (isNameKeyedKeyword(it.key()) && it.value().is_object())
+            {
+                result[it.key()] = resolveMembers(it.value(), document);
+            }
+            else
+            {
+                result[it.key()] = resolve(it.value(), document);
+            }
+        }
+        return result;
+    }
+
+    /// @brief Resolve a map keyed by property names: every value is a sub-schema,
+    /// whatever its key ("definitions", "default", ... are ordinary names here)
+    json resolveMembers(const json& members, const Document& document)
+    {
+        json result = json::object();
+        for (auto it = members.begin(); it != members.end(); ++it)
+        {
+            result[it.key()] = resolve(it.value(), document);
+        }
+        return result;
+    }
+
+    std::size_t refCount() const { return ref_count_; }
+
+    std::vector<std::string> externalDocuments() const
+    {
+        std::vector<std::string> paths;
+        for (const auto& entry : documents_)
+        {
+            paths.push_back(entry.first);
+        }
+        return paths;
+    }
+
+private:
+    json resolveRef(const std::string& ref, const Document& document)
+    {
+        ++ref_count_;
+        const std::size_t hash = ref.find('#');
+        const std::string file_part = ref.substr(0, hash);
+        const std::string fragment = (hash == std::string::npos) ? "" : percentDecode(ref.substr(hash + 1));
+
+        if (file_part.find("://") != std::string::npos)
+        {
+            throw BundleError("Remote $ref is not supported: " + ref);
+        }
+        if (!fragment.empty() && fragment[0] != '/')
+        {
+            throw BundleError("Only JSON Pointer fragments are supported in $ref: " + ref);
+        }
+
+        const Document target_document = file_part.empty() ? document : loadExternal(document.base_dir / file_part);
+        const std::string key = target_document.path.string() + "#" + fragment;
+
+        const auto memo = resolved_.find(key);
+        if (memo != resolved_.end())
+        {
+            return memo->second;
+        }
+        if (std::find(stack_.begin(), stack_.end(), key) != stack_.end())
+        {
+            std::string cycle;
+            for (auto it = std::find(stack_.begin(), stack_.end(), key); it != stack_.end(); ++it)
+            {
+                cycle += *it + " -> ";
+            }
+            throw BundleError("Cyclic $ref: " + cycle + key);
+        }
+
+        const json::json_pointer pointer(fragment);
+        if (!target_document.root->contains(pointer))
+        {
+            throw BundleError("Unresolvable $ref: " + ref);
+        }
+
+        stack_.push_back(key);
+        json result = resolve(target_document.root->at(pointer), target_document);
+        stack_.pop_back();
+
+        return resolved_.emplace(key, std::move(result)).first->second;
+    }
+
+    Document loadExternal(const std::filesystem::path& path)
+    {
+        std::error_code ec;
+        std::filesystem::path canonical = std::filesystem::weakly_canonical(path, ec);
+        if (ec)
+        {
+            canonical = path.lexically_normal();
+        }
+
+        auto& slot = documents_[canonical.string()];
+        if (!slot)
+        {
+            slot = std::make_unique<json>(loadDocument(canonical));
+        }
+        return Document{slot.get(), canonical, canonical.parent_path()};
+    }
+
+    std::map<std::string, std::unique_ptr<json>> documents_;
+    std::unordered_map<std::string, json> resolved_;
+    std::vector<std::string> stack_;
+    std::size_t ref_count_ = 0;
+};
+
+} // namespace
+
+Result<SchemaBundle, std::string> SchemaBundle::fromSchema(const json& root_schema, const std::filesystem::path& base_dir)
+{
+    SchemaBundle bundle;
+    try
+    {
+        Resolver resolver;
+        const Resolver::Document root_document{&root_schema, {}, base_dir};
+        bundle.dereferenced_ = std::make_unique<json>(resolver.resolve(root_schema, root_document));
+        bundle.ref_count_ = resolver.refCount();
+        bundle.external_documents_ = resolver.externalDocuments();
+    }
+    catch (const BundleError& e)
+    {
+        return Result<SchemaBundle, std::string>(std::string(e.what()));
+    }
+    catch (const json::exception& e)
+    {
+        return Result<SchemaBundle, std::string>("Invalid $ref: " + std::string(e.what()));
+    }
+
+    std::string pointer;
+    bundle.indexPaths(*bundle.dereferenced_, pointer, false);
+    return Result<SchemaBundle, std::string>(std::move(bundle));
+}
+
+Result<SchemaBundle, std::string> SchemaBundle::fromFile(const std::string& file_path)
+{
+    try
+    {
+        const std::filesystem::path path(file_path);
+        const json schema = loadDocument(path);
+        return fromSchema(schema, path.parent_path());
+    }
+    catch (const BundleError& e)
+    {
+        return Result<SchemaBundle, std::string>(std::string(e.what()));
+    }
+}
+
+SchemaBundle SchemaBundle::fromDereferenced(json dereferenced, std::vector<std::string> external_documents,
+                                            std::size_t ref_count)
+{
+    SchemaBundle bundle;
+    bundle.dereferenced_ = std::make_unique<json>(std::move(dereferenced));
+    bundle.external_documents_ = std::move(external_documents);
+    bundle.ref_count_ = ref_count;
+
+    std::string pointer;
+    bundle.indexPaths(*bundle.dereferenced_, pointer, false);
+    return bundle;
+}
+
+const SchemaBundle::PathEntry* SchemaBundle::find(std::string_view pointer) const
+{
+    const auto exact = paths_.find(std::string(pointer));
+    if (exact != paths_.end())
+    {
+        return &exact->second;
+    }
+    if (pointer.empty() || pointer[0] != '/')
+    {
+        return nullptr;
+    }
+
+    // Resolve one token at a time, mapping array indices onto the item schema
+    std::string key;
+    std::size_t start = 1;
+    const PathEntry* entry = nullptr;
+    while (start <= pointer.size())
+    {
+        const std::size_t end = std::min(pointer.find('/', start), pointer.size());
+        const std::string_view token = pointer.substr(start, end - start);
+        const std::size_t length = key.size();
+
+        key.push_back('/');
+        key.append(token);
+        auto it = paths_.find(key);
+        if (it == paths_.end() && !token.empty() &&
+            std::all_of(token.begin(), token.end(), [](char c) { return c >= '0' && c <= '9'; }))
+        {
+            key.resize(length + 1);
+            key.append(kArrayItemToken);
+            it = paths_.find(key);
+        }
+        if (it == paths_.end())
+        {
+            return nullptr;
+        }
+        entry = &it->second;
+        start = end + 1;
+    }
+    return entry;
+}
+
+const json* SchemaBundle::findSchema(std::string_view pointer) const
+{
+    const PathEntry* entry = find(pointer);
+    return (entry != nullptr) ? entry->schema : nullptr;
+}
+
+void SchemaBundle::indexPaths(const json& schema, std::string& pointer, bool required)
+{
+    PathEntry& entry = paths_[pointer];
+    entry.schema = &schema;
+    entry.required = required;
+    if (!schema.is_object())
+    {
+        return;
+    }
+
+    const std::size_t length = pointer.size();
+    const auto properties = schema.find("properties");
+    if (properties != schema.end() && properties->is_object())
+    {
+        std::unordered_set<std::string> required_names;
+        const auto required_list = schema.find("required");
+        if (required_list != schema.end() && required_list->is_array())
+        {
+            for (const auto& name : *required_list)
+            {
+                if (name.is_string())
+                {
+                    required_names.insert(name.get<std::string>());
+                }
+            }
+        }
+
+        std::vector<bool> mask;
+        mask.reserve(properties->size());
+        for (auto it = properties->begin(); it != properties->end(); ++it)
+        {
+            const bool is_required = required_names.count(it.key()) != 0;
+            mask.push_back(is_required);
+            ValidationPlan::appendPointerToken(pointer, it.key());
+            indexPaths(it.value(), pointer, is_required);
+            pointer.resize(length);
+        }
+        entry.required_mask = std::move(mask);  // Node references survive rehashing
+    }
+
+    const auto items = schema.find("items");
+    if (items != schema.end() && items->is_object())
+    {
+        pointer.push_back('/');
+        pointer.append(kArrayItemToken);
+        indexPaths(*items, pointer, false);
+        pointer.resize(length);
+    }
+    else if (items != schema.end() && items->is_array())
+    {
+        for (std::size_t i = 0; i < items->size(); ++i)
+        {
+            pointer.append("/" + std::to_string(i));
+            indexPaths((*items)[i], pointer, false);
+            pointer.resize(length);
+        }
+    }
+}
+
+} // namespace core
+} // namespace configgui
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: MIT
+// SchemaBundle - Schema with every $ref resolved once, indexed by instance path
+
+#pragma once
+
+#include "../result.h"
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::ordered_json;
+
+namespace configgui {
+namespace core {
+
+/// @brief A JSON Schema with its $refs inlined plus a table of every sub-schema
+///
+/// OPTIMIZATION: Document-local ("#/definitions/x") and relative-file
+/// ("common.json#/definitions/x") references are resolved once at bundle time.
+/// Each distinct target is dereferenced a single time and copied where it is
+/// used, so form generation, validation and the HTTP schema endpoint work on a
+/// plain tree and look sub-schemas up by path instead of re-walking
+/// "properties"/"items" and chasing references.
+///
+/// Annotation keywords next to a $ref (title, description, default, examples,
+/// x-*) override the target's; other siblings are ignored as in Draft 7.
+/// "definitions" and "$defs" are dropped from the view once inlined.
+class SchemaBundle
+{
+public:
+    /// @brief Reference token used in path keys for "every array element"
+    static constexpr std::string_view kArrayItemToken = "*";
+
+    /// @brief One sub-schema reachable through properties/items
+    struct PathEntry
+    {
+        const json* schema = nullptr;    ///< Dereferenced sub-schema
+        bool required = false;           ///< Listed in the parent object's "required"
+        std::vector<bool> required_mask; ///< Bit per "properties" member, in declaration order
+    };
+
+    /// @brief Bundle an in-memory schema
+    /// @param base_dir Directory relative-file references are resolved against
+    /// @return Bundle, or a message naming the unresolvable or cyclic reference
+    static Result<SchemaBundle, std::string> fromSchema(const json& root_schema,
+                                                        const std::filesystem::path& base_dir = {});
+
+    /// @brief Load and bundle a .json, .yaml or .yml schema file
+    static Result<SchemaBundle, std::string> fromFile(const std::string& file_path);
+
+    /// @brief Rebuild a bundle from a view that was dereferenced earlier (see SchemaArtifact)
+    /// No references are resolved and no external documents are read; only the
+    /// path table is rebuilt, in one walk over the view.
+    static SchemaBundle fromDereferenced(json dereferenced, std::vector<std::string> external_documents,
+                                         std::size_t ref_count);
+
+    /// @brief Schema with every reference inlined
+    [[nodiscard]] const json& dereferenced() const { return *dereferenced_; }
+
+    /// @brief Look up the sub-schema for an instance JSON Pointer ("" = root)
+    /// Array indices match the element schema, so "/servers/3/port" and
+    /// "/servers/*/port" find the same entry
+    /// @return Entry, or nullptr when the schema does not describe that location
+    [[nodiscard]] const PathEntry* find(std::string_view pointer) const;
+
+    /// @brief Sub-schema for an instance JSON Pointer, or nullptr
+    [[nodiscard]] const json* findSchema(std::string_view pointer) const;
+
+    /// @brief Number of indexed paths
+    [[nodiscard]] std::size_t pathCount() const { return paths_.size(); }
+
+    /// @brief Number of $ref occurrences that were inlined
+    [[nodiscard]] std::size_t refCount() const { return ref_count_; }
+
+    /// @brief Absolute paths of the external documents that were read
+    [[nodiscard]] const std::vector<std::string>& externalDocuments() const { return external_documents_; }
+
+private:
+    SchemaBundle() = default;
+
+    void indexPaths(const json& schema, std::string& pointer, bool required);
+
+    std::unique_ptr<json> dereferenced_;  ///< Heap-held so PathEntry pointers survive moves
+    std::unordered_map<std::string, PathEntry> paths_;
+    std::vector<std::string> external_documents_;
+    std::size_t ref_count_ = 0;
+};
+
+} // namespace core
+} // namespace configgui
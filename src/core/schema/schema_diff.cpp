@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: MIT
+// SchemaDiff - Implementation
+
+#include "schema_diff.h"
+#include <algorithm>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace configgui {
+namespace core {
+
+namespace
+{
+
+using PathTable = std::unordered_map<std::string_view, const json*>;
+
+PathTable collectPaths(const JSONSchema& schema)
+{
+    PathTable table;
+    table.reserve(schema.indexedPathCount());
+    schema.forEachIndexedPath([&table](std::string_view pointer, const json& sub_schema) {
+        table.emplace(pointer, &sub_schema);
+    });
+    return table;
+}
+
+std::string_view parentOf(std::string_view pointer)
+{
+    const std::size_t slash = pointer.rfind('/');
+    return slash == std::string_view::npos ? std::string_view() : pointer.substr(0, slash);
+}
+
+std::string lastToken(std::string_view pointer)
+{
+    const std::size_t slash = pointer.rfind('/');
+    if (slash == std::string_view::npos)
+    {
+        return "";
+    }
+    const auto tokens = SchemaDiff::splitPointer(std::string(pointer.substr(slash)));
+    return tokens.empty() ? std::string() : tokens.back();
+}
+
+/// @brief "type" as a canonical string: sorted and '|'-joined for unions, "" when absent
+std::string typeSignature(const json& schema)
+{
+    if (!schema.is_object())
+    {
+        return "";
+    }
+    const auto type = schema.find("type");
+    if (type == schema.end())
+    {
+        return "";
+    }
+    if (type->is_string())
+    {
+        return type->get<std::string>();
+    }
+    if (!type->is_array())
+    {
+        return "";
+    }
+
+    std::vector<std::string> names;
+    for (const auto& name : *type)
+    {
+        if (name.is_string())
+        {
+            names.push_back(name.get<std::string>());
+        }
+    }
+    std::sort(names.begin(), names.end());
+    std::string joined;
+    for (const auto& name : names)
+    {
+        if (!joined.empty())
+        {
+            joined.push_back('|');
+        }
+        joined.append(name);
+    }
+    return joined;
+}
+
+/// @brief Schema content ignoring annotations that a rename typically touches
+std::string fingerprint(const json& schema)
+{
+    if (!schema.is_object())
+    {
+        return schema.dump();
+    }
+    json stripped = schema;
+    stripped.erase("title");
+    stripped.erase("description");
+    return stripped.dump();
+}
+
+/// @brief True when key is a declared member of parent (not an array item)
+bool isProperty(const PathTable& table, std::string_view parent, const std::string& key)
+{
+    const auto it = table.find(parent);
+    if (it == table.end() || !it->second->is_object())
+    {
+        return false;
+    }
+    const auto properties = it->second->find("properties");
+    return properties != it->second->end() && properties->is_object() && properties->contains(key);
+}
+
+/// @brief Paths present in table but not in other, keeping only the top of each subtree
+std::vector<std::string_view> topMostMissing(const PathTable& table, const PathTable& other)
+{
+    std::unordered_set<std::string_view> missing;
+    for (const auto& entry : table)
+    {
+        if (other.find(entry.first) == other.end())
+        {
+            missing.insert(entry.first);
+        }
+    }
+
+    std::vector<std::string_view> top;
+    for (const auto pointer : missing)
+    {
+        if (pointer.empty() || missing.find(parentOf(pointer)) == missing.end())
+        {
+            top.push_back(pointer);
+        }
+    }
+    return top;
+}
+
+} // namespace
+
+const char* to_string(SchemaChangeKind kind)
+{
+    switch (kind)
+    {
+        case SchemaChangeKind::Added:
+            return "added";
+        case SchemaChangeKind::Removed:
+            return "removed";
+        case SchemaChangeKind::Renamed:
+            return "renamed";
+        case SchemaChangeKind::Retyped:
+            return "retyped";
+    }
+    return "unknown";
+}
+
+std::vector<std::string> SchemaDiff::splitPointer(const std::string& pointer)
+{
+    std::vector<std::string> tokens;
+    std::size_t start = 1;
+    while (!pointer.empty() && start <= pointer.size())
+    {
+        const std::size_t end = std::min(pointer.find('/', start), pointer.size());
+        std::string token;
+        for (std::size_t i = start; i < end; ++i)
+        {
+            if (pointer[i] == '~' && i + 1 < end && (pointer[i + 1] == '0' || pointer[i + 1] == '1'))
+            {
+                token.push_back(pointer[i + 1] == '0' ? '~' : '/');
+                ++i;
+            }
+            else
+            {
+                token.push_back(pointer[i]);
+            }
+        }
+        tokens.push_back(std::move(token));
+        start = end + 1;
+    }
+    return tokens;
+}
+
+SchemaDiff SchemaDiff::compute(const JSONSchema& from, const JSONSchema& to)
+{
+    const PathTable old_paths = collectPaths(from);
+    const PathTable new_paths = collectPaths(to);
+    SchemaDiff diff;
+
+    // Retyped: present in both with a different "type"
+    for (const auto& [pointer, old_schema] : old_paths)
+    {
+        const auto other = new_paths.find(pointer);
+        if (other == new_paths.end())
+        {
+            continue;
+        }
+        std::string old_type = typeSignature(*old_schema);
+        std::string new_type = typeSignature(*other->second);
+        if (old_type != new_type)
+        {
+            diff.changes_.push_back(
+                SchemaChange{SchemaChangeKind::Retyped, std::string(pointer), "", std::move(old_type), std::move(new_type)});
+        }
+    }
+
+    const auto removed = topMostMissing(old_paths, new_paths);
+    const auto added = topMostMissing(new_paths, old_paths);
+
+    // Rename candidates: removed and added members grouped by parent and fingerprint
+    std::unordered_map<std::string, std::vector<std::string_view>> removed_by_key;
+    std::unordered_map<std::string, std::vector<std::string_view>> added_by_key;
+    auto candidate_key = [](std::string_view pointer, const json& schema) {
+        std::string key(parentOf(pointer));
+        key.push_back('\n');
+        key.append(fingerprint(schema));
+        return key;
+    };
+    for (const auto pointer : removed)
+    {
+        if (isProperty(old_paths, parentOf(pointer), lastToken(pointer)))
+        {
+            removed_by_key[candidate_key(pointer, *old_paths.at(pointer))].push_back(pointer);
+        }
+    }
+    for (const auto pointer : added)
+    {
+        if (isProperty(new_paths, parentOf(pointer), lastToken(pointer)))
+        {
+            added_by_key[candidate_key(pointer, *new_paths.at(pointer))].push_back(pointer);
+        }
+    }
+
+    std::unordered_set<std::string_view> renamed_from;
+    std::unordered_set<std::string_view> renamed_to;
+    for (const auto& [key, sources] : removed_by_key)
+    {
+        const auto targets = added_by_key.find(key);
+        if (sources.size() != 1 || targets == added_by_key.end() || targets->second.size() != 1)
+        {
+            continue;  // Ambiguous: keep as separate removal and addition
+        }
+        const std::string_view source = sources.front();
+        const std::string_view target = targets->second.front();
+        std::string type = typeSignature(*old_paths.at(source));
+        diff.changes_.push_back(
+            SchemaChange{SchemaChangeKind::Renamed, std::string(source), std::string(target), type, type});
+        renamed_from.insert(source);
+        renamed_to.insert(target);
+    }
+
+    for (const auto pointer : removed)
+    {
+        if (renamed_from.find(pointer) == renamed_from.end())
+        {
+            diff.changes_.push_back(SchemaChange{SchemaChangeKind::Removed, std::string(pointer), "",
+                                                 typeSignature(*old_paths.at(pointer)), ""});
+        }
+    }
+    for (const auto pointer : added)
+    {
+        if (renamed_to.find(pointer) == renamed_to.end())
+        {
+            diff.changes_.push_back(SchemaChange{SchemaChangeKind::Added, std::string(pointer), "", "",
+                                                 typeSignature(*new_paths.at(pointer))});
+        }
+    }
+
+    // The tables are unordered; sort for stable reports
+    std::sort(diff.changes_.begin(), diff.changes_.end(), [](const SchemaChange& a, const SchemaChange& b) {
+        return a.path != b.path ? a.path < b.path : a.kind < b.kind;
+    });
+    return diff;
+}
+
+std::size_t SchemaDiff::count(SchemaChangeKind kind) const
+{
+    return static_cast<std::size_t>(std::count_if(changes_.begin(), changes_.end(),
+                                                  [kind](const SchemaChange& change) { return change.kind == kind; }));
+}
+
+} // namespace core
+} // namespace configgui
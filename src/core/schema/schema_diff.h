@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: MIT
+// SchemaDiff - Structural differences between two schema versions
+
+#pragma once
+
+#include "schema.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace configgui {
+namespace core {
+
+/// @brief What happened to one path between two schema versions
+enum class SchemaChangeKind
+{
+    Added,    ///< Path only exists in the new schema
+    Removed,  ///< Path only exists in the old schema
+    Renamed,  ///< Member moved to another key under the same parent, schema unchanged
+    Retyped   ///< Path exists in both, but its "type" differs
+};
+
+/// @brief Human-readable name of a change kind ("added", "removed", ...)
+const char* to_string(SchemaChangeKind kind);
+
+/// @brief One structural change
+/// Paths are JSON Pointers over the instance ("*" = every array element).
+struct SchemaChange
+{
+    SchemaChangeKind kind = SchemaChangeKind::Added;
+    std::string path;      ///< Old-schema pointer (new-schema pointer for Added)
+    std::string new_path;  ///< Renamed only: pointer in the new schema
+    std::string old_type;  ///< "type" in the old schema ("a|b" for unions, "" = any)
+    std::string new_type;  ///< "type" in the new schema
+};
+
+/// @brief Added, removed, renamed and retyped paths between two JSONSchemas
+///
+/// OPTIMIZATION: Both schemas already carry a pointer-keyed path index, so the
+/// diff is a hash join of the two tables instead of a recursive walk of both
+/// documents. Only the top-most added/removed path of a subtree is reported,
+/// and only those candidates are fingerprinted for rename detection.
+///
+/// A removed and an added member under the same parent are reported as one
+/// rename when their sub-schemas are identical apart from title/description
+/// and the pairing is unambiguous.
+class SchemaDiff
+{
+public:
+    /// @brief Diff two schema versions
+    [[nodiscard]] static SchemaDiff compute(const JSONSchema& from, const JSONSchema& to);
+
+    /// @brief Every change, ordered by path
+    [[nodiscard]] const std::vector<SchemaChange>& changes() const { return changes_; }
+
+    /// @brief True when the schemas are structurally identical
+    [[nodiscard]] bool empty() const { return changes_.empty(); }
+
+    /// @brief Number of changes of one kind
+    [[nodiscard]] std::size_t count(SchemaChangeKind kind) const;
+
+    /// @brief Split a JSON Pointer into unescaped reference tokens
+    [[nodiscard]] static std::vector<std::string> splitPointer(const std::string& pointer);
+
+private:
+    std::vector<SchemaChange> changes_;
+};
+
+} // namespace core
+} // namespace configgui
@@ -2,61 +2,31 @@
 // SchemaLoader - Implementation
 
 #include "schema_loader.h"
-#include <fstream>
-#include <sstream>
-#include <iostream>
+#include "compiled_schema_cache.h"
 
 namespace configgui {
 namespace core {
 
 Result<JSONSchema, FileError> SchemaLoader::loadSchema(const std::string& file_path)
 {
-    std::ifstream file(file_path);
-    if (!file.is_open())
+    // OPTIMIZATION: Parsing and validator compilation are shared process-wide;
+    // an unchanged file is served from the cache without being re-read
+    auto compiled = CompiledSchemaCache::instance().get(file_path);
+    if (compiled.is_failure())
     {
-        return Result<JSONSchema, FileError>(FileError::NotFound);
+        return Result<JSONSchema, FileError>(compiled.error());
     }
-
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    file.close();
-
-    return loadSchemaFromString(buffer.str());
+    return Result<JSONSchema, FileError>(*compiled.value()->schema);
 }
 
 Result<JSONSchema, FileError> SchemaLoader::loadSchemaFromString(const std::string& json_string)
 {
-    try
-    {
-        const json schema_json = json::parse(json_string);
-
-        if (!validateJson(schema_json))
-        {
-            return Result<JSONSchema, FileError>(FileError::InvalidJson);
-        }
-
-        JSONSchema schema(schema_json);
-        return Result<JSONSchema, FileError>(schema);
-    }
-    catch (const json::exception& /*e*/)
-    {
-        return Result<JSONSchema, FileError>(FileError::ParseError);
-    }
-    catch (const std::exception& /*e*/)
-    {
-        return Result<JSONSchema, FileError>(FileError::UnknownError);
-    }
-}
-
-bool SchemaLoader::validateJson(const json& schema_json) const
-{
-    // Basic JSON schema validation (Draft 7)
-    // Check for required "type" field or other schema indicators
-    if (schema_json.is_object())
+    auto compiled = CompiledSchemaCache::instance().getFromString(json_string);
+    if (compiled.is_failure())
     {
-        return true;
+        return Result<JSONSchema, FileError>(compiled.error());
     }
-    return false;
+    return Result<JSONSchema, FileError>(*compiled.value()->schema);
 }
 
 } // namespace core
@@ -15,6 +15,8 @@ namespace configgui {
 namespace core {
 
 /// @brief Loads JSON schema files and creates SchemaValidator instances
+/// Schemas are served from CompiledSchemaCache::instance(), so repeated loads of
+/// unchanged content share one parsed schema and compiled validator.
 class SchemaLoader
 {
 public:
@@ -32,10 +34,6 @@ public:
 
     /// @brief Load schema from JSON string
     [[nodiscard]] Result<JSONSchema, FileError> loadSchemaFromString(const std::string& json_string);
-
-private:
-    /// @brief Validate schema is proper JSON
-    [[nodiscard]] bool validateJson(const json& schema_json) const;
 };
 
 } // namespace core
@@ -0,0 +1,478 @@
+// SPDX-License-Identifier: MIT
+// SchemaNormalizer - Implementation
+
+#include "schema_normalizer.h"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+
+namespace configgui {
+namespace core {
+
+using ordered_json = nlohmann::ordered_json;
+
+namespace
+{
+
+/// @brief Upper bound on chained local $refs (a -> b -> c ...) followed per node
+constexpr int kMaxRefHops = 32;
+
+/// @brief Largest magnitude below which every integral double fits in int64_t
+constexpr double kInt64Limit = 9.2e18;
+
+bool isIntegral(double value)
+{
+    double integral_part = 0.0;
+    return std::isfinite(value) && std::fabs(value) < kInt64Limit && !(std::fabs(std::modf(value, &integral_part)) > 0.0);
+}
+
+bool startsCleanly(const std::string& text)
+{
+    return !text.empty() && !std::isspace(static_cast<unsigned char>(text[0]));
+}
+
+bool parseInteger(const std::string& text, std::int64_t& out)
+{
+    if (!startsCleanly(text))
+    {
+        return false;
+    }
+    char* end = nullptr;
+    errno = 0;
+    const long long parsed = std::strtoll(text.c_str(), &end, 10);
+    if (errno != 0 || end != text.c_str() + text.size())
+    {
+        return false;
+    }
+    out = static_cast<std::int64_t>(parsed);
+    return true;
+}
+
+bool parseNumber(const std::string& text, double& out)
+{
+    if (!startsCleanly(text))
+    {
+        return false;
+    }
+    char* end = nullptr;
+    errno = 0;
+    const double parsed = std::strtod(text.c_str(), &end);
+    if (errno != 0 || end != text.c_str() + text.size() || !std::isfinite(parsed))
+    {
+        return false;
+    }
+    out = parsed;
+    return true;
+}
+
+bool parseBoolean(const std::string& text, bool& out)
+{
+    std::string lower;
+    lower.reserve(text.size());
+    for (const char c : text)
+    {
+        lower.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+    }
+    if (lower == "true")
+    {
+        out = true;
+        return true;
+    }
+    if (lower == "false")
+    {
+        out = false;
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+std::uint32_t SchemaNormalizer::typeBit(const std::string& type)
+{
+    if (type == "null") return NullType;
+    if (type == "boolean") return BooleanType;
+    if (type == "integer") return IntegerType;
+    if (type == "number") return NumberType;
+    if (type == "string") return StringType;
+    if (type == "array") return ArrayType;
+    if (type == "object") return ObjectType;
+    return 0;
+}
+
+SchemaNormalizer::SchemaNormalizer(const ordered_json& root_schema) : root_(&root_schema)
+{
+    compile(root_schema);
+
+    // An edge whose child can reach its parent would create objects forever
+    for (std::size_t i = 0; i < nodes_.size(); ++i)
+    {
+        for (auto& property : nodes_[i].properties)
+        {
+            std::vector<bool> visited(nodes_.size(), false);
+            property.fillable = property.node != npos && !reaches(property.node, i, visited);
+        }
+    }
+
+    std::vector<int> state(nodes_.size(), 0);
+    for (std::size_t i = 0; i < nodes_.size(); ++i)
+    {
+        computeFillsBelow(i, state);
+    }
+    root_ = nullptr;
+    compiled_.clear();
+}
+
+std::size_t SchemaNormalizer::compile(const ordered_json& schema)
+{
+    // Follow local $refs to the schema they name
+    const ordered_json* current = &schema;
+    for (int hop = 0; hop < kMaxRefHops && current->is_object(); ++hop)
+    {
+        const auto ref = current->find("$ref");
+        if (ref == current->end() || !ref->is_string())
+        {
+            break;
+        }
+        const std::string& target = ref->get_ref<const std::string&>();
+        if (target.empty() || target[0] != '#')
+        {
+            break;
+        }
+        try
+        {
+            const ordered_json::json_pointer pointer(target.substr(1));
+            if (!root_->contains(pointer))
+            {
+                break;
+            }
+            current = &root_->at(pointer);
+        }
+        catch (const nlohmann::json::exception& /*e*/)
+        {
+            break;
+        }
+    }
+    if (!current->is_object())
+    {
+        return npos;  // Boolean schema: nothing to normalize
+    }
+
+    const auto memo = compiled_.find(current);
+    if (memo != compiled_.end())
+    {
+        return memo->second;
+    }
+
+    // Reserve the slot first so recursive references resolve to it
+    const std::size_t index = nodes_.size();
+    nodes_.emplace_back();
+    compiled_.emplace(current, index);
+    const ordered_json& node_schema = *current;
+
+    const auto type = node_schema.find("type");
+    if (type != node_schema.end() && type->is_string())
+    {
+        nodes_[index].type_mask = typeBit(type->get<std::string>());
+    }
+    else if (type != node_schema.end() && type->is_array())
+    {
+        for (const auto& entry : *type)
+        {
+            if (entry.is_string())
+            {
+                nodes_[index].type_mask |= typeBit(entry.get<std::string>());
+            }
+        }
+    }
+
+    const auto default_value = node_schema.find("default");
+    if (default_value != node_schema.end())
+    {
+        nodes_[index].has_default = true;
+        nodes_[index].default_value = *default_value;
+    }
+
+    const auto properties = node_schema.find("properties");
+    if (properties != node_schema.end() && properties->is_object())
+    {
+        nodes_[index].has_properties = true;
+        for (auto it = properties->begin(); it != properties->end(); ++it)
+        {
+            const std::size_t child = compile(it.value());
+            Node& node = nodes_[index];
+            node.property_index.emplace(it.key(), node.properties.size());
+            node.properties.push_back(Property{it.key(), child, true});
+        }
+    }
+
+    const auto additional = node_schema.find("additionalProperties");
+    if (additional != node_schema.end() && additional->is_object())
+    {
+        const std::size_t child = compile(*additional);
+        nodes_[index].additional = child;
+        nodes_[index].keeps_unknown = true;
+    }
+    if (node_schema.contains("patternProperties"))
+    {
+        nodes_[index].keeps_unknown = true;
+    }
+
+    const auto items = node_schema.find("items");
+    if (items != node_schema.end() && items->is_object())
+    {
+        const std::size_t child = compile(*items);
+        nodes_[index].items = child;
+    }
+    else if (items != node_schema.end() && items->is_array())
+    {
+        for (const auto& item : *items)
+        {
+            const std::size_t child = compile(item);
+            nodes_[index].tuple_items.push_back(child);
+        }
+    }
+
+    return index;
+}
+
+bool SchemaNormalizer::reaches(std::size_t from, std::size_t target, std::vector<bool>& visited) const
+{
+    if (from == target)
+    {
+        return true;
+    }
+    if (visited[from])
+    {
+        return false;
+    }
+    visited[from] = true;
+    for (const auto& property : nodes_[from].properties)
+    {
+        if (property.node != npos && reaches(property.node, target, visited))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SchemaNormalizer::computeFillsBelow(std::size_t index, std::vector<int>& state)
+{
+    // Fillable edges form a DAG, so plain memoized recursion terminates
+    if (state[index] != 0)
+    {
+        return nodes_[index].has_default || nodes_[index].fills_below;
+    }
+    state[index] = 1;
+    bool below = false;
+    for (const auto& property : nodes_[index].properties)
+    {
+        if (property.fillable && computeFillsBelow(property.node, state))
+        {
+            below = true;
+        }
+    }
+    nodes_[index].fills_below = below;
+    return nodes_[index].has_default || below;
+}
+
+bool SchemaNormalizer::fills(const Property& property) const
+{
+    return property.fillable && (nodes_[property.node].has_default || nodes_[property.node].fills_below);
+}
+
+ordered_json SchemaNormalizer::normalize(const ordered_json& document, const NormalizeOptions& options,
+                                         NormalizeStats* stats) const
+{
+    ordered_json result = document;
+    normalizeInPlace(result, options, stats);
+    return result;
+}
+
+void SchemaNormalizer::normalizeInPlace(ordered_json& document, const NormalizeOptions& options,
+                                        NormalizeStats* stats) const
+{
+    NormalizeStats local;
+    if (!nodes_.empty())
+    {
+        normalizeNode(0, document, options, local);
+    }
+    if (stats != nullptr)
+    {
+        stats->defaults_filled += local.defaults_filled;
+        stats->coerced += local.coerced;
+        stats->stripped += local.stripped;
+    }
+}
+
+void SchemaNormalizer::normalizeNode(std::size_t index, ordered_json& value, const NormalizeOptions& options,
+                                     NormalizeStats& stats) const
+{
+    if (index == npos)
+    {
+        return;
+    }
+    const Node& node = nodes_[index];
+
+    if (options.coerce_types && node.type_mask != 0 && coerce(node.type_mask, value))
+    {
+        ++stats.coerced;
+    }
+
+    if (value.is_object())
+    {
+        // One pass over the members: recurse into known ones, note which
+        // declared properties were seen, and find unknown members
+        std::vector<bool> seen(node.properties.size(), false);
+        bool has_unknown = false;
+        for (auto it = value.begin(); it != value.end(); ++it)
+        {
+            const auto known = node.property_index.find(it.key());
+            if (known != node.property_index.end())
+            {
+                seen[known->second] = true;
+                normalizeNode(node.properties[known->second].node, it.value(), options, stats);
+            }
+            else if (node.additional != npos)
+            {
+                normalizeNode(node.additional, it.value(), options, stats);
+            }
+            else
+            {
+                has_unknown = true;
+            }
+        }
+
+        if (options.strip_unknown && has_unknown && node.has_properties && !node.keeps_unknown)
+        {
+            ordered_json kept = ordered_json::object();
+            for (auto it = value.begin(); it != value.end(); ++it)
+            {
+                if (node.property_index.count(it.key()) != 0)
+                {
+                    kept[it.key()] = std::move(it.value());
+                }
+                else
+                {
+                    ++stats.stripped;
+                }
+            }
+            value = std::move(kept);
+        }
+
+        if (options.fill_defaults)
+        {
+            for (std::size_t i = 0; i < node.properties.size(); ++i)
+            {
+                if (!seen[i] && fills(node.properties[i]))
+                {
+                    value[node.properties[i].name] = makeMissing(node.properties[i].node, stats);
+                }
+            }
+        }
+    }
+    else if (value.is_array())
+    {
+        for (std::size_t i = 0; i < value.size(); ++i)
+        {
+            const std::size_t child = (i < node.tuple_items.size()) ? node.tuple_items[i] : node.items;
+            normalizeNode(child, value[i], options, stats);
+        }
+    }
+}
+
+bool SchemaNormalizer::coerce(std::uint32_t type_mask, ordered_json& value) const
+{
+    // Already an accepted type: nothing to do
+    switch (value.type())
+    {
+        case ordered_json::value_t::null:
+            return false;  // Missing values are not invented
+        case ordered_json::value_t::boolean:
+            if ((type_mask & BooleanType) != 0) return false;
+            break;
+        case ordered_json::value_t::number_integer:
+        case ordered_json::value_t::number_unsigned:
+            if ((type_mask & (IntegerType | NumberType)) != 0) return false;
+            break;
+        case ordered_json::value_t::number_float:
+            if ((type_mask & NumberType) != 0) return false;
+            break;
+        case ordered_json::value_t::string:
+            if ((type_mask & StringType) != 0) return false;
+            break;
+        case ordered_json::value_t::array:
+        case ordered_json::value_t::object:
+        default:
+            return false;  // Containers are never reshaped
+    }
+
+    if (value.is_string())
+    {
+        const std::string& text = value.get_ref<const std::string&>();
+        std::int64_t integer = 0;
+        double number = 0.0;
+        bool boolean = false;
+        if ((type_mask & IntegerType) != 0 && parseInteger(text, integer))
+        {
+            value = integer;
+            return true;
+        }
+        if ((type_mask & NumberType) != 0 && parseNumber(text, number))
+        {
+            value = number;
+            return true;
+        }
+        if ((type_mask & IntegerType) != 0 && parseNumber(text, number) && isIntegral(number))
+        {
+            value = static_cast<std::int64_t>(number);
+            return true;
+        }
+        if ((type_mask & BooleanType) != 0 && parseBoolean(text, boolean))
+        {
+            value = boolean;
+            return true;
+        }
+        return false;
+    }
+
+    if (value.is_number_float() && (type_mask & IntegerType) != 0 && isIntegral(value.get<double>()))
+    {
+        value = static_cast<std::int64_t>(value.get<double>());
+        return true;
+    }
+
+    if ((type_mask & StringType) != 0 && (value.is_number() || value.is_boolean()))
+    {
+        value = value.dump();
+        return true;
+    }
+    return false;
+}
+
+ordered_json SchemaNormalizer::makeMissing(std::size_t index, NormalizeStats& stats) const
+{
+    const Node& node = nodes_[index];
+    if (node.has_default)
+    {
+        ++stats.defaults_filled;
+        return node.default_value;
+    }
+
+    // No default of its own: build the object from the defaults below it
+    ordered_json object = ordered_json::object();
+    for (const auto& property : node.properties)
+    {
+        if (fills(property))
+        {
+            object[property.name] = makeMissing(property.node, stats);
+        }
+    }
+    return object;
+}
+
+} // namespace core
+} // namespace configgui
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: MIT
+// SchemaNormalizer - Fills defaults, coerces types and strips unknown keys in one pass
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+// NOTE: No `json` alias in this header so the HTML server (nlohmann::json) can
+// include it; documents are always nlohmann::ordered_json.
+
+namespace configgui {
+namespace core {
+
+/// @brief Which normalization steps to apply
+struct NormalizeOptions
+{
+    bool fill_defaults = true;   ///< Insert "default" values for missing members
+    bool coerce_types = true;    ///< Convert scalars to the declared "type" when lossless
+    bool strip_unknown = false;  ///< Remove members the schema does not declare
+};
+
+/// @brief What a normalization pass changed
+struct NormalizeStats
+{
+    std::size_t defaults_filled = 0;  ///< Members inserted from "default"
+    std::size_t coerced = 0;          ///< Values converted to the declared type
+    std::size_t stripped = 0;         ///< Unknown members removed
+};
+
+/// @brief Schema-driven normalizer, compiled once per schema
+///
+/// OPTIMIZATION: "properties", "items", "additionalProperties", "type" and
+/// "default" are compiled into a flat node array (local $refs resolved), so a
+/// pass is a single walk over the document with no schema lookups. Clients get
+/// a ready-to-render document instead of each walking the schema per field.
+///
+/// A missing member is filled from its "default"; a missing object member
+/// without one is created when something below it has a default, except on
+/// recursive edges (a node that can contain itself). Unknown
+/// members are only stripped from objects that declare "properties" and have
+/// no additionalProperties or patternProperties schema.
+class SchemaNormalizer
+{
+public:
+    /// @brief Compile a root schema (ideally the $ref-free SchemaBundle view)
+    explicit SchemaNormalizer(const nlohmann::ordered_json& root_schema);
+
+    /// @brief Normalize a copy of document
+    [[nodiscard]] nlohmann::ordered_json normalize(const nlohmann::ordered_json& document,
+                                                   const NormalizeOptions& options = {},
+                                                   NormalizeStats* stats = nullptr) const;
+
+    /// @brief Normalize document in place
+    void normalizeInPlace(nlohmann::ordered_json& document, const NormalizeOptions& options = {},
+                          NormalizeStats* stats = nullptr) const;
+
+    /// @brief Number of compiled nodes
+    [[nodiscard]] std::size_t nodeCount() const { return nodes_.size(); }
+
+private:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /// @brief JSON type bits for Node::type_mask
+    enum TypeBit : std::uint32_t
+    {
+        NullType = 1u << 0,
+        BooleanType = 1u << 1,
+        IntegerType = 1u << 2,
+        NumberType = 1u << 3,
+        StringType = 1u << 4,
+        ArrayType = 1u << 5,
+        ObjectType = 1u << 6
+    };
+
+    /// @brief Declared property and its compiled schema
+    struct Property
+    {
+        std::string name;
+        std::size_t node = npos;
+        bool fillable = true;  ///< False on recursive edges, which are never auto-created
+    };
+
+    struct Node
+    {
+        std::uint32_t type_mask = 0;  ///< 0 = any type
+        bool has_default = false;
+        nlohmann::ordered_json default_value;
+        bool fills_below = false;     ///< Some descendant property has a default
+        std::vector<Property> properties;  ///< Declaration order
+        std::unordered_map<std::string, std::size_t> property_index;
+        bool has_properties = false;
+        bool keeps_unknown = false;   ///< additionalProperties/patternProperties schema present
+        std::size_t additional = npos;
+        std::size_t items = npos;
+        std::vector<std::size_t> tuple_items;
+    };
+
+    static std::uint32_t typeBit(const std::string& type);
+    std::size_t compile(const nlohmann::ordered_json& schema);
+    [[nodiscard]] bool reaches(std::size_t from, std::size_t target, std::vector<bool>& visited) const;
+    bool computeFillsBelow(std::size_t index, std::vector<int>& state);
+    void normalizeNode(std::size_t index, nlohmann::ordered_json& value, const NormalizeOptions& options,
+                       NormalizeStats& stats) const;
+    [[nodiscard]] bool coerce(std::uint32_t type_mask, nlohmann::ordered_json& value) const;
+    [[nodiscard]] bool fills(const Property& property) const;
+    [[nodiscard]] nlohmann::ordered_json makeMissing(std::size_t index, NormalizeStats& stats) const;
+
+    const nlohmann::ordered_json* root_ = nullptr;  ///< Valid during construction only
+    std::vector<Node> nodes_;
+    std::unordered_map<const nlohmann::ordered_json*, std::size_t> compiled_;
+};
+
+} // namespace core
+} // namespace configgui
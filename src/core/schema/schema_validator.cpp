@@ -6,29 +6,126 @@
 namespace configgui {
 namespace core {
 
-SchemaValidator::SchemaValidator(const json& schema_json) : schema_(schema_json)
+namespace
 {
-    try
+
+/// @brief Map a json_validator message onto the closest ValidationErrorType
+ValidationErrorType classifyLibraryMessage(const std::string& message)
+{
+    auto has = [&message](const char* text) { return message.find(text) != std::string::npos; };
+
+    if (has("required"))
+    {
+        return ValidationErrorType::Required;
+    }
+    if (has("type"))
+    {
+        return ValidationErrorType::TypeMismatch;
+    }
+    if (has("minimum") || has("below"))
+    {
+        return ValidationErrorType::MinimumViolation;
+    }
+    if (has("maximum") || has("exceeds"))
+    {
+        return ValidationErrorType::MaximumViolation;
+    }
+    if (has("too short") || has("minLength") || has("minItems"))
+    {
+        return ValidationErrorType::MinLengthViolation;
+    }
+    if (has("too long") || has("maxLength") || has("maxItems"))
+    {
+        return ValidationErrorType::MaxLengthViolation;
+    }
+    if (has("pattern"))
+    {
+        return ValidationErrorType::PatternMismatch;
+    }
+    if (has("enum") || has("const"))
     {
-        validator_ = std::make_unique<nlohmann::json_schema::json_validator>(schema_json);
+        return ValidationErrorType::EnumViolation;
     }
-    catch (const std::exception& /*e*/)
+    return ValidationErrorType::CustomValidationFailed;
+}
+
+/// @brief Forwards every json_validator error instead of throwing on the first
+class ForwardingErrorHandler : public nlohmann::json_schema::basic_error_handler
+{
+public:
+    explicit ForwardingErrorHandler(const ValidationErrorHandler& handler) : handler_(handler) {}
+
+    void error(const nlohmann::json::json_pointer& ptr, const nlohmann::json& instance,
+               const std::string& message) override
+    {
+        basic_error_handler::error(ptr, instance, message);
+        handler_(ValidationError(ptr.to_string(), classifyLibraryMessage(message), message, ""));
+    }
+
+private:
+    const ValidationErrorHandler& handler_;
+};
+
+/// @brief JSON Pointer of a field given by top-level name or by pointer
+std::string fieldPointer(const std::string& field_name)
+{
+    if (field_name.empty() || field_name[0] == '/')
+    {
+        return field_name;
+    }
+    std::string pointer;
+    ValidationPlan::appendPointerToken(pointer, field_name);
+    return pointer;
+}
+
+} // namespace
+
+SchemaValidator::SchemaValidator(const json& schema_json) : SchemaValidator(schema_json, false) {}
+
+SchemaValidator::SchemaValidator(const json& schema_json, bool schema_known_valid) : schema_(schema_json)
+{
+    // Compiling json_validator is also the check that the schema is well-formed
+    schema_valid_ = schema_known_valid || fullValidator() != nullptr;
+
+    if (schema_valid_)
     {
-        // Invalid schema
-        validator_ = nullptr;
+        try
+        {
+            plan_ = std::make_unique<ValidationPlan>(schema_);
+        }
+        catch (const std::exception& /*e*/)
+        {
+            plan_ = nullptr;
+        }
     }
 }
 
+const nlohmann::json_schema::json_validator* SchemaValidator::fullValidator() const
+{
+    std::call_once(validator_once_, [this] {
+        try
+        {
+            validator_ = std::make_unique<nlohmann::json_schema::json_validator>(schema_);
+        }
+        catch (const std::exception& /*e*/)
+        {
+            validator_ = nullptr;
+        }
+    });
+    return validator_.get();
+}
+
 bool SchemaValidator::validateSchemaFormat() const
 {
-    return validator_ != nullptr;
+    return schema_valid_;
 }
 
 ValidationErrors SchemaValidator::validate(const json& data) const
 {
     ValidationErrors errors;
 
-    if (!validator_)
+    const auto* full = schema_valid_ ? fullValidator() : nullptr;
+    if (!full)
     {
         errors.push_back(ValidationError("", ValidationErrorType::None, "Schema validator not initialized", ""));
         return errors;
@@ -36,7 +133,7 @@ ValidationErrors SchemaValidator::validate(const json& data) const
 
     try
     {
-        validator_->validate(data);
+        full->validate(data);
     }
     catch (const std::exception& e)
     {
@@ -47,31 +144,216 @@ ValidationErrors SchemaValidator::validate(const json& data) const
     return errors;
 }
 
+bool SchemaValidator::validate(const json& data, const ValidationErrorHandler& handler) const
+{
+    if (schema_valid_ && usesCompiledPlan())
+    {
+        return memo_ ? memo_->validate(data, handler) : plan_->validate(data, handler);
+    }
+
+    const auto* full = schema_valid_ ? fullValidator() : nullptr;
+    if (!full)
+    {
+        handler(ValidationError("", ValidationErrorType::None, "Schema validator not initialized", ""));
+        return false;
+    }
+
+    bool valid = true;
+    const ValidationErrorHandler tracking = [&](const ValidationError& error) {
+        valid = false;
+        handler(error);
+    };
+    ForwardingErrorHandler forwarding(tracking);
+    try
+    {
+        full->validate(nlohmann::json(data), forwarding);
+    }
+    catch (const std::exception& e)
+    {
+        tracking(ValidationError("", ValidationErrorType::None, std::string("Validation failed: ") + e.what(), ""));
+    }
+    return valid;
+}
+
+bool SchemaValidator::isValid(const json& data) const
+{
+    if (schema_valid_ && usesCompiledPlan())
+    {
+        return memo_ ? memo_->isValid(data) : plan_->isValid(data);
+    }
+
+    const auto* full = schema_valid_ ? fullValidator() : nullptr;
+    if (!full)
+    {
+        return false;
+    }
+    try
+    {
+        // The default error handler throws on the first violation
+        full->validate(nlohmann::json(data));
+        return true;
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+ValidationErrors SchemaValidator::validateAll(const json& data) const
+{
+    ValidationErrors errors;
+    validate(data, [&errors](const ValidationError& error) { errors.push_back(error); });
+    return errors;
+}
+
 ValidationErrors SchemaValidator::validateField(const std::string& field_name, const json& value) const
 {
     ValidationErrors errors;
 
-    if (!validator_)
+    if (!schema_valid_ || !plan_)
     {
         return errors;
     }
 
-    // For individual field validation, we would create a sub-schema
-    // This is a simplified implementation
-    try
+    const std::string path = fieldPointer(field_name);
+    if (!plan_->isComplete())
     {
-        json test_data;
-        test_data[field_name] = value;
-        validator_->validate(test_data);
+        return validateFieldInContext(path, value);
     }
-    catch (const std::exception& e)
+
+    const ValidationErrorHandler collect = [&errors](const ValidationError& error) { errors.push_back(error); };
+    validateFieldOnPlan(path, value, &collect);
+    return errors;
+}
+
+bool SchemaValidator::isFieldValid(const std::string& field_name, const json& value) const
+{
+    if (!schema_valid_ || !plan_)
+    {
+        return true;
+    }
+
+    const std::string path = fieldPointer(field_name);
+    if (!plan_->isComplete())
+    {
+        return validateFieldInContext(path, value).empty();
+    }
+    return validateFieldOnPlan(path, value, nullptr);
+}
+
+bool SchemaValidator::validateFieldOnPlan(const std::string& pointer, const json& value,
+                                          const ValidationErrorHandler* handler) const
+{
+    // Object members go through their parent so "patternProperties", "propertyNames"
+    // and "additionalProperties" apply exactly as in a full pass
+    const std::size_t slash = pointer.rfind('/');
+    std::string parent_path = (slash == std::string::npos) ? std::string() : pointer.substr(0, slash);
+    const std::size_t parent = (slash == std::string::npos) ? ValidationPlan::npos : plan_->findNode(parent_path);
+    const bool array_parent = parent != ValidationPlan::npos &&
+                              (plan_->node(parent).items != ValidationPlan::npos || plan_->node(parent).tuple_form);
+    if (parent != ValidationPlan::npos && !array_parent)
+    {
+        std::string name;
+        for (std::size_t i = slash + 1; i < pointer.size(); ++i)
+        {
+            const bool escape = pointer[i] == '~' && i + 1 < pointer.size();
+            name.push_back(escape ? (pointer[++i] == '1' ? '/' : '~') : pointer[i]);
+        }
+        return validateMember(parent, name, value, parent_path, handler);
+    }
+
+    const std::size_t node = plan_->findNode(pointer);
+    if (node == ValidationPlan::npos)
+    {
+        return true;  // Not described by the schema, and no object parent to forbid it
+    }
+    std::string path = pointer;
+    return validateNode(node, value, path, handler);
+}
+
+ValidationErrors SchemaValidator::validateFieldInContext(const std::string& pointer, const json& value) const
+{
+    // json_validator only takes whole documents: place the value in an otherwise empty
+    // skeleton of its parents and keep what is reported at or below its pointer
+    const auto collect = [this](const json& document) {
+        ValidationErrors errors;
+        validate(document, [&errors](const ValidationError& error) { errors.push_back(error); });
+        return errors;
+    };
+    if (pointer.empty())
     {
-        errors.push_back(createError(field_name, ValidationErrorType::None, std::string(e.what())));
+        return collect(value);
     }
 
+    const json::json_pointer location(pointer);
+    json document;
+    document[location] = value;
+    ValidationErrors reported = collect(document);
+
+    // A member the parent rejects ("additionalProperties", "propertyNames") is reported
+    // at the parent; those errors count only if they go away without the member
+    const std::string parent = location.parent_pointer().to_string();
+    ValidationErrors baseline;
+    if (document[location.parent_pointer()].is_object())
+    {
+        json without;
+        without[location.parent_pointer()] = json::object();
+        baseline = collect(without);
+    }
+
+    ValidationErrors errors;
+    for (auto& error : reported)
+    {
+        const std::string& field = error.field();
+        const bool inside = field == pointer || field.compare(0, pointer.size() + 1, pointer + "/") == 0;
+        const bool from_member =
+            field == parent && document[location.parent_pointer()].is_object() &&
+            std::none_of(baseline.begin(), baseline.end(), [&error](const ValidationError& known) {
+                return known.field() == error.field() && known.message() == error.message();
+            });
+        if (inside || from_member)
+        {
+            errors.push_back(std::move(error));
+        }
+    }
     return errors;
 }
 
+bool SchemaValidator::validateNode(std::size_t index, const json& instance, std::string& path,
+                                   const ValidationErrorHandler* handler) const
+{
+    if (!plan_)
+    {
+        return false;
+    }
+    return memo_ ? memo_->validateNode(index, instance, path, handler)
+                 : plan_->validateNode(index, instance, path, handler);
+}
+
+bool SchemaValidator::validateMember(std::size_t index, const std::string& name, const json& value,
+                                     std::string& path, const ValidationErrorHandler* handler) const
+{
+    if (!plan_)
+    {
+        return false;
+    }
+    return plan_->validateMember(index, name, value, path, handler, memo_.get());
+}
+
+void SchemaValidator::setMemoization(std::size_t max_bytes)
+{
+    memo_.reset();
+    if (plan_ && max_bytes != 0)
+    {
+        memo_ = std::make_unique<ValidationMemo>(*plan_, max_bytes);
+    }
+}
+
+ValidationMemo::Stats SchemaValidator::memoStats() const
+{
+    return memo_ ? memo_->stats() : ValidationMemo::Stats();
+}
+
 ValidationError SchemaValidator::createError(const std::string& field, ValidationErrorType type,
                                               const std::string& message) const
 {
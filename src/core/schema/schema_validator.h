@@ -7,6 +7,10 @@
 #include "schema.h"
 #include "../error_types.h"
 #include "validation_error.h"
+#include "validation_memo.h"
+#include "validation_plan.h"
+#include <memory>
+#include <mutex>
 #include <string>
 #include <nlohmann/json.hpp>
 #include <nlohmann/json-schema.hpp>
@@ -21,6 +25,12 @@ class SchemaValidator
 {
 public:
     explicit SchemaValidator(const json& schema_json);
+
+    /// @brief Create a validator for a schema already checked by an earlier compile
+    /// OPTIMIZATION: With schema_known_valid (e.g. from a precompiled SchemaArtifact)
+    /// json_validator is only compiled the first time a fallback path needs it, which
+    /// never happens when the compiled plan covers the whole schema.
+    SchemaValidator(const json& schema_json, bool schema_known_valid);
     ~SchemaValidator() = default;
 
     // Non-copyable, non-movable
@@ -35,15 +45,80 @@ public:
     /// @brief Validate data against schema
     [[nodiscard]] ValidationErrors validate(const json& data) const;
 
-    /// @brief Validate single field against schema
+    /// @brief Validate data against schema, reporting every violation in one pass
+    /// @param handler Receives each error; its field() is the instance's JSON Pointer
+    /// @return True if the data is valid
+    /// OPTIMIZATION: Runs the compiled ValidationPlan; schemas using keywords the
+    /// plan does not implement fall back to json_validator with a collecting handler
+    bool validate(const json& data, const ValidationErrorHandler& handler) const;
+
+    /// @brief Validate data against schema and collect every violation
+    [[nodiscard]] ValidationErrors validateAll(const json& data) const;
+
+    /// @brief Check data against schema without collecting errors
+    /// OPTIMIZATION: Stops at the first violation and builds no messages; with
+    /// memoization on, a subtree cached as valid ends the walk there. For callers
+    /// that only need a yes/no answer (enabling Save, pre-flight checks).
+    [[nodiscard]] bool isValid(const json& data) const;
+
+    /// @brief Check if validateAll() runs on the compiled plan (no fallback)
+    [[nodiscard]] bool usesCompiledPlan() const { return plan_ != nullptr && plan_->isComplete(); }
+
+    /// @brief Validate single field against its own sub-schema
+    /// @param field_name Top-level property name, or a JSON Pointer ("/server/port")
+    /// @param value Candidate value for that field
+    /// @return Errors whose field() is the JSON Pointer of the offending value
+    /// OPTIMIZATION: Looks the field up in the plan's pointer table and validates only
+    /// that member against its parent's member keywords, so the cost is independent of
+    /// schema size. Sibling constraints (the parent's "required") are not checked;
+    /// validateAll() covers those. When the plan is incomplete the field is checked by
+    /// the full validator inside a skeleton of its parents instead.
     [[nodiscard]] ValidationErrors validateField(const std::string& field_name, const json& value) const;
 
+    /// @brief validateField() as a yes/no check that stops at the first violation
+    [[nodiscard]] bool isFieldValid(const std::string& field_name, const json& value) const;
+
+    /// @brief Validate an instance against one compiled node, through the memo when enabled
+    /// Same contract as ValidationPlan::validateNode; false when there is no plan
+    bool validateNode(std::size_t index, const json& instance, std::string& path,
+                      const ValidationErrorHandler* handler) const;
+
+    /// @brief Validate one object member against an object node, through the memo when enabled
+    /// Same contract as ValidationPlan::validateMember; false when there is no plan
+    bool validateMember(std::size_t index, const std::string& name, const json& value, std::string& path,
+                        const ValidationErrorHandler* handler) const;
+
+    /// @brief Cache plan results by (node, value) so repeated validation of unchanged
+    /// subtrees becomes a lookup; call before sharing the validator between threads
+    /// @param max_bytes Memory budget for cached results; 0 disables memoization
+    void setMemoization(std::size_t max_bytes = ValidationMemo::kDefaultBudget);
+
+    /// @brief Memo counters and hit rate (all zero when memoization is off)
+    [[nodiscard]] ValidationMemo::Stats memoStats() const;
+
     /// @brief Get the schema
     [[nodiscard]] const json& schema() const { return schema_; }
 
+    /// @brief Get the compiled plan (nullptr if the schema is invalid)
+    [[nodiscard]] const ValidationPlan* plan() const { return plan_.get(); }
+
 private:
+    /// @brief json_validator for fallback paths, compiled on first use when deferred
+    [[nodiscard]] const nlohmann::json_schema::json_validator* fullValidator() const;
+
+    /// @brief validateField() on a complete plan; handler nullptr = stop at the first violation
+    bool validateFieldOnPlan(const std::string& pointer, const json& value,
+                             const ValidationErrorHandler* handler) const;
+
+    /// @brief validateField() through the full validator, for plans that skip keywords
+    [[nodiscard]] ValidationErrors validateFieldInContext(const std::string& pointer, const json& value) const;
+
     json schema_;
-    std::unique_ptr<nlohmann::json_schema::json_validator> validator_;
+    bool schema_valid_ = false;
+    mutable std::once_flag validator_once_;
+    mutable std::unique_ptr<nlohmann::json_schema::json_validator> validator_;
+    std::unique_ptr<ValidationPlan> plan_;
+    std::unique_ptr<ValidationMemo> memo_;  ///< Internally synchronized, hence usable from const methods
 
     /// @brief Create ValidationError from schema violation
     [[nodiscard]] ValidationError createError(const std::string& field, ValidationErrorType type,
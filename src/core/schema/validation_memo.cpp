@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: MIT
+// ValidationMemo - Implementation
+
+#include "validation_memo.h"
+#include "../io/content_hash.h"
+#include <cstring>
+
+namespace configgui {
+namespace core {
+
+namespace
+{
+
+/// @brief Two independent 64-bit hashes of a value
+struct Fingerprint
+{
+    std::uint64_t key = 0;
+    std::uint64_t check = 0;
+};
+
+void mix(Fingerprint& seed, const Fingerprint& value)
+{
+    seed.key = (seed.key ^ value.key) * 0x100000001b3ull + (seed.key >> 29);
+    seed.check = (seed.check ^ value.check) * 0xff51afd7ed558ccdull + (seed.check >> 31);
+}
+
+Fingerprint scalar(std::uint64_t type, std::uint64_t bits)
+{
+    Fingerprint result{type, ~type};
+    mix(result, Fingerprint{bits, bits});
+    return result;
+}
+
+Fingerprint text(std::uint64_t type, const std::string& value)
+{
+    return Fingerprint{io::content_hash(value, type), io::content_hash(value, ~type)};
+}
+
+/// @brief Structural fingerprint of instance
+/// Types are part of it, so 1 and 1.0 (which report differently) get separate entries
+Fingerprint fingerprint(const json& instance)
+{
+    const auto type = static_cast<std::uint64_t>(instance.type());
+    switch (instance.type())
+    {
+        case json::value_t::boolean:
+            return scalar(type, instance.get<bool>() ? 1u : 0u);
+        case json::value_t::number_integer:
+            return scalar(type, static_cast<std::uint64_t>(instance.get<std::int64_t>()));
+        case json::value_t::number_unsigned:
+            return scalar(type, instance.get<std::uint64_t>());
+        case json::value_t::number_float:
+        {
+            const double value = instance.get<double>();
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return scalar(type, bits);
+        }
+        case json::value_t::string:
+            return text(type, instance.get_ref<const std::string&>());
+        case json::value_t::array:
+        {
+            Fingerprint seed = scalar(type, instance.size());
+            for (const auto& element : instance)
+            {
+                mix(seed, fingerprint(element));
+            }
+            return seed;
+        }
+        case json::value_t::object:
+        {
+            Fingerprint seed = scalar(type, instance.size());
+            for (auto it = instance.begin(); it != instance.end(); ++it)
+            {
+                mix(seed, text(0, it.key()));
+                mix(seed, fingerprint(it.value()));
+            }
+            return seed;
+        }
+        default:
+            return scalar(type, 0);
+    }
+}
+
+void replay(const ValidationErrors& errors, const std::string& path, const ValidationErrorHandler& handler)
+{
+    for (const auto& error : errors)
+    {
+        handler(ValidationError(path + error.field(), error.type(), error.message(), error.suggestion()));
+    }
+}
+
+} // namespace
+
+ValidationMemo::ValidationMemo(const ValidationPlan& plan, std::size_t max_bytes) : plan_(plan), max_bytes_(max_bytes)
+{
+}
+
+bool ValidationMemo::validate(const json& instance, const ValidationErrorHandler& handler)
+{
+    std::string path;
+    return validateNode(plan_.root(), instance, path, handler ? &handler : nullptr);
+}
+
+bool ValidationMemo::isValid(const json& instance)
+{
+    std::string path;
+    return validateNode(plan_.root(), instance, path, nullptr);
+}
+
+bool ValidationMemo::worthCaching(std::size_t index, const json& instance) const
+{
+    for (std::size_t hops = 0; index != ValidationPlan::npos && hops < plan_.nodeCount(); ++hops)
+    {
+        const PlanNode& node = plan_.node(index);
+        if (node.ref == ValidationPlan::npos)
+        {
+            if (instance.is_object() || instance.is_array())
+            {
+                return !instance.empty();
+            }
+            return (instance.is_string() && node.pattern) || !node.all_of.empty() || !node.any_of.empty() ||
+                   !node.one_of.empty() || node.not_node != ValidationPlan::npos ||
+                   node.if_node != ValidationPlan::npos;
+        }
+        index = node.ref;
+    }
+    return false;
+}
+
+bool ValidationMemo::validateNode(std::size_t index, const json& instance, std::string& path,
+                                  const ValidationErrorHandler* handler)
+{
+    if (!worthCaching(index, instance))
+    {
+        return plan_.validateNode(index, instance, path, handler, this);
+    }
+
+    const Fingerprint print = fingerprint(instance);
+    const Key key{index, print.key};
+
+    std::shared_ptr<const Result> cached;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto found = entries_.find(key);
+        if (found != entries_.end() && found->second.result->check == print.check &&
+            (found->second.result->complete || handler == nullptr))
+        {
+            cached = found->second.result;
+            lru_.splice(lru_.begin(), lru_, found->second.lru_position);
+            ++stats_.hits;
+        }
+        else
+        {
+            ++stats_.misses;
+        }
+    }
+    if (cached)
+    {
+        if (handler != nullptr)
+        {
+            replay(cached->errors, path, *handler);
+        }
+        return cached->valid;
+    }
+
+    auto result = std::make_shared<Result>();
+    result->check = print.check;
+
+    // Children are memoized too: the recursion comes back through this object
+    const std::size_t base = path.size();
+    const ValidationErrorHandler record = [&result, base](const ValidationError& error) {
+        result->errors.emplace_back(error.field().substr(base), error.type(), error.message(), error.suggestion());
+    };
+    result->valid = plan_.validateNode(index, instance, path, handler != nullptr ? &record : nullptr, this);
+    // A silent check that passed ran every keyword, so its (empty) error list is complete
+    result->complete = handler != nullptr || result->valid;
+
+    std::size_t bytes = sizeof(Result) + sizeof(Entry) + sizeof(Key);
+    for (const auto& error : result->errors)
+    {
+        bytes += sizeof(ValidationError) + error.field().size() + error.message().size();
+    }
+    if (handler != nullptr)
+    {
+        replay(result->errors, path, *handler);
+    }
+    const bool valid = result->valid;
+    store(key, std::move(result), bytes);
+    return valid;
+}
+
+void ValidationMemo::store(const Key& key, std::shared_ptr<const Result> result, std::size_t bytes)
+{
+    // One result may not take over the cache (e.g. thousands of errors)
+    if (bytes > max_bytes_ / 2)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto existing = entries_.find(key);
+    if (existing != entries_.end())
+    {
+        stats_.bytes -= existing->second.bytes;
+        lru_.erase(existing->second.lru_position);
+        entries_.erase(existing);
+    }
+
+    while (!lru_.empty() && stats_.bytes + bytes > max_bytes_)
+    {
+        const auto victim = entries_.find(lru_.back());
+        stats_.bytes -= victim->second.bytes;
+        entries_.erase(victim);
+        lru_.pop_back();
+        ++stats_.evictions;
+    }
+
+    lru_.push_front(key);
+    entries_.emplace(key, Entry{std::move(result), bytes, lru_.begin()});
+    stats_.bytes += bytes;
+    stats_.entries = entries_.size();
+}
+
+void ValidationMemo::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+    stats_.bytes = 0;
+    stats_.entries = 0;
+}
+
+ValidationMemo::Stats ValidationMemo::stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+} // namespace core
+} // namespace configgui
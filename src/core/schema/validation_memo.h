@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: MIT
+// ValidationMemo - Bounded cache of validation results per (plan node, value)
+
+#pragma once
+
+#include "validation_error.h"
+#include "validation_plan.h"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::ordered_json;
+
+namespace configgui {
+namespace core {
+
+/// @brief Memoizes ValidationPlan results so unchanged subtrees are validated once
+///
+/// OPTIMIZATION: Results are keyed by compiled node index plus a 64-bit hash of
+/// the instance, and stored with paths relative to the instance, so the same
+/// value under the same sub-schema is answered from the cache wherever it
+/// appears. Revalidating a form after one edit, or a server validating the
+/// same config again, turns every unchanged object, array and pattern-checked
+/// string into a lookup.
+///
+/// Scalars without a pattern are cheaper to check than to hash and are never
+/// cached. A hit also requires a second, independent 64-bit hash to match, so
+/// returning another value's result takes a 128-bit collision; values are not
+/// copied into the cache. Memory is bounded: the least recently used entries
+/// are evicted once the estimated size of the cached errors exceeds the budget.
+///
+/// Thread-safe: lookups and inserts take a mutex, validation runs outside it.
+class ValidationMemo
+{
+public:
+    /// @brief Cache counters
+    struct Stats
+    {
+        std::size_t hits = 0;       ///< Lookups answered from the cache
+        std::size_t misses = 0;     ///< Lookups that ran the plan
+        std::size_t evictions = 0;  ///< Entries dropped to respect the budget
+        std::size_t entries = 0;    ///< Results currently cached
+        std::size_t bytes = 0;      ///< Estimated memory held by the cached results
+
+        /// @brief Fraction of lookups answered from the cache (0 when none were made)
+        [[nodiscard]] double hitRate() const
+        {
+            const std::size_t lookups = hits + misses;
+            return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+        }
+    };
+
+    static constexpr std::size_t kDefaultBudget = 4u * 1024u * 1024u;
+
+    /// @brief Create a memo for plan (which must outlive it) holding at most max_bytes of results
+    explicit ValidationMemo(const ValidationPlan& plan, std::size_t max_bytes = kDefaultBudget);
+
+    // Non-copyable, non-movable (the mutex and the plan reference)
+    ValidationMemo(const ValidationMemo&) = delete;
+    ValidationMemo& operator=(const ValidationMemo&) = delete;
+    ValidationMemo(ValidationMemo&&) = delete;
+    ValidationMemo& operator=(ValidationMemo&&) = delete;
+
+    /// @brief Validate a document against the plan's root, reporting every violation to handler
+    /// @return True if the document is valid
+    bool validate(const json& instance, const ValidationErrorHandler& handler);
+
+    /// @brief Memoized ValidationPlan::isValid(): a cached valid subtree ends the walk there,
+    /// and a document found valid is then also a hit for validate()
+    [[nodiscard]] bool isValid(const json& instance);
+
+    /// @brief Memoized ValidationPlan::validateNode (same contract)
+    bool validateNode(std::size_t index, const json& instance, std::string& path,
+                      const ValidationErrorHandler* handler);
+
+    /// @brief Drop every entry (counters are kept)
+    void clear();
+
+    /// @brief Snapshot of the counters
+    [[nodiscard]] Stats stats() const;
+
+private:
+    /// @brief A cached verdict; errors carry paths relative to the instance
+    struct Result
+    {
+        std::uint64_t check = 0;  ///< Second hash of the value, confirms a key match
+        bool valid = true;
+        bool complete = true;  ///< False when a stop-at-first-error check failed (errors not collected)
+        ValidationErrors errors;
+    };
+
+    struct Key
+    {
+        std::size_t node;
+        std::uint64_t hash;
+        bool operator==(const Key& other) const { return node == other.node && hash == other.hash; }
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const
+        {
+            return static_cast<std::size_t>(key.hash ^ (static_cast<std::uint64_t>(key.node) * 0x9e3779b97f4a7c15ull));
+        }
+    };
+
+    struct Entry
+    {
+        std::shared_ptr<const Result> result;
+        std::size_t bytes = 0;
+        std::list<Key>::iterator lru_position;
+    };
+
+    [[nodiscard]] bool worthCaching(std::size_t index, const json& instance) const;
+    void store(const Key& key, std::shared_ptr<const Result> result, std::size_t bytes);
+
+    const ValidationPlan& plan_;
+    std::size_t max_bytes_;
+    mutable std::mutex mutex_;
+    std::unordered_map<Key, Entry, KeyHash> entries_;
+    std::list<Key> lru_;  ///< Most recently used first
+    Stats stats_;
+};
+
+} // namespace core
+} // namespace configgui
@@ -0,0 +1,1140 @@
+// SPDX-License-Identifier: MIT
+// ValidationPlan - Implementation
+
+#include "validation_plan.h"
+#include "instance_index.h"
+#include "validation_memo.h"
+#include "../../validators/regex_backend.h"
+#include <algorithm>
+#include <cmath>
+
+namespace configgui {
+namespace core {
+
+namespace
+{
+
+/// @brief Wrapper giving a whole-input matcher the search semantics of "pattern"
+const std::string kSearchPrefix = "[\\s\\S]*(?:";
+const std::string kSearchSuffix = ")[\\s\\S]*";
+
+std::uint32_t typeBitFromName(const std::string& name)
+{
+    if (name == "null") return ValidationPlan::NullType;
+    if (name == "boolean") return ValidationPlan::BooleanType;
+    if (name == "integer") return ValidationPlan::IntegerType;
+    if (name == "number") return ValidationPlan::NumberType | ValidationPlan::IntegerType;
+    if (name == "string") return ValidationPlan::StringType;
+    if (name == "array") return ValidationPlan::ArrayType;
+    if (name == "object") return ValidationPlan::ObjectType;
+    return 0;
+}
+
+std::uint32_t instanceTypeBits(const json& instance)
+{
+    switch (instance.type())
+    {
+        case json::value_t::null:
+            return ValidationPlan::NullType;
+        case json::value_t::boolean:
+            return ValidationPlan::BooleanType;
+        case json::value_t::number_integer:
+        case json::value_t::number_unsigned:
+            return ValidationPlan::IntegerType | ValidationPlan::NumberType;
+        case json::value_t::number_float:
+        {
+            // Draft 7: a float with no fractional part is also an integer
+            const double value = instance.get<double>();
+            const bool whole = std::isfinite(value) && !(std::fabs(value - std::trunc(value)) > 0.0);
+            return ValidationPlan::NumberType | (whole ? ValidationPlan::IntegerType : 0u);
+        }
+        case json::value_t::string:
+            return ValidationPlan::StringType;
+        case json::value_t::array:
+            return ValidationPlan::ArrayType;
+        case json::value_t::object:
+            return ValidationPlan::ObjectType;
+        default:
+            return 0;
+    }
+}
+
+std::string typeNames(std::uint32_t mask)
+{
+    static const std::pair<std::uint32_t, const char*> names[] = {
+        {ValidationPlan::NullType, "null"},       {ValidationPlan::BooleanType, "boolean"},
+        {ValidationPlan::IntegerType, "integer"}, {ValidationPlan::NumberType, "number"},
+        {ValidationPlan::StringType, "string"},   {ValidationPlan::ArrayType, "array"},
+        {ValidationPlan::ObjectType, "object"}};
+
+    std::string result;
+    for (const auto& entry : names)
+    {
+        if ((mask & entry.first) != 0u)
+        {
+            // "number" implies "integer"; list only the wider name
+            if (entry.first == ValidationPlan::IntegerType && (mask & ValidationPlan::NumberType) != 0u)
+            {
+                continue;
+            }
+            result += result.empty() ? "" : " or ";
+            result += entry.second;
+        }
+    }
+    return result;
+}
+
+/// @brief Length in Unicode code points (Draft 7 minLength/maxLength semantics)
+std::size_t utf8Length(const std::string& text)
+{
+    std::size_t length = 0;
+    for (const char c : text)
+    {
+        if ((static_cast<unsigned char>(c) & 0xC0u) != 0x80u)
+        {
+            ++length;
+        }
+    }
+    return length;
+}
+
+std::string formatNumber(double value)
+{
+    return json(value).dump();
+}
+
+void appendToken(std::string& path, const std::string& name)
+{
+    ValidationPlan::appendPointerToken(path, name);
+}
+
+void appendToken(std::string& path, std::size_t index)
+{
+    path.push_back('/');
+    path += std::to_string(index);
+}
+
+} // namespace
+
+ValidationPlan::ValidationPlan(const json& root_schema) : root_(&root_schema)
+{
+    compile(root_schema, "#");
+    root_ = nullptr;
+    regexes_.clear();
+
+    std::string pointer;
+    std::vector<bool> on_path(nodes_.size(), false);
+    indexPaths(root(), pointer, on_path);
+}
+
+std::size_t ValidationPlan::resolveRef(std::size_t index) const
+{
+    // Bounded so that a schema made only of $refs pointing at each other cannot loop forever
+    for (std::size_t hops = 0; index != npos && nodes_[index].ref != npos && hops < nodes_.size(); ++hops)
+    {
+        index = nodes_[index].ref;
+    }
+    return index;
+}
+
+void ValidationPlan::indexPaths(std::size_t index, std::string& pointer, std::vector<bool>& on_path)
+{
+    index = resolveRef(index);
+    if (index == npos || on_path[index])
+    {
+        return;  // Recursive schema: deeper paths are resolved by findNode's walk
+    }
+
+    path_index_.emplace(pointer, index);
+    on_path[index] = true;
+    for (const auto& [name, child] : nodes_[index].properties)
+    {
+        const std::size_t length = pointer.size();
+        appendPointerToken(pointer, name);
+        indexPaths(child, pointer, on_path);
+        pointer.resize(length);
+    }
+    on_path[index] = false;
+}
+
+std::size_t ValidationPlan::findNode(const std::string& pointer) const
+{
+    const auto indexed = path_index_.find(pointer);
+    if (indexed != path_index_.end())
+    {
+        return indexed->second;
+    }
+    if (!pointer.empty() && pointer[0] != '/')
+    {
+        return npos;
+    }
+
+    std::size_t current = resolveRef(root());
+    std::size_t start = 1;
+    while (current != npos && start <= pointer.size())
+    {
+        const std::size_t end = std::min(pointer.find('/', start), pointer.size());
+        std::string token;
+        for (std::size_t i = start; i < end; ++i)
+        {
+            if (pointer[i] == '~' && i + 1 < end)
+            {
+                token.push_back(pointer[i + 1] == '1' ? '/' : '~');
+                ++i;
+            }
+            else
+            {
+                token.push_back(pointer[i]);
+            }
+        }
+        start = end + 1;
+
+        const PlanNode& node = nodes_[current];
+        const auto property = node.properties.find(token);
+        const auto pattern = std::find_if(node.pattern_properties.begin(), node.pattern_properties.end(),
+                                          [&token](const PlanPatternProperty& entry) {
+                                              return entry.regex->fullMatch(token);
+                                          });
+        const bool is_index = !token.empty() && token.size() < 10 &&
+                              token.find_first_not_of("0123456789") == std::string::npos;
+        if (property != node.properties.end())
+        {
+            current = property->second;
+        }
+        else if (pattern != node.pattern_properties.end())
+        {
+            current = pattern->schema;
+        }
+        else if (is_index && node.items != npos)
+        {
+            current = node.items;
+        }
+        else if (is_index && std::stoul(token) < node.tuple_items.size())
+        {
+            current = node.tuple_items[std::stoul(token)];
+        }
+        else if (is_index && node.tuple_form)
+        {
+            current = node.additional_items;
+        }
+        else
+        {
+            current = node.additional;
+        }
+        current = resolveRef(current);
+    }
+    return current;
+}
+
+void ValidationPlan::appendPointerToken(std::string& pointer, const std::string& token)
+{
+    pointer.push_back('/');
+    for (const char c : token)
+    {
+        if (c == '~')
+        {
+            pointer += "~0";
+        }
+        else if (c == '/')
+        {
+            pointer += "~1";
+        }
+        else
+        {
+            pointer.push_back(c);
+        }
+    }
+}
+
+std::size_t ValidationPlan::compile(const json& schema, const std::string& schema_pointer)
+{
+    const auto found = compiled_.find(schema_pointer);
+    if (found != compiled_.end())
+    {
+        return found->second;
+    }
+
+    // Reserve the slot before recursing so cyclic $refs resolve to this index
+    const std::size_t index = nodes_.size();
+    nodes_.emplace_back();
+    compiled_.emplace(schema_pointer, index);
+
+    PlanNode node;
+    if (schema.is_boolean())
+    {
+        node.reject_all = !schema.get<bool>();
+    }
+    else if (schema.is_object())
+    {
+        const auto ref = schema.find("$ref");
+        if (ref != schema.end())
+        {
+            if (ref->is_string())
+            {
+                node.ref = compileRef(ref->get<std::string>(), schema_pointer);
+            }
+            else
+            {
+                unsupported_.push_back(schema_pointer + "/$ref");
+            }
+        }
+        else
+        {
+            compileKeywords(schema, schema_pointer, node);
+        }
+    }
+    else
+    {
+        unsupported_.push_back(schema_pointer);
+    }
+
+    nodes_[index] = std::move(node);
+    return index;
+}
+
+std::size_t ValidationPlan::compileRef(const std::string& ref, const std::string& schema_pointer)
+{
+    // Only document-local references ("#", "#/definitions/...") can be resolved offline
+    if (ref.empty() || ref[0] != '#')
+    {
+        unsupported_.push_back(schema_pointer + "/$ref");
+        return npos;
+    }
+
+    try
+    {
+        const std::string target = ref.substr(1);
+        const json& resolved = target.empty() ? *root_ : root_->at(json::json_pointer(target));
+        return compile(resolved, "#" + target);
+    }
+    catch (const std::exception& /*e*/)
+    {
+        unsupported_.push_back(schema_pointer + "/$ref");
+        return npos;
+    }
+}
+
+void ValidationPlan::compileKeywords(const json& schema, const std::string& schema_pointer, PlanNode& node)
+{
+    auto unsupported = [&](const std::string& keyword) { unsupported_.push_back(schema_pointer + "/" + keyword); };
+
+    auto readNumber = [&](const json& value, const std::string& keyword, bool& has, double& out) {
+        if (value.is_number())
+        {
+            has = true;
+            out = value.get<double>();
+        }
+        else
+        {
+            unsupported(keyword);
+        }
+    };
+
+    auto readCount = [&](const json& value, const std::string& keyword, bool& has, std::size_t& out) {
+        if (value.is_number_integer() && value.get<std::int64_t>() >= 0)
+        {
+            has = true;
+            out = value.get<std::size_t>();
+        }
+        else
+        {
+            unsupported(keyword);
+        }
+    };
+
+    auto compileArray = [&](const json& value, const std::string& keyword, std::vector<std::size_t>& out) {
+        if (!value.is_array() || value.empty())
+        {
+            unsupported(keyword);
+            return;
+        }
+        for (std::size_t i = 0; i < value.size(); ++i)
+        {
+            out.push_back(compile(value[i], schema_pointer + "/" + keyword + "/" + std::to_string(i)));
+        }
+    };
+
+    for (auto it = schema.begin(); it != schema.end(); ++it)
+    {
+        const std::string& keyword = it.key();
+        const json& value = it.value();
+
+        if (keyword == "type")
+        {
+            const json names = value.is_array() ? value : json::array({value});
+            for (const auto& name : names)
+            {
+                const std::uint32_t bit = name.is_string() ? typeBitFromName(name.get<std::string>()) : 0u;
+                if (bit == 0u)
+                {
+                    unsupported(keyword);
+                }
+                node.type_mask |= bit;
+            }
+        }
+        else if (keyword == "minimum")
+        {
+            readNumber(value, keyword, node.has_minimum, node.minimum);
+        }
+        else if (keyword == "maximum")
+        {
+            readNumber(value, keyword, node.has_maximum, node.maximum);
+        }
+        else if (keyword == "exclusiveMinimum")
+        {
+            readNumber(value, keyword, node.has_exclusive_minimum, node.exclusive_minimum);
+        }
+        else if (keyword == "exclusiveMaximum")
+        {
+            readNumber(value, keyword, node.has_exclusive_maximum, node.exclusive_maximum);
+        }
+        else if (keyword == "multipleOf")
+        {
+            readNumber(value, keyword, node.has_multiple_of, node.multiple_of);
+            if (node.has_multiple_of && !(node.multiple_of > 0.0))
+            {
+                unsupported(keyword);
+            }
+        }
+        else if (keyword == "minLength")
+        {
+            readCount(value, keyword, node.has_min_length, node.min_length);
+        }
+        else if (keyword == "maxLength")
+        {
+            readCount(value, keyword, node.has_max_length, node.max_length);
+        }
+        else if (keyword == "minItems")
+        {
+            readCount(value, keyword, node.has_min_items, node.min_items);
+        }
+        else if (keyword == "maxItems")
+        {
+            readCount(value, keyword, node.has_max_items, node.max_items);
+        }
+        else if (keyword == "minProperties")
+        {
+            readCount(value, keyword, node.has_min_properties, node.min_properties);
+        }
+        else if (keyword == "maxProperties")
+        {
+            readCount(value, keyword, node.has_max_properties, node.max_properties);
+        }
+        else if (keyword == "pattern")
+        {
+            try
+            {
+                node.pattern_source = value.get<std::string>();
+                node.pattern = compilePattern(node.pattern_source);
+            }
+            catch (const std::exception& /*e*/)
+            {
+                unsupported(keyword);
+            }
+        }
+        else if (keyword == "enum")
+        {
+            if (value.is_array())
+            {
+                node.has_enum = true;
+                node.enum_values.assign(value.begin(), value.end());
+            }
+            else
+            {
+                unsupported(keyword);
+            }
+        }
+        else if (keyword == "const")
+        {
+            node.has_const = true;
+            node.const_value = value;
+        }
+        else if (keyword == "items")
+        {
+            if (value.is_array())
+            {
+                node.tuple_form = true;
+                for (std::size_t i = 0; i < value.size(); ++i)
+                {
+                    node.tuple_items.push_back(compile(value[i], schema_pointer + "/items/" + std::to_string(i)));
+                }
+            }
+            else
+            {
+                node.items = compile(value, schema_pointer + "/items");
+            }
+        }
+        else if (keyword == "additionalItems")
+        {
+            // Only meaningful next to an array "items"; validateNode checks tuple_form
+            if (value.is_boolean())
+            {
+                node.additional_items_allowed = value.get<bool>();
+            }
+            else
+            {
+                node.additional_items = compile(value, schema_pointer + "/additionalItems");
+            }
+        }
+        else if (keyword == "contains")
+        {
+            node.contains = compile(value, schema_pointer + "/contains");
+        }
+        else if (keyword == "uniqueItems")
+        {
+            if (value.is_boolean())
+            {
+                node.unique_items = value.get<bool>();
+            }
+            else
+            {
+                unsupported(keyword);
+            }
+        }
+        else if (keyword == "required")
+        {
+            if (!value.is_array())
+            {
+                unsupported(keyword);
+                continue;
+            }
+            for (const auto& name : value)
+            {
+                if (name.is_string())
+                {
+                    if (node.required_index.emplace(name.get<std::string>(), node.required.size()).second)
+                    {
+                        node.required.push_back(name.get<std::string>());
+                    }
+                }
+                else
+                {
+                    unsupported(keyword);
+                }
+            }
+        }
+        else if (keyword == "properties")
+        {
+            if (!value.is_object())
+            {
+                unsupported(keyword);
+                continue;
+            }
+            for (auto prop = value.begin(); prop != value.end(); ++prop)
+            {
+                std::string child_pointer = schema_pointer + "/properties";
+                appendPointerToken(child_pointer, prop.key());
+                node.properties.emplace(prop.key(), compile(prop.value(), child_pointer));
+            }
+        }
+        else if (keyword == "additionalProperties")
+        {
+            if (value.is_boolean())
+            {
+                node.additional_allowed = value.get<bool>();
+            }
+            else
+            {
+                node.additional = compile(value, schema_pointer + "/additionalProperties");
+            }
+        }
+        else if (keyword == "patternProperties")
+        {
+            if (!value.is_object())
+            {
+                unsupported(keyword);
+                continue;
+            }
+            for (auto prop = value.begin(); prop != value.end(); ++prop)
+            {
+                std::string child_pointer = schema_pointer + "/patternProperties";
+                appendPointerToken(child_pointer, prop.key());
+                try
+                {
+                    node.pattern_properties.push_back(
+                        PlanPatternProperty{compilePattern(prop.key()), compile(prop.value(), child_pointer)});
+                }
+                catch (const std::exception& /*e*/)
+                {
+                    unsupported(keyword);
+                }
+            }
+        }
+        else if (keyword == "propertyNames")
+        {
+            node.property_names = compile(value, schema_pointer + "/propertyNames");
+        }
+        else if (keyword == "allOf")
+        {
+            compileArray(value, keyword, node.all_of);
+        }
+        else if (keyword == "anyOf")
+        {
+            compileArray(value, keyword, node.any_of);
+        }
+        else if (keyword == "oneOf")
+        {
+            compileArray(value, keyword, node.one_of);
+        }
+        else if (keyword == "not")
+        {
+            node.not_node = compile(value, schema_pointer + "/not");
+        }
+        else if (keyword == "dependencies")
+        {
+            if (!value.is_object())
+            {
+                unsupported(keyword);
+                continue;
+            }
+            for (auto dep = value.begin(); dep != value.end(); ++dep)
+            {
+                PlanDependency dependency;
+                dependency.property = dep.key();
+                if (dep.value().is_array())
+                {
+                    for (const auto& name : dep.value())
+                    {
+                        if (name.is_string())
+                        {
+                            dependency.required.push_back(name.get<std::string>());
+                        }
+                        else
+                        {
+                            unsupported(keyword);
+                        }
+                    }
+                }
+                else
+                {
+                    std::string child_pointer = schema_pointer + "/dependencies";
+                    appendPointerToken(child_pointer, dep.key());
+                    dependency.schema = compile(dep.value(), child_pointer);
+                }
+                node.dependencies.push_back(std::move(dependency));
+            }
+        }
+        else if (keyword == "if")
+        {
+            // "then"/"else" are only meaningful next to "if"; alone they are ignored per Draft 7
+            node.if_node = compile(value, schema_pointer + "/if");
+            const auto then_schema = schema.find("then");
+            if (then_schema != schema.end())
+            {
+                node.then_node = compile(*then_schema, schema_pointer + "/then");
+            }
+            const auto else_schema = schema.find("else");
+            if (else_schema != schema.end())
+            {
+                node.else_node = compile(*else_schema, schema_pointer + "/else");
+            }
+        }
+    }
+}
+
+std::shared_ptr<const validators::CompiledRegex> ValidationPlan::compilePattern(const std::string& source)
+{
+    // OPTIMIZATION: Bundled schemas repeat a $ref target's pattern at every use
+    // site; each distinct source is compiled once and shared. Patterns run on the
+    // linear-time engine (std::regex only for backreferences and lookaround);
+    // JSON Schema patterns are searches, so each is wrapped to match anywhere
+    auto& compiled = regexes_[source];
+    if (!compiled)
+    {
+        // The bare pattern is compiled first so that one the wrapper would
+        // balance ("a)(b") is still rejected as invalid
+        (void)validators::CompiledRegex::compile(source, validators::RegexBackend::Linear);
+        compiled = validators::CompiledRegex::compile(kSearchPrefix + source + kSearchSuffix,
+                                                      validators::RegexBackend::Linear);
+    }
+    return compiled;
+}
+
+bool ValidationPlan::validate(const json& instance, const ValidationErrorHandler& handler) const
+{
+    std::string path;
+    return validateNode(root(), instance, path, handler ? &handler : nullptr);
+}
+
+bool ValidationPlan::isValid(const json& instance) const
+{
+    std::string path;
+    return validateNode(root(), instance, path, nullptr);
+}
+
+bool ValidationPlan::validateNode(std::size_t index, const json& instance, std::string& path,
+                                  const ValidationErrorHandler* handler, ValidationMemo* memo) const
+{
+    const PlanNode& node = nodes_[index];
+    if (node.ref != npos)
+    {
+        return validateNode(node.ref, instance, path, handler, memo);
+    }
+
+    bool valid = true;
+
+    // Returns true when the caller should stop: without a handler only the verdict matters.
+    // Messages are built lazily so silent checks (anyOf/oneOf/not branches) never format text.
+    auto fail = [&](ValidationErrorType type, auto&& make_message) -> bool {
+        valid = false;
+        if (handler == nullptr)
+        {
+            return true;
+        }
+        (*handler)(ValidationError(path, type, make_message(), ""));
+        return false;
+    };
+
+    // Validates a child at path + "/" + token (a member name or an item index), restoring
+    // path afterwards; a silent check never reports a path, so it does not build one
+    auto child = [&](std::size_t child_index, const json& child_instance, const auto& token) -> bool {
+        const std::size_t length = path.size();
+        if (handler != nullptr)
+        {
+            appendToken(path, token);
+        }
+        const bool ok = memo != nullptr ? memo->validateNode(child_index, child_instance, path, handler)
+                                        : validateNode(child_index, child_instance, path, handler);
+        path.resize(length);
+        if (!ok)
+        {
+            valid = false;
+        }
+        return !ok && handler == nullptr;
+    };
+
+    if (node.reject_all)
+    {
+        fail(ValidationErrorType::CustomValidationFailed, [] { return std::string("No value is allowed here"); });
+        return false;
+    }
+
+    if (node.type_mask != 0u && (instanceTypeBits(instance) & node.type_mask) == 0u)
+    {
+        if (fail(ValidationErrorType::TypeMismatch, [&] {
+                return "Expected " + typeNames(node.type_mask) + " but got " + std::string(instance.type_name());
+            }))
+        {
+            return false;
+        }
+    }
+
+    if (node.has_enum && std::find(node.enum_values.begin(), node.enum_values.end(), instance) == node.enum_values.end())
+    {
+        if (fail(ValidationErrorType::EnumViolation, [&] { return "Value " + instance.dump() + " is not one of the allowed values"; }))
+        {
+            return false;
+        }
+    }
+
+    if (node.has_const && instance != node.const_value)
+    {
+        if (fail(ValidationErrorType::EnumViolation, [&] { return "Value must be " + node.const_value.dump(); }))
+        {
+            return false;
+        }
+    }
+
+    if (instance.is_number())
+    {
+        const double value = instance.get<double>();
+        if (node.has_minimum && value < node.minimum &&
+            fail(ValidationErrorType::MinimumViolation,
+                 [&] { return "Value " + instance.dump() + " is less than minimum " + formatNumber(node.minimum); }))
+        {
+            return false;
+        }
+        if (node.has_exclusive_minimum && !(value > node.exclusive_minimum) &&
+            fail(ValidationErrorType::MinimumViolation, [&] {
+                return "Value " + instance.dump() + " must be greater than " + formatNumber(node.exclusive_minimum);
+            }))
+        {
+            return false;
+        }
+        if (node.has_maximum && value > node.maximum &&
+            fail(ValidationErrorType::MaximumViolation,
+                 [&] { return "Value " + instance.dump() + " exceeds maximum " + formatNumber(node.maximum); }))
+        {
+            return false;
+        }
+        if (node.has_exclusive_maximum && !(value < node.exclusive_maximum) &&
+            fail(ValidationErrorType::MaximumViolation, [&] {
+                return "Value " + instance.dump() + " must be less than " + formatNumber(node.exclusive_maximum);
+            }))
+        {
+            return false;
+        }
+        if (node.has_multiple_of)
+        {
+            const double quotient = value / node.multiple_of;
+            if (std::fabs(quotient - std::round(quotient)) > 1e-9 &&
+                fail(ValidationErrorType::CustomValidationFailed, [&] {
+                    return "Value " + instance.dump() + " is not a multiple of " + formatNumber(node.multiple_of);
+                }))
+            {
+                return false;
+            }
+        }
+    }
+    else if (instance.is_string())
+    {
+        const auto& text = instance.get_ref<const std::string&>();
+        if (node.has_min_length || node.has_max_length)
+        {
+            const std::size_t length = utf8Length(text);
+            if (node.has_min_length && length < node.min_length &&
+                fail(ValidationErrorType::MinLengthViolation,
+                     [&] { return "String is shorter than " + std::to_string(node.min_length) + " characters"; }))
+            {
+                return false;
+            }
+            if (node.has_max_length && length > node.max_length &&
+                fail(ValidationErrorType::MaxLengthViolation,
+                     [&] { return "String is longer than " + std::to_string(node.max_length) + " characters"; }))
+            {
+                return false;
+            }
+        }
+        if (node.pattern && !node.pattern->fullMatch(text) &&
+            fail(ValidationErrorType::PatternMismatch,
+                 [&] { return "String does not match pattern " + node.pattern_source; }))
+        {
+            return false;
+        }
+    }
+    else if (instance.is_array())
+    {
+        const std::size_t size = instance.size();
+        if (node.has_min_items && size < node.min_items &&
+            fail(ValidationErrorType::MinLengthViolation,
+                 [&] { return "Array has fewer than " + std::to_string(node.min_items) + " items"; }))
+        {
+            return false;
+        }
+        if (node.has_max_items && size > node.max_items &&
+            fail(ValidationErrorType::MaxLengthViolation,
+                 [&] { return "Array has more than " + std::to_string(node.max_items) + " items"; }))
+        {
+            return false;
+        }
+        if (node.items != npos)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                if (child(node.items, instance[i], i))
+                {
+                    return false;
+                }
+            }
+        }
+        for (std::size_t i = 0; i < std::min(size, node.tuple_items.size()); ++i)
+        {
+            if (child(node.tuple_items[i], instance[i], i))
+            {
+                return false;
+            }
+        }
+        if (node.tuple_form && node.items == npos)
+        {
+            for (std::size_t i = node.tuple_items.size(); i < size; ++i)
+            {
+                if (node.additional_items != npos)
+                {
+                    if (child(node.additional_items, instance[i], i))
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+                if (node.additional_items_allowed)
+                {
+                    break;
+                }
+                const std::size_t length = path.size();
+                appendToken(path, i);
+                const bool stop = fail(ValidationErrorType::CustomValidationFailed,
+                                       [&] { return "Item " + std::to_string(i) + " is not allowed"; });
+                path.resize(length);
+                if (stop)
+                {
+                    return false;
+                }
+            }
+        }
+        if (node.contains != npos &&
+            std::none_of(instance.begin(), instance.end(),
+                         [&](const json& item) { return validateNode(node.contains, item, path, nullptr, memo); }) &&
+            fail(ValidationErrorType::CustomValidationFailed,
+                 [] { return std::string("Array does not contain a matching item"); }))
+        {
+            return false;
+        }
+        if (node.unique_items && size > 1)
+        {
+            // OPTIMIZATION: One hash index per array instead of comparing every pair of items
+            InstanceIndex seen;
+            seen.reserve(size);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                const std::size_t first = seen.insert(instance[i], i);
+                if (first == InstanceIndex::npos)
+                {
+                    continue;
+                }
+                const std::size_t length = path.size();
+                appendPointerToken(path, std::to_string(i));
+                const bool stop = fail(ValidationErrorType::CustomValidationFailed, [&] {
+                    return "Item " + std::to_string(i) + " duplicates item " + std::to_string(first);
+                });
+                path.resize(length);
+                if (stop)
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    else if (instance.is_object())
+    {
+        const std::size_t size = instance.size();
+        if (node.has_min_properties && size < node.min_properties &&
+            fail(ValidationErrorType::MinLengthViolation,
+                 [&] { return "Object has fewer than " + std::to_string(node.min_properties) + " properties"; }))
+        {
+            return false;
+        }
+        if (node.has_max_properties && size > node.max_properties &&
+            fail(ValidationErrorType::MaxLengthViolation,
+                 [&] { return "Object has more than " + std::to_string(node.max_properties) + " properties"; }))
+        {
+            return false;
+        }
+
+        // One pass over the instance: each member is matched to its property schema by hash
+        // lookup, and required members are counted (ordered_json's own lookup is linear)
+        std::size_t required_present = 0;
+        for (auto it = instance.begin(); it != instance.end(); ++it)
+        {
+            if (!node.required_index.empty() && node.required_index.count(it.key()) != 0)
+            {
+                ++required_present;
+            }
+
+            if (!validateMember(index, it.key(), it.value(), path, handler, memo))
+            {
+                valid = false;
+                if (handler == nullptr)
+                {
+                    return false;
+                }
+            }
+        }
+
+        if (required_present < node.required.size())
+        {
+            for (const auto& name : node.required)
+            {
+                if (!instance.contains(name))
+                {
+                    // Reported at the missing member's own pointer so forms can flag the field
+                    const std::size_t length = path.size();
+                    appendPointerToken(path, name);
+                    const bool stop = fail(ValidationErrorType::Required,
+                                           [&] { return "Required property '" + name + "' is missing"; });
+                    path.resize(length);
+                    if (stop)
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        for (const auto& dependency : node.dependencies)
+        {
+            if (!validateDependency(dependency, instance, path, handler, memo))
+            {
+                valid = false;
+                if (handler == nullptr)
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    for (const std::size_t sub : node.all_of)
+    {
+        if (!validateNode(sub, instance, path, handler, memo))
+        {
+            valid = false;
+            if (handler == nullptr)
+            {
+                return false;
+            }
+        }
+    }
+
+    if (!node.any_of.empty())
+    {
+        const bool matched = std::any_of(node.any_of.begin(), node.any_of.end(), [&](std::size_t sub) {
+            return validateNode(sub, instance, path, nullptr, memo);
+        });
+        if (!matched && fail(ValidationErrorType::CustomValidationFailed,
+                             [] { return std::string("Value does not match any of the allowed schemas"); }))
+        {
+            return false;
+        }
+    }
+
+    if (!node.one_of.empty())
+    {
+        std::size_t matches = 0;
+        for (const std::size_t sub : node.one_of)
+        {
+            if (validateNode(sub, instance, path, nullptr, memo) && ++matches > 1)
+            {
+                break;
+            }
+        }
+        if (matches != 1 && fail(ValidationErrorType::CustomValidationFailed, [&] {
+                return std::string(matches == 0 ? "Value does not match any of the allowed schemas"
+                                                : "Value matches more than one exclusive schema");
+            }))
+        {
+            return false;
+        }
+    }
+
+    if (node.not_node != npos && validateNode(node.not_node, instance, path, nullptr, memo) &&
+        fail(ValidationErrorType::CustomValidationFailed, [] { return std::string("Value matches a disallowed schema"); }))
+    {
+        return false;
+    }
+
+    if (node.if_node != npos && !validateConditional(node, instance, path, handler, memo))
+    {
+        return false;
+    }
+
+    return valid;
+}
+
+bool ValidationPlan::validateMember(std::size_t index, const std::string& name, const json& value,
+                                    std::string& path, const ValidationErrorHandler* handler,
+                                    ValidationMemo* memo) const
+{
+    const PlanNode& node = nodes_[resolveRef(index)];
+    bool valid = true;
+
+    // Same conventions as validateNode's child(): silent checks build no paths
+    const std::size_t length = path.size();
+    if (handler != nullptr)
+    {
+        appendPointerToken(path, name);
+    }
+    auto check = [&](std::size_t child_index, const json& instance) {
+        const bool ok = memo != nullptr ? memo->validateNode(child_index, instance, path, handler)
+                                        : validateNode(child_index, instance, path, handler);
+        valid = valid && ok;
+        return ok || handler != nullptr;  // Keep going only when collecting
+    };
+
+    bool described = false;
+    const bool keep_going = [&] {
+        if (node.property_names != npos && !check(node.property_names, json(name)))
+        {
+            return false;
+        }
+        const auto property = node.properties.find(name);
+        if (property != node.properties.end())
+        {
+            described = true;
+            if (!check(property->second, value))
+            {
+                return false;
+            }
+        }
+        for (const auto& pattern : node.pattern_properties)
+        {
+            if (pattern.regex->fullMatch(name))
+            {
+                described = true;
+                if (!check(pattern.schema, value))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }();
+
+    if (keep_going && !described)
+    {
+        if (node.additional != npos)
+        {
+            check(node.additional, value);
+        }
+        else if (!node.additional_allowed)
+        {
+            valid = false;
+            if (handler != nullptr)
+            {
+                (*handler)(ValidationError(path, ValidationErrorType::CustomValidationFailed,
+                                           "Property '" + name + "' is not allowed", ""));
+            }
+        }
+    }
+    path.resize(length);
+    return valid;
+}
+
+bool ValidationPlan::validateDependency(const PlanDependency& dependency, const json& instance, std::string& path,
+                                        const ValidationErrorHandler* handler, ValidationMemo* memo) const
+{
+    if (!instance.is_object() || !instance.contains(dependency.property))
+    {
+        return true;
+    }
+
+    bool valid = true;
+    for (const auto& name : dependency.required)
+    {
+        if (instance.contains(name))
+        {
+            continue;
+        }
+        valid = false;
+        if (handler == nullptr)
+        {
+            return false;
+        }
+        // Reported at the missing member, like "required"
+        const std::size_t length = path.size();
+        appendPointerToken(path, name);
+        (*handler)(ValidationError(path, ValidationErrorType::Required,
+                                   "Property '" + name + "' is required when '" + dependency.property +
+                                       "' is present",
+                                   ""));
+        path.resize(length);
+    }
+    if (dependency.schema != npos && !validateNode(dependency.schema, instance, path, handler, memo))
+    {
+        valid = false;
+    }
+    return valid;
+}
+
+bool ValidationPlan::validateConditional(const PlanNode& node, const json& instance, std::string& path,
+                                         const ValidationErrorHandler* handler, ValidationMemo* memo) const
+{
+    if (node.if_node == npos)
+    {
+        return true;
+    }
+    const std::size_t branch = validateNode(node.if_node, instance, path, nullptr, memo) ? node.then_node : node.else_node;
+    return branch == npos || validateNode(branch, instance, path, handler, memo);
+}
+
+} // namespace core
+} // namespace configgui
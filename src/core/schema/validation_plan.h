@@ -0,0 +1,226 @@
+// SPDX-License-Identifier: MIT
+// ValidationPlan - JSON Schema compiled into a flat array of checks
+
+#pragma once
+
+#include "../error_types.h"
+#include "validation_error.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::ordered_json;
+
+namespace configgui {
+namespace validators {
+class CompiledRegex;
+} // namespace validators
+
+namespace core {
+
+/// @brief Receives each violation found during a collecting validation pass
+/// The error's field() is the JSON Pointer of the offending instance ("" = document root)
+using ValidationErrorHandler = std::function<void(const ValidationError&)>;
+
+class ValidationMemo;
+
+/// @brief One "dependencies" entry: what the presence of a property demands of its object
+struct PlanDependency
+{
+    std::string property;                ///< Trigger property
+    std::vector<std::string> required;   ///< Array form: members that must also be present
+    std::size_t schema = static_cast<std::size_t>(-1);  ///< Schema form: node the object must match
+};
+
+/// @brief One "patternProperties" entry: members whose name matches regex must match schema
+struct PlanPatternProperty
+{
+    std::shared_ptr<const validators::CompiledRegex> regex;  ///< Search semantics, like "pattern"
+    std::size_t schema = static_cast<std::size_t>(-1);
+};
+
+/// @brief One compiled sub-schema: every keyword pre-parsed into typed constraints
+struct PlanNode
+{
+    /// @brief Bit per JSON type accepted by "type" (see ValidationPlan::TypeBit)
+    std::uint32_t type_mask = 0;
+
+    /// @brief Boolean schema `false`: every instance fails
+    bool reject_all = false;
+
+    /// @brief Target of "$ref" (npos = none); sibling keywords are ignored per Draft 7
+    std::size_t ref = static_cast<std::size_t>(-1);
+
+    bool has_minimum = false;
+    bool has_maximum = false;
+    bool has_exclusive_minimum = false;
+    bool has_exclusive_maximum = false;
+    bool has_multiple_of = false;
+    double minimum = 0.0;
+    double maximum = 0.0;
+    double exclusive_minimum = 0.0;
+    double exclusive_maximum = 0.0;
+    double multiple_of = 0.0;
+
+    bool has_min_length = false;
+    bool has_max_length = false;
+    std::size_t min_length = 0;
+    std::size_t max_length = 0;
+
+    std::shared_ptr<const validators::CompiledRegex> pattern;  ///< Search semantics (see compileKeywords)
+    std::string pattern_source;
+
+    bool has_enum = false;
+    std::vector<json> enum_values;
+    bool has_const = false;
+    json const_value;
+
+    bool has_min_items = false;
+    bool has_max_items = false;
+    std::size_t min_items = 0;
+    std::size_t max_items = 0;
+    std::size_t items = static_cast<std::size_t>(-1);
+    std::vector<std::size_t> tuple_items;
+    bool tuple_form = false;  ///< "items" is an array, so "additionalItems" applies
+    bool additional_items_allowed = true;
+    std::size_t additional_items = static_cast<std::size_t>(-1);
+    std::size_t contains = static_cast<std::size_t>(-1);
+    bool unique_items = false;
+
+    bool has_min_properties = false;
+    bool has_max_properties = false;
+    std::size_t min_properties = 0;
+    std::size_t max_properties = 0;
+    std::vector<std::string> required;
+    std::unordered_map<std::string, std::size_t> required_index;  ///< Name -> position in required
+    std::unordered_map<std::string, std::size_t> properties;
+    std::vector<PlanPatternProperty> pattern_properties;
+    std::size_t property_names = static_cast<std::size_t>(-1);
+    bool additional_allowed = true;
+    std::size_t additional = static_cast<std::size_t>(-1);
+    std::vector<PlanDependency> dependencies;
+
+    std::vector<std::size_t> all_of;
+    std::vector<std::size_t> any_of;
+    std::vector<std::size_t> one_of;
+    std::size_t not_node = static_cast<std::size_t>(-1);
+    std::size_t if_node = static_cast<std::size_t>(-1);
+    std::size_t then_node = static_cast<std::size_t>(-1);
+    std::size_t else_node = static_cast<std::size_t>(-1);
+};
+
+/// @brief JSON Schema (Draft 7) compiled once into a flat, index-linked node array
+///
+/// OPTIMIZATION: Keywords are parsed, regexes compiled and local $refs resolved
+/// at compile time, so validation is a walk over pre-built nodes that reports
+/// every violation (with its JSON Pointer) in a single pass instead of stopping
+/// at the first one.
+///
+/// Keywords the plan does not implement are recorded in unsupportedKeywords();
+/// callers must fall back to a full validator when isComplete() is false.
+class ValidationPlan
+{
+public:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    /// @brief JSON type bits used in PlanNode::type_mask
+    enum TypeBit : std::uint32_t
+    {
+        NullType = 1u << 0,
+        BooleanType = 1u << 1,
+        IntegerType = 1u << 2,
+        NumberType = 1u << 3,
+        StringType = 1u << 4,
+        ArrayType = 1u << 5,
+        ObjectType = 1u << 6
+    };
+
+    /// @brief Compile a root schema
+    explicit ValidationPlan(const json& root_schema);
+
+    /// @brief True when every validation keyword in the schema is implemented
+    [[nodiscard]] bool isComplete() const { return unsupported_.empty(); }
+
+    /// @brief Keywords (with schema location) that prevented a complete compile
+    [[nodiscard]] const std::vector<std::string>& unsupportedKeywords() const { return unsupported_; }
+
+    /// @brief Number of compiled nodes
+    [[nodiscard]] std::size_t nodeCount() const { return nodes_.size(); }
+
+    /// @brief Access a compiled node
+    [[nodiscard]] const PlanNode& node(std::size_t index) const { return nodes_[index]; }
+
+    /// @brief Index of the root node
+    [[nodiscard]] std::size_t root() const { return 0; }
+
+    /// @brief Validate an instance, reporting every violation to handler
+    /// @return True if the instance is valid
+    bool validate(const json& instance, const ValidationErrorHandler& handler) const;
+
+    /// @brief Check an instance without reporting anything
+    /// OPTIMIZATION: Stops at the first violation and builds no messages or paths
+    [[nodiscard]] bool isValid(const json& instance) const;
+
+    /// @brief Validate an instance against one node
+    /// @param path JSON Pointer of instance, used as the prefix of reported paths
+    /// @param handler Receives violations; nullptr = stop at the first one
+    /// @param memo Optional result cache consulted for child instances
+    /// @return True if the instance is valid
+    bool validateNode(std::size_t index, const json& instance, std::string& path,
+                      const ValidationErrorHandler* handler, ValidationMemo* memo = nullptr) const;
+
+    /// @brief Validate one member of an object against the object node's member keywords
+    /// ("propertyNames", "properties", every matching "patternProperties", otherwise
+    /// "additionalProperties"). Shared with SchemaValidator::validateField and
+    /// IncrementalValidator so single-field checks agree with a full pass.
+    /// @param index Node the object is validated against
+    /// @param path JSON Pointer of the object; the member's pointer is reported
+    /// @return True if the member is valid
+    bool validateMember(std::size_t index, const std::string& name, const json& value, std::string& path,
+                        const ValidationErrorHandler* handler, ValidationMemo* memo = nullptr) const;
+
+    /// @brief Check one "dependencies" entry against an object
+    /// Shared with ConstraintEngine so cross-field rules report the same errors as a full pass
+    /// @return True if the entry is satisfied (always true when its property is absent)
+    bool validateDependency(const PlanDependency& dependency, const json& instance, std::string& path,
+                            const ValidationErrorHandler* handler, ValidationMemo* memo = nullptr) const;
+
+    /// @brief Check a node's "if"/"then"/"else" against an instance
+    /// @return True if the branch selected by "if" is satisfied (or the node has no "if")
+    bool validateConditional(const PlanNode& node, const json& instance, std::string& path,
+                             const ValidationErrorHandler* handler, ValidationMemo* memo = nullptr) const;
+
+    /// @brief Find the node that validates the instance at a JSON Pointer ("" = root)
+    /// OPTIMIZATION: Property paths are answered from a table built at compile time;
+    /// paths through array elements are resolved by walking the node links.
+    /// A member covered by several schemas (a property that also matches a
+    /// "patternProperties" entry) maps to the first; see validateMember()
+    /// @return Node index, or npos when the schema does not describe that location
+    [[nodiscard]] std::size_t findNode(const std::string& pointer) const;
+
+    /// @brief Append one escaped reference token to a JSON Pointer
+    static void appendPointerToken(std::string& pointer, const std::string& token);
+
+private:
+    std::size_t compile(const json& schema, const std::string& schema_pointer);
+    std::size_t compileRef(const std::string& ref, const std::string& schema_pointer);
+    void compileKeywords(const json& schema, const std::string& schema_pointer, PlanNode& node);
+    [[nodiscard]] std::shared_ptr<const validators::CompiledRegex> compilePattern(const std::string& source);
+    void indexPaths(std::size_t index, std::string& pointer, std::vector<bool>& on_path);
+    [[nodiscard]] std::size_t resolveRef(std::size_t index) const;
+
+    const json* root_ = nullptr;  ///< Valid during construction only (resolves $ref)
+    std::vector<PlanNode> nodes_;
+    std::unordered_map<std::string, std::size_t> compiled_;
+    std::unordered_map<std::string, std::shared_ptr<const validators::CompiledRegex>> regexes_;  ///< Construction only
+    std::unordered_map<std::string, std::size_t> path_index_;  ///< Instance pointer -> node
+    std::vector<std::string> unsupported_;
+};
+
+} // namespace core
+} // namespace configgui
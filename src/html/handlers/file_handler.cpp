@@ -1,4 +1,5 @@
 #include "file_handler.h"
+#include "core/io/configuration_writer.h"
 #include <filesystem>
 #include <fstream>
 #include <sstream>
@@ -12,6 +13,12 @@ namespace fs = std::filesystem;
 namespace configgui {
 namespace handlers {
 
+core::io::ConfigurationWriter& FileHandler::config_writer() {
+    // Shared across requests so its content-hash cache survives between saves
+    static core::io::ConfigurationWriter writer;
+    return writer;
+}
+
 std::string FileHandler::get_storage_directory() {
     // Store configs in ~/.configgui/configs
     const char* home = std::getenv("HOME");
@@ -142,30 +149,32 @@ void FileHandler::handle_save_config(const httplib::Request& req, httplib::Respo
         // Write file
         std::string full_path = storage_dir + "/" + filename;
         std::cout << "[FILE] Full path: " << full_path << std::endl;
-        std::ofstream outfile(full_path);
-        if (!outfile.is_open()) {
-            std::cout << "[FILE] Failed to open file for writing" << std::endl;
+        auto write_result = config_writer().write_file_content(full_path, file_content);
+        if (!write_result) {
+            std::cout << "[FILE] Write failed: " << write_result.error_msg_or_default() << std::endl;
             json response;
             response["success"] = false;
-            response["error"] = "Failed to open file for writing";
+            response["error"] = write_result.error_msg_or_default();
             res.set_content(response.dump(), "application/json");
             res.status = 500;
             return;
         }
-        std::cout << "[FILE] File opened successfully for writing" << std::endl;
-        
-        outfile << file_content;
-        outfile.close();
-        std::cout << "[FILE] File written and closed" << std::endl;
+        const bool unchanged = write_result.is_unchanged();
         
-        std::cout << "[FILE] Saved configuration to: " << full_path << " (format: " << format << ")" << std::endl;
+        if (unchanged) {
+            std::cout << "[FILE] Content unchanged, skipped rewrite of: " << full_path << std::endl;
+        } else {
+            std::cout << "[FILE] Saved configuration to: " << full_path << " (format: " << format << ")" << std::endl;
+        }
         
         json response;
         response["success"] = true;
         response["path"] = full_path;
         response["filename"] = filename;
         response["format"] = format;
-        response["message"] = "Configuration saved to server backup";
+        response["unchanged"] = unchanged;
+        response["message"] = unchanged ? "Configuration unchanged on server backup"
+                                        : "Configuration saved to server backup";
         
         res.set_content(response.dump(), "application/json");
         res.status = 200;
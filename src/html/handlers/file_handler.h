@@ -6,6 +6,10 @@
 #include <vector>
 
 namespace configgui {
+namespace core::io {
+class ConfigurationWriter;
+}
+
 namespace handlers {
 
 class FileHandler {
@@ -13,7 +17,8 @@ public:
     /**
      * Handle POST /api/config/save - Save configuration to server
      * Request body: { "filename": "config.json", "data": {...} }
-     * Response: { "success": true, "path": "/path/to/config.json", "message": "..." }
+     * Response: { "success": true, "path": "/path/to/config.json", "unchanged": false, "message": "..." }
+     * "unchanged" is true when the stored file already had identical content and was not rewritten
      */
     static void handle_save_config(const httplib::Request& req, httplib::Response& res);
     
@@ -36,6 +41,9 @@ public:
     static void handle_delete_config(const httplib::Request& req, httplib::Response& res, const std::string& filename);
     
 private:
+    // Process-wide atomic writer (durable saves, skips unchanged content)
+    static core::io::ConfigurationWriter& config_writer();
+    
     // Get storage directory for configurations
     static std::string get_storage_directory();
     
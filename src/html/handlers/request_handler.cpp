@@ -13,6 +13,12 @@ void RequestHandler::sendJson(httplib::Response& res, const json& data, int stat
     res.set_header("Content-Type", "application/json; charset=utf-8");
 }
 
+void RequestHandler::sendJson(httplib::Response& res, const nlohmann::ordered_json& data, int status) {
+    res.status = status;
+    res.set_content(data.dump(2), "application/json");
+    res.set_header("Content-Type", "application/json; charset=utf-8");
+}
+
 void RequestHandler::sendError(httplib::Response& res, const std::string& error,
                                int status, const json& details) {
     json response = {
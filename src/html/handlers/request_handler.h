@@ -26,6 +26,14 @@ public:
      */
     static void sendJson(httplib::Response& res, const json& data, int status = 200);
 
+    /**
+     * @brief Send a JSON response whose members keep their insertion order
+     * @param res HTTP response object
+     * @param data Ordered JSON data to send
+     * @param status HTTP status code (default: 200)
+     */
+    static void sendJson(httplib::Response& res, const nlohmann::ordered_json& data, int status = 200);
+
     /**
      * @brief Send an error JSON response
      * @param res HTTP response object
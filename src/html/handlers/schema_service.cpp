@@ -1,9 +1,44 @@
 #include "schema_service.h"
+#include "core/schema/compiled_schema_cache.h"
+#include "core/schema/schema_normalizer.h"
 #include <fstream>
 #include <iostream>
 #include <algorithm>
+#include <map>
+#include <mutex>
 #include <yaml-cpp/yaml.h>
 
+namespace {
+
+/// Response-ready schema for one compiled cache entry
+struct ResponseCacheEntry {
+    std::weak_ptr<const configgui::core::CompiledSchema> compiled;
+    std::shared_ptr<const json> response;
+};
+
+std::mutex responseCacheMutex;
+std::map<std::string, ResponseCacheEntry> responseCache;
+
+} // namespace
+
+std::shared_ptr<const json> SchemaService::loadCachedSchema(const std::string& filePath) {
+    auto compiled = configgui::core::CompiledSchemaCache::instance().get(filePath);
+    if (compiled.is_failure()) {
+        return nullptr;
+    }
+    const auto& entry = compiled.value();
+
+    // SchemaService is created per request, so the converted json is memoized
+    // process-wide and reused for as long as the compiled entry is current
+    std::lock_guard<std::mutex> lock(responseCacheMutex);
+    auto& slot = responseCache[filePath];
+    if (!slot.response || slot.compiled.lock() != entry) {
+        slot.compiled = entry;
+        slot.response = std::make_shared<const json>(json::parse(entry->json_text));
+    }
+    return slot.response;
+}
+
 // Initialize static members
 bool SchemaService::initialize(const std::string& schemaDir) {
     std::filesystem::path path{schemaDir};
@@ -75,25 +110,54 @@ json SchemaService::getSchema(const std::string& schemaId) const {
         return createError("Schema service not initialized");
     }
     
-    // Try with .json extension first
-    auto jsonPath = std::filesystem::path{schemaDir_} / (schemaId + ".json");
-    if (std::filesystem::exists(jsonPath)) {
-        return getSchemaByFilename(schemaId + ".json");
+    const std::string filename = findSchemaFile(schemaId);
+    if (filename.empty()) {
+        return createError("Schema not found", {{"id", schemaId}});
+    }
+    return getSchemaByFilename(filename);
+}
+
+nlohmann::ordered_json SchemaService::normalizeConfig(const std::string& schemaId, const std::string& configText,
+                                                      bool stripUnknown) const {
+    if (!initialized_) {
+        return nlohmann::ordered_json(createError("Schema service not initialized"));
     }
     
-    // Try with .yaml extension
-    auto yamlPath = std::filesystem::path{schemaDir_} / (schemaId + ".yaml");
-    if (std::filesystem::exists(yamlPath)) {
-        return getSchemaByFilename(schemaId + ".yaml");
+    const std::string filename = findSchemaFile(schemaId);
+    if (filename.empty()) {
+        return nlohmann::ordered_json(createError("Schema not found", {{"id", schemaId}}));
     }
     
-    // Try with .yml extension
-    auto ymlPath = std::filesystem::path{schemaDir_} / (schemaId + ".yml");
-    if (std::filesystem::exists(ymlPath)) {
-        return getSchemaByFilename(schemaId + ".yml");
+    auto compiled = configgui::core::CompiledSchemaCache::instance().get(
+        (std::filesystem::path{schemaDir_} / filename).string());
+    if (compiled.is_failure()) {
+        return nlohmann::ordered_json(createError("Invalid schema", {{"id", schemaId},
+                                                                     {"error", configgui::core::to_string(compiled.error())}}));
     }
     
-    return createError("Schema not found", {{"id", schemaId}});
+    // Parse with ordered_json so member order survives normalization
+    nlohmann::ordered_json config;
+    try {
+        config = nlohmann::ordered_json::parse(configText);
+    }
+    catch (const nlohmann::ordered_json::parse_error& e) {
+        return nlohmann::ordered_json(createError("Invalid JSON", {{"error", e.what()}}));
+    }
+    
+    configgui::core::NormalizeOptions options;
+    options.strip_unknown = stripUnknown;
+    configgui::core::NormalizeStats stats;
+    compiled.value()->normalizer->normalizeInPlace(config, options, &stats);
+    
+    // Built as ordered_json so "config" reaches the client in the order it was normalized
+    return nlohmann::ordered_json{
+        {"config", std::move(config)},
+        {"stats", {
+            {"defaultsFilled", stats.defaults_filled},
+            {"coerced", stats.coerced},
+            {"stripped", stats.stripped}
+        }}
+    };
 }
 
 json SchemaService::getSchemaByFilename(const std::string& filename) const {
@@ -121,16 +185,38 @@ json SchemaService::getSchemaByFilename(const std::string& filename) const {
     std::transform(extension.begin(), extension.end(), extension.begin(),
                    [](unsigned char c) { return std::tolower(c); });
     
-    if (extension == ".json") {
-        return parseJsonFile(fullPath.string());
-    }
-    else if (extension == ".yaml" || extension == ".yml") {
-        return parseYamlFile(fullPath.string());
+    if (extension == ".json" || extension == ".yaml" || extension == ".yml") {
+        // OPTIMIZATION: Unchanged schemas come from the shared compiled cache;
+        // the parser only runs again to report a detailed error
+        if (auto cached = loadCachedSchema(fullPath.string())) {
+            return *cached;
+        }
+        return (extension == ".json") ? parseJsonFile(fullPath.string())
+                                      : parseYamlFile(fullPath.string());
     }
     
     return createError("Unsupported file format", {{"filename", filename}, {"extension", extension}});
 }
 
+std::string SchemaService::findSchemaFile(const std::string& schemaId) const {
+    // Prevent directory traversal attacks
+    if (schemaId.empty() ||
+        schemaId.find("..") != std::string::npos ||
+        schemaId.find("/") != std::string::npos ||
+        schemaId.find("\\") != std::string::npos) {
+        return "";
+    }
+    
+    // Try .json first, then .yaml and .yml
+    for (const char* extension : {".json", ".yaml", ".yml"}) {
+        const std::string filename = schemaId + extension;
+        if (std::filesystem::exists(std::filesystem::path{schemaDir_} / filename)) {
+            return filename;
+        }
+    }
+    return "";
+}
+
 bool SchemaService::isInitialized() const {
     return initialized_;
 }
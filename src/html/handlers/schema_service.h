@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include <filesystem>
+#include <memory>
 #include <nlohmann/json.hpp>
 
 using json = nlohmann::json;
@@ -96,6 +97,27 @@ public:
      */
     json getSchema(const std::string& schemaId) const;
 
+    /**
+     * @brief Normalize a configuration against a schema
+     * 
+     * Fills schema defaults, coerces scalars to their declared types and, when
+     * requested, removes members the schema does not declare. Uses the
+     * schema's normalizer from the shared compiled schema cache, so clients get
+     * a ready-to-render document without walking the schema per field.
+     * 
+     * @param schemaId Schema identifier (basename without extension)
+     * @param configText Configuration as JSON text
+     * @param stripUnknown Remove members the schema does not declare
+     * @return {"config": {...}, "stats": {"defaultsFilled", "coerced", "stripped"}}
+     *         or error JSON; ordered, so "config" keeps the request's member
+     *         order with filled defaults in schema order
+     * 
+     * @example
+     * auto result = service.normalizeConfig("config.schema", R"({"port": "8080"})", false);
+     */
+    nlohmann::ordered_json normalizeConfig(const std::string& schemaId, const std::string& configText,
+                                           bool stripUnknown) const;
+
     /**
      * @brief Load schema by full filename
      * 
@@ -166,6 +188,23 @@ private:
     std::string schemaDir_;  ///< Schema directory path (absolute)
     bool initialized_;       ///< Whether initialize() was called successfully
 
+    /**
+     * @brief Find the schema file for an ID (.json, then .yaml, then .yml)
+     * 
+     * @param schemaId Schema identifier (basename without extension)
+     * @return Filename within the schema directory, or "" if none exists
+     */
+    std::string findSchemaFile(const std::string& schemaId) const;
+
+    /**
+     * @brief Load a schema through the process-wide compiled schema cache
+     * 
+     * @param filePath Absolute path to a JSON or YAML schema file
+     * @return Shared parsed schema, or nullptr if it cannot be loaded
+     *         (callers re-parse to build the detailed error response)
+     */
+    static std::shared_ptr<const json> loadCachedSchema(const std::string& filePath);
+
     /**
      * @brief Parse JSON file
      * 
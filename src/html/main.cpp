@@ -313,6 +313,34 @@ int main(int argc, char* argv[]) {
         RequestHandler::sendJson(res, schema);
     });
 
+    // Configuration normalization endpoint: fills schema defaults and coerces types
+    // POST /api/schemas/normalize?id=<schemaId>[&stripUnknown=true] with the config as body
+    g_server->post("/api/schemas/normalize", [config](const httplib::Request& req, httplib::Response& res) {
+        if (!req.has_param("id")) {
+            json errorResponse = SchemaService::createError("Missing 'id' parameter");
+            RequestHandler::sendJson(res, errorResponse, 400);
+            return;
+        }
+        const std::string schemaId = req.get_param_value("id");
+        const bool stripUnknown = req.has_param("stripUnknown") && req.get_param_value("stripUnknown") == "true";
+        
+        SchemaService schemaService;
+        if (!schemaService.initialize(config.schemaDir)) {
+            json errorResponse = SchemaService::createError("Schema directory not accessible");
+            RequestHandler::sendJson(res, errorResponse, 404);
+            return;
+        }
+        
+        const nlohmann::ordered_json response = schemaService.normalizeConfig(schemaId, req.body, stripUnknown);
+        if (response.contains("error")) {
+            const int status = (response["error"] == "Schema not found") ? 404 : 400;
+            RequestHandler::sendJson(res, response, status);
+            return;
+        }
+        
+        RequestHandler::sendJson(res, response);
+    });
+
     // Static asset serving for CSS and JavaScript
     g_server->get("/main.css", [](const httplib::Request& /*req*/, httplib::Response& res) {
         const std::vector<std::string> cssPaths = {
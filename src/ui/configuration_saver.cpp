@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: MIT
+// ConfigurationSaver - Implementation
+
+#include "configuration_saver.h"
+#include "core/io/configuration_writer.h"
+#include <QMutexLocker>
+#include <exception>
+
+namespace configgui {
+namespace ui {
+
+ConfigurationSaver::ConfigurationSaver(QObject* parent)
+    : QObject(parent)
+    , writer_(std::make_unique<core::io::ConfigurationWriter>())
+{
+    qRegisterMetaType<configgui::ui::SaveOutcome>("configgui::ui::SaveOutcome");
+    // Saves are I/O bound; a couple of workers keep different files independent
+    pool_.setMaxThreadCount(2);
+}
+
+ConfigurationSaver::~ConfigurationSaver()
+{
+    // Workers reference writer_; let in-flight saves finish before tearing down
+    pool_.waitForDone();
+}
+
+SaveOutcome ConfigurationSaver::save(const QString& file_path, const QByteArray& content, QString* error_message)
+{
+    const auto result = writer_->write_file_content(
+        file_path.toStdString(),
+        std::string(content.constData(), static_cast<std::size_t>(content.size())));
+
+    if (!result)
+    {
+        if (error_message)
+        {
+            *error_message = QString::fromStdString(result.error_msg_or_default());
+        }
+        return SaveOutcome::Failed;
+    }
+    return result.is_unchanged() ? SaveOutcome::Unchanged : SaveOutcome::Saved;
+}
+
+quint64 ConfigurationSaver::saveAsync(const QString& file_path, Serializer serializer)
+{
+    quint64 save_id = 0;
+    {
+        QMutexLocker lock(&in_flight_mutex_);
+        if (in_flight_.contains(file_path))
+        {
+            return 0;
+        }
+        in_flight_.insert(file_path);
+        save_id = ++last_save_id_;
+    }
+
+    pool_.start([this, save_id, file_path, serializer = std::move(serializer)]() {
+        SaveOutcome outcome = SaveOutcome::Failed;
+        QString error_message;
+
+        try
+        {
+            emit saveProgress(file_path, 0, tr("Serializing"));
+            const QByteArray content = serializer();
+
+            emit saveProgress(file_path, 50, tr("Writing"));
+            outcome = save(file_path, content, &error_message);
+        }
+        catch (const std::exception& e)
+        {
+            error_message = QString::fromStdString(e.what());
+        }
+
+        {
+            QMutexLocker lock(&in_flight_mutex_);
+            in_flight_.remove(file_path);
+        }
+
+        emit saveProgress(file_path, 100, tr("Done"));
+        emit saveFinished(save_id, file_path, outcome, error_message);
+    });
+
+    return save_id;
+}
+
+bool ConfigurationSaver::isSaving(const QString& file_path) const
+{
+    QMutexLocker lock(&in_flight_mutex_);
+    return in_flight_.contains(file_path);
+}
+
+} // namespace ui
+} // namespace configgui
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: MIT
+// ConfigurationSaver - Qt bridge to the core atomic configuration writer
+
+#pragma once
+
+#include <QByteArray>
+#include <QMetaType>
+#include <QMutex>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QThreadPool>
+#include <functional>
+#include <memory>
+
+namespace configgui {
+namespace core {
+namespace io {
+class ConfigurationWriter;
+}
+} // namespace core
+
+namespace ui {
+
+/// @brief Outcome of a configuration save
+enum class SaveOutcome
+{
+    Saved,      ///< Content was written to disk
+    Unchanged,  ///< File already held identical content; nothing was written
+    Failed      ///< Write failed; see error message
+};
+
+/// @brief Saves serialized configuration content through core::io::ConfigurationWriter
+///
+/// Lives in its own translation unit because core I/O headers alias `json`
+/// to nlohmann::json while the UI headers alias it to nlohmann::ordered_json.
+/// Keeps one writer per instance so its content-hash cache spans saves.
+///
+/// saveAsync() runs serialization and the atomic write on a private worker
+/// pool and reports back through signals, which are delivered on the
+/// receiver's (GUI) thread. Only one save per target path may be in flight.
+/// Each queued save gets an id that saveFinished reports back, so a receiver
+/// can match finishes to saves even when a new save to the same path starts
+/// before the previous finish has been delivered.
+class ConfigurationSaver : public QObject
+{
+    Q_OBJECT
+
+public:
+    /// @brief Produces the serialized bytes; runs on a worker thread
+    using Serializer = std::function<QByteArray()>;
+
+    explicit ConfigurationSaver(QObject* parent = nullptr);
+    ~ConfigurationSaver() override;
+
+    // Non-copyable
+    ConfigurationSaver(const ConfigurationSaver&) = delete;
+    ConfigurationSaver& operator=(const ConfigurationSaver&) = delete;
+
+    /// @brief Atomically write content to file_path, skipping identical content
+    /// @param file_path Target file
+    /// @param content Serialized configuration bytes (UTF-8)
+    /// @param error_message Receives the failure reason when Failed is returned
+    /// @return Save outcome
+    SaveOutcome save(const QString& file_path, const QByteArray& content, QString* error_message = nullptr);
+
+    /// @brief Serialize and save on a worker thread
+    /// @param file_path Target file
+    /// @param serializer Callable producing the content; must own its data snapshot
+    /// @return Id reported by saveFinished, or 0 if a save to the same path is
+    ///         already in flight (nothing queued)
+    quint64 saveAsync(const QString& file_path, Serializer serializer);
+
+    /// @brief Check whether a save to file_path is currently in flight
+    [[nodiscard]] bool isSaving(const QString& file_path) const;
+
+signals:
+    /// @brief Save progress for file_path (0-100) with a short stage description
+    void saveProgress(const QString& file_path, int percent, const QString& stage);
+
+    /// @brief Save save_id finished; error_message is empty unless outcome is Failed
+    void saveFinished(quint64 save_id, const QString& file_path, configgui::ui::SaveOutcome outcome,
+                      const QString& error_message);
+
+private:
+    std::unique_ptr<core::io::ConfigurationWriter> writer_;
+    QThreadPool pool_;
+    mutable QMutex in_flight_mutex_;
+    QSet<QString> in_flight_;
+    quint64 last_save_id_ = 0;  ///< Guarded by in_flight_mutex_
+};
+
+} // namespace ui
+} // namespace configgui
+
+Q_DECLARE_METATYPE(configgui::ui::SaveOutcome)
@@ -8,7 +8,9 @@
 #include "range_widget.h"
 #include "dictionary_widget.h"
 #include "object_array_widget.h"
-#include "rule_parser.h"
+#include "core/schema/rule_parser.h"
+#include "core/schema/schema_bundle.h"
+#include "core/schema/validation_plan.h"
 #include <QLineEdit>
 #include <QSpinBox>
 #include <QDoubleSpinBox>
@@ -42,12 +44,25 @@ FormGenerator::FormGenerator(QWidget* parent)
     layout_->setContentsMargins(10, 10, 10, 10);
 }
 
-bool FormGenerator::generateFromSchema(const json& schema)
+bool FormGenerator::generateFromSchema(const json& source_schema, std::shared_ptr<const core::SchemaBundle> bundle)
 {
     try {
         // Clear existing widgets
         clearForm();
 
+        // OPTIMIZATION: Resolve $refs once; the form is built from the inlined view
+        // and nested schemas are later found by path instead of re-walked
+        if (!bundle)
+        {
+            auto built = core::SchemaBundle::fromSchema(source_schema);
+            if (built.is_success())
+            {
+                bundle = std::make_shared<const core::SchemaBundle>(std::move(built).value());
+            }
+        }
+        bundle_ = std::move(bundle);
+        const json& schema = bundle_ ? bundle_->dereferenced() : source_schema;
+
         if (!schema.is_object() || !schema.contains("properties"))
         {
             qWarning() << "FormGenerator: Invalid schema - missing properties";
@@ -764,32 +779,54 @@ void FormGenerator::setFormData(const json& config_data)
     applyDataRecursive(config_data, "");
 
     is_dirty_ = false;
+    ++edit_generation_;
 }
 
 void FormGenerator::applyDataRecursive(const json& obj, const QString& parent_path)
 {
     // Get the schema for this level to help with defaults
-    json level_schema = schema_;
+    const json* level_schema_ptr = &schema_;
     
     // Navigate schema to current level based on parent_path
     if (!parent_path.isEmpty())
     {
         QString temp_path = parent_path;
         QStringList path_parts = temp_path.split(".");
-        
-        for (const QString& part : path_parts)
+
+        // OPTIMIZATION: One table lookup instead of a copying walk per level
+        const json* indexed = nullptr;
+        if (bundle_)
         {
-            if (level_schema.contains("properties") && level_schema["properties"].contains(part.toStdString()))
+            std::string pointer;
+            for (const QString& part : path_parts)
             {
-                level_schema = level_schema["properties"][part.toStdString()];
+                core::ValidationPlan::appendPointerToken(pointer, part.toStdString());
             }
-            else
+            indexed = bundle_->findSchema(pointer);
+        }
+
+        if (indexed)
+        {
+            level_schema_ptr = indexed;
+        }
+        else
+        {
+            for (const QString& part : path_parts)
             {
-                std::cerr << "[applyDataRecursive] Warning: Could not find schema for path part: " << part.toStdString() << std::endl;
-                break;
+                const json& level = *level_schema_ptr;
+                if (level.contains("properties") && level["properties"].contains(part.toStdString()))
+                {
+                    level_schema_ptr = &level["properties"][part.toStdString()];
+                }
+                else
+                {
+                    std::cerr << "[applyDataRecursive] Warning: Could not find schema for path part: " << part.toStdString() << std::endl;
+                    break;
+                }
             }
         }
     }
+    const json& level_schema = *level_schema_ptr;
     
     for (auto it = obj.begin(); it != obj.end(); ++it)
     {
@@ -867,7 +904,7 @@ void FormGenerator::applyDataRecursive(const json& obj, const QString& parent_pa
                 {
                     std::cerr << "[FormGenerator::applyDataRecursive] Converting rules from shorthand dictionary format to array" << std::endl;
                     // Convert shorthand dictionary format to array format
-                    value = RuleParser::convertNewFormatToOld(value);
+                    value = core::RuleParser::convertNewFormatToOld(value);
                     std::cerr << "[FormGenerator::applyDataRecursive] Converted rules, new size: " << (value.is_array() ? value.size() : 0) << std::endl;
                 }
                 catch (const std::exception& e)
@@ -1021,6 +1058,7 @@ void FormGenerator::clearForm()
 
     field_widgets_.clear();
     is_dirty_ = false;
+    ++edit_generation_;
     
     // Force layout update
     update();
@@ -1030,6 +1068,7 @@ void FormGenerator::clearForm()
 void FormGenerator::onFieldChanged()
 {
     is_dirty_ = true;
+    ++edit_generation_;
     emit formModified();
 }
 
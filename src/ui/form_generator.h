@@ -7,12 +7,17 @@
 #include <QWidget>
 #include <QVBoxLayout>
 #include <QMap>
+#include <memory>
 #include <nlohmann/json.hpp>
 
 // Use ordered_json to preserve field order as defined in schema's "required" array
 using json = nlohmann::ordered_json;
 
 namespace configgui {
+namespace core {
+class SchemaBundle;
+} // namespace core
+
 namespace ui {
 
 /**
@@ -33,9 +38,10 @@ public:
     /**
      * @brief Generate form from schema
      * @param schema JSON schema object
+     * @param bundle $ref-free view of schema; built here when not supplied
      * @return Success status
      */
-    bool generateFromSchema(const json& schema);
+    bool generateFromSchema(const json& schema, std::shared_ptr<const core::SchemaBundle> bundle = nullptr);
 
     /**
      * @brief Get current form data
@@ -65,6 +71,12 @@ public:
      */
     void markClean() { is_dirty_ = false; }
 
+    /**
+     * @brief Counter bumped by every change to the form's contents
+     * Lets an asynchronous save tell whether the form changed after its snapshot
+     */
+    quint64 editGeneration() const { return edit_generation_; }
+
 signals:
     void formModified();
     void validationChanged(const QString& field, bool is_valid);
@@ -82,7 +94,9 @@ private:
     QVBoxLayout* layout_;
     QMap<QString, FieldWidget> field_widgets_;
     bool is_dirty_;
+    quint64 edit_generation_ = 0;
     json schema_; // Store schema to rebuild nested structure
+    std::shared_ptr<const core::SchemaBundle> bundle_; // Path -> sub-schema table for schema_
 
     void addFieldToForm(const QString& field_name, const json& field_schema);
     void addFieldToFormWithPath(QVBoxLayout* parent_layout, const QString& field_name, 
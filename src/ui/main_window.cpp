@@ -22,6 +22,9 @@
 #include <QScrollBar>
 #include <nlohmann/json.hpp>
 #include "core/io/ini_reader.h"
+#include "core/schema/compiled_schema_cache.h"
+#include "core/schema/schema.h"
+#include "core/schema/schema_normalizer.h"
 
 using namespace configgui::core::models;
 
@@ -137,6 +140,7 @@ MainWindow::MainWindow(QWidget* parent)
     , status_label_(nullptr)
     , form_generator_(nullptr)
     , scroll_area_(nullptr)
+    , saver_(std::make_unique<ConfigurationSaver>())
     , current_schema_file_("")
     , current_config_file_("")
 {
@@ -229,7 +233,9 @@ void MainWindow::createToolBar()
 
 void MainWindow::connectSignals()
 {
-    // Additional signal connections can be added here
+    // Asynchronous save pipeline reports back on the GUI thread
+    connect(saver_.get(), &ConfigurationSaver::saveProgress, this, &MainWindow::onSaveProgress);
+    connect(saver_.get(), &ConfigurationSaver::saveFinished, this, &MainWindow::onSaveFinished);
 }
 
 void MainWindow::onFileOpen()
@@ -293,24 +299,29 @@ void MainWindow::onFileOpenConfiguration()
 
 void MainWindow::loadSchema(const QString& file_path)
 {
-    // Read the schema file
-    QFile file(file_path);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+    // OPTIMIZATION: Reopening an unchanged schema reuses the parsed schema and
+    // compiled validator from the process-wide cache
+    auto compiled = core::CompiledSchemaCache::instance().get(file_path.toStdString());
+    if (compiled.is_failure())
     {
-        QMessageBox::critical(this, tr("Error"), tr("Cannot open file: %1").arg(file_path));
+        if (compiled.error() == core::FileError::NotFound)
+        {
+            QMessageBox::critical(this, tr("Error"), tr("Cannot open file: %1").arg(file_path));
+        }
+        else
+        {
+            QMessageBox::critical(this, tr("JSON Error"),
+                tr("Failed to parse JSON schema:\n\n%1").arg(file_path));
+        }
         return;
     }
 
-    const QString content = QString::fromUtf8(file.readAll());
-    file.close();
-
-    // Parse JSON schema using ordered_json to preserve property order
     try
     {
-        const auto schema = nlohmann::ordered_json::parse(content.toStdString());
+        const auto& schema = compiled.value()->schema->raw_schema();
 
-        // Generate form from schema
-        if (form_generator_ && form_generator_->generateFromSchema(schema))
+        // Generate form from schema, reusing the cached $ref-free view
+        if (form_generator_ && form_generator_->generateFromSchema(schema, compiled.value()->bundle))
         {
             // Track the schema file for save operations
             current_schema_file_ = file_path;
@@ -393,6 +404,17 @@ void MainWindow::loadConfiguration(const QString& file_path)
             config = nlohmann::ordered_json::parse(content.toStdString());
         }
 
+        // Fill schema defaults and coerce INI/string values to their declared types
+        // in one precompiled pass before the form sees the data
+        if (!current_schema_file_.isEmpty())
+        {
+            auto compiled = core::CompiledSchemaCache::instance().get(current_schema_file_.toStdString());
+            if (compiled.is_success())
+            {
+                compiled.value()->normalizer->normalizeInPlace(config);
+            }
+        }
+
         // Update form with configuration data
         if (form_generator_)
         {
@@ -512,72 +534,116 @@ void MainWindow::onFileSave()
         }
     }
 
-    // Now save to the determined path in the selected format
+    // Only one save per file may be in flight; other files can still be saved
+    if (saver_->isSaving(save_path))
+    {
+        QMessageBox::information(this, tr("Save In Progress"),
+            tr("A save to this file is still in progress.\n\nFile: %1").arg(save_path));
+        return;
+    }
+
+    if (selected_format != FormatType::JSON && selected_format != FormatType::INI)
+    {
+        QMessageBox::critical(this, tr("Error"),
+            tr("Unsupported format selected"));
+        return;
+    }
+
     try
     {
-        // Get current form data as JSON
+        // Snapshot the form on the GUI thread; serialization and disk I/O run on a worker
         const auto form_data = form_generator_->getFormData();
+        const quint64 edit_generation = form_generator_->editGeneration();
 
-        QString content;
-        
-        if (selected_format == FormatType::JSON)
-        {
-            // Save as JSON
-            std::string json_string = form_data.dump(2);
-            content = QString::fromStdString(json_string);
-        }
-        else if (selected_format == FormatType::INI)
+        auto serialize = [form_data, selected_format]() -> QByteArray
         {
-            // Save as INI - convert JSON to INI format
-            // INI format: key=value with sections [section.subsection]
-            content = convertJsonToIni(form_data);
-        }
-        else
+            if (selected_format == FormatType::INI)
+            {
+                // INI format: key=value with sections [section.subsection]
+                return convertJsonToIni(form_data).toUtf8();
+            }
+            return QByteArray::fromStdString(form_data.dump(2));
+        };
+
+        const quint64 save_id = saver_->saveAsync(save_path, std::move(serialize));
+        if (save_id == 0)
         {
-            QMessageBox::critical(this, tr("Error"),
-                tr("Unsupported format selected"));
+            QMessageBox::information(this, tr("Save In Progress"),
+                tr("A save to this file is still in progress.\n\nFile: %1").arg(save_path));
             return;
         }
 
-        // Write to file
-        QFile file(save_path);
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text))
+        pending_saves_.insert(save_id, PendingSave{format_dialog.selected_format_name(), edit_generation});
+        if (status_label_)
         {
-            QMessageBox::critical(this, tr("Error"),
-                tr("Cannot write to file: %1").arg(save_path));
-            return;
+            status_label_->setText(tr("Saving %1...").arg(QFileInfo(save_path).fileName()));
         }
+    }
+    catch (const std::exception& e)
+    {
+        QMessageBox::critical(this, tr("Error"),
+            tr("Failed to save configuration:\n\n%1").arg(QString::fromStdString(e.what())));
+    }
+}
 
-        file.write(content.toUtf8());
-        file.close();
+void MainWindow::onSaveProgress(const QString& file_path, int percent, const QString& stage)
+{
+    if (status_label_ && percent < 100)
+    {
+        status_label_->setText(tr("Saving %1... %2 (%3%)")
+            .arg(QFileInfo(file_path).fileName(), stage).arg(percent));
+    }
+}
 
-        // Update the current config file path if we saved to a new location
-        if (save_path != current_config_file_)
-        {
-            current_config_file_ = save_path;
-        }
+void MainWindow::onSaveFinished(quint64 save_id, const QString& file_path, SaveOutcome outcome,
+                                const QString& error_message)
+{
+    // Keyed by id: a second save to file_path may already be pending
+    const PendingSave pending = pending_saves_.take(save_id);
+    const QString& format_name = pending.format_name;
 
-        // Mark form as clean
-        if (form_generator_)
+    if (outcome == SaveOutcome::Failed)
+    {
+        if (status_label_)
         {
-            form_generator_->markClean();
+            status_label_->setText(tr("Save failed: %1").arg(QFileInfo(file_path).fileName()));
         }
+        QMessageBox::critical(this, tr("Error"),
+            tr("Failed to save configuration:\n\n%1\n\n%2").arg(file_path, error_message));
+        return;
+    }
 
-        // Update status
+    // Update the current config file path if we saved to a new location
+    if (file_path != current_config_file_)
+    {
+        current_config_file_ = file_path;
+    }
+
+    // Mark form as clean, unless it was edited while the save was in flight:
+    // those edits are not in the file
+    if (form_generator_ && form_generator_->editGeneration() == pending.edit_generation)
+    {
+        form_generator_->markClean();
+    }
+
+    if (outcome == SaveOutcome::Unchanged)
+    {
         if (status_label_)
         {
-            status_label_->setText(tr("Saved config: %1").arg(QFileInfo(save_path).fileName()));
+            status_label_->setText(tr("No changes: %1").arg(QFileInfo(file_path).fileName()));
         }
-
-        QMessageBox::information(this, tr("Configuration Saved"),
-            tr("Configuration saved successfully as %1!\n\nFile: %2")
-                .arg(format_dialog.selected_format_name(), save_path));
+        return;
     }
-    catch (const std::exception& e)
+
+    // Update status
+    if (status_label_)
     {
-        QMessageBox::critical(this, tr("Error"),
-            tr("Failed to save configuration:\n\n%1").arg(QString::fromStdString(e.what())));
+        status_label_->setText(tr("Saved config: %1").arg(QFileInfo(file_path).fileName()));
     }
+
+    QMessageBox::information(this, tr("Configuration Saved"),
+        tr("Configuration saved successfully as %1!\n\nFile: %2")
+            .arg(format_name, file_path));
 }
 
 void MainWindow::onFileExit()
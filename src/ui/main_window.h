@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include "configuration_saver.h"
 #include <QMainWindow>
 #include <memory>
+#include <QHash>
 #include <QString>
 
 class QMenu;
@@ -44,6 +46,9 @@ private slots:
     void onFileOpenSchema();
     void onFileOpenConfiguration();
     void onFileSave();
+    void onSaveProgress(const QString& file_path, int percent, const QString& stage);
+    void onSaveFinished(quint64 save_id, const QString& file_path, configgui::ui::SaveOutcome outcome,
+                        const QString& error_message);
     void onFileExit();
     void onHelpAbout();
 
@@ -63,10 +68,19 @@ private:
     QLabel* status_label_;
     FormGenerator* form_generator_;
     QScrollArea* scroll_area_;
+    std::unique_ptr<ConfigurationSaver> saver_;
 
     // State tracking
     QString current_schema_file_;
     QString current_config_file_;
+
+    /// @brief A save handed to saver_ and not finished yet
+    struct PendingSave
+    {
+        QString format_name;
+        quint64 edit_generation = 0;  ///< FormGenerator::editGeneration() when the form was snapshotted
+    };
+    QHash<quint64, PendingSave> pending_saves_;  ///< Save id from saver_ -> details
 };
 
 } // namespace ui
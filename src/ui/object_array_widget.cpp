@@ -4,7 +4,7 @@
 #include "object_array_widget.h"
 #include "widget_factory.h"
 #include "rule_editor_widget.h"
-#include "rule_parser.h"
+#include "core/schema/rule_parser.h"
 #include <QHBoxLayout>
 #include <QLabel>
 #include <QLineEdit>
@@ -161,7 +161,7 @@ QWidget* ObjectArrayWidget::createObjectFormWidget(const json& /* item_schema */
                                 item_data["name"].get<std::string>() : "new_rule";
         
         // Create a RuleDefinition from the schema item
-        RuleDefinition rule_def;
+        core::RuleDefinition rule_def;
         rule_def.name = rule_name;
         rule_def.type = item_data.contains("type") && item_data["type"].is_string() ?
                         item_data["type"].get<std::string>() : "string";
@@ -445,7 +445,7 @@ json ObjectArrayWidget::getValues() const
         RuleEditorWidget* rule_editor = item_widget->findChild<RuleEditorWidget*>();
         if (rule_editor != nullptr)
         {
-            RuleDefinition rule = rule_editor->getRule();
+            core::RuleDefinition rule = rule_editor->getRule();
 
             // Convert RuleDefinition to old verbose rule object
             json obj = json::object();
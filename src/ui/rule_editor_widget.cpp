@@ -33,12 +33,12 @@ RuleEditorWidget::RuleEditorWidget(const std::string& field_name, const std::str
     , numeric_maximum_(nullptr)
 {
     // Parse the shorthand to get current rule definition
-    current_rule_ = RuleParser::parseShorthand(field_name, shorthand);
+    current_rule_ = core::RuleParser::parseShorthand(field_name, shorthand);
 
     createUI();
 }
 
-RuleEditorWidget::RuleEditorWidget(const std::string& field_name, const RuleDefinition& rule, QWidget* parent)
+RuleEditorWidget::RuleEditorWidget(const std::string& field_name, const core::RuleDefinition& rule, QWidget* parent)
     : QWidget(parent)
     , field_name_(field_name)
     , current_rule_(rule)
@@ -328,8 +328,8 @@ void RuleEditorWidget::updatePreview()
             return;
         }
         
-        RuleDefinition rule = getRule();
-        std::string shorthand = RuleParser::toShorthand(rule);
+        core::RuleDefinition rule = getRule();
+        std::string shorthand = core::RuleParser::toShorthand(rule);
         preview_label_->setText(QString("Preview: ") + QString::fromStdString(getFieldName()) + " : " +
                                QString::fromStdString(shorthand));
                                
@@ -343,12 +343,12 @@ void RuleEditorWidget::updatePreview()
 
 std::string RuleEditorWidget::getShorthand() const
 {
-    return RuleParser::toShorthand(getRule());
+    return core::RuleParser::toShorthand(getRule());
 }
 
-RuleDefinition RuleEditorWidget::getRule() const
+core::RuleDefinition RuleEditorWidget::getRule() const
 {
-    RuleDefinition rule;
+    core::RuleDefinition rule;
     rule.name = field_name_;
     rule.type = type_combo_->currentText().toStdString();
     rule.required = required_check_->isChecked();
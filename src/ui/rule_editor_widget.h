@@ -14,7 +14,7 @@
 #include <QLabel>
 #include <QPushButton>
 #include <nlohmann/json.hpp>
-#include "rule_parser.h"
+#include "core/schema/rule_parser.h"
 
 namespace configgui {
 namespace ui {
@@ -36,7 +36,7 @@ public:
      * @param rule The rule definition to edit
      * @param parent Parent widget
      */
-    explicit RuleEditorWidget(const std::string& field_name, const RuleDefinition& rule, QWidget* parent = nullptr);
+    explicit RuleEditorWidget(const std::string& field_name, const core::RuleDefinition& rule, QWidget* parent = nullptr);
     
     ~RuleEditorWidget() override = default;
 
@@ -54,7 +54,7 @@ public:
     /**
      * @brief Get the rule definition
      */
-    RuleDefinition getRule() const;
+    core::RuleDefinition getRule() const;
 
 signals:
     void ruleChanged();
@@ -68,14 +68,14 @@ private:
     void createUI();
     void createDynamicWidgets();
     void clearDynamicWidgets();
-    void loadRuleIntoUI(const RuleDefinition& rule);
+    void loadRuleIntoUI(const core::RuleDefinition& rule);
 
     // Static helper to get default minimum/maximum for a type
     static double getDefaultMinimum(const std::string& type);
     static double getDefaultMaximum(const std::string& type);
 
     std::string field_name_;
-    RuleDefinition current_rule_;
+    core::RuleDefinition current_rule_;
 
     // UI Components - Static
     QLineEdit* field_name_edit_;
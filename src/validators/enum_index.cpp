@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: MIT
+// EnumIndex - Implementation
+
+#include "enum_index.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace configgui {
+namespace validators {
+
+namespace
+{
+
+/// @brief Value of a number as int64_t when it has one (3u and 3.0 both yield 3)
+bool integralValue(const json& number, std::int64_t& out)
+{
+    switch (number.type())
+    {
+        case json::value_t::number_integer:
+            out = number.get<std::int64_t>();
+            return true;
+        case json::value_t::number_unsigned:
+        {
+            const auto value = number.get<std::uint64_t>();
+            if (value > static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max()))
+            {
+                return false;
+            }
+            out = static_cast<std::int64_t>(value);
+            return true;
+        }
+        case json::value_t::number_float:
+        {
+            const double value = number.get<double>();
+            // -2^63 and 2^63 are exact doubles; everything in between fits
+            if (!std::isfinite(value) || std::fpclassify(value - std::trunc(value)) != FP_ZERO ||
+                value < -9223372036854775808.0 || value >= 9223372036854775808.0)
+            {
+                return false;
+            }
+            out = static_cast<std::int64_t>(value);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+EnumIndex::EnumIndex(const json& enums)
+    : entries_(enums.is_array() ? enums : json::array())
+{
+    strings_.reserve(entries_.size());
+    for (const auto& entry : entries_)
+    {
+        std::int64_t integer = 0;
+        if (entry.is_string())
+        {
+            strings_.insert(entry.get_ref<const std::string&>());
+        }
+        else if (integralValue(entry, integer))
+        {
+            integers_.insert(integer);
+        }
+        else if (entry.is_number_float())
+        {
+            reals_.insert(entry.get<double>());
+        }
+        else if (entry.is_boolean())
+        {
+            (entry.get<bool>() ? has_true_ : has_false_) = true;
+        }
+        else if (entry.is_null())
+        {
+            has_null_ = true;
+        }
+        else
+        {
+            others_.push_back(&entry);
+        }
+    }
+}
+
+bool EnumIndex::contains(const json& value) const
+{
+    switch (value.type())
+    {
+        case json::value_t::string:
+            return strings_.count(value.get_ref<const std::string&>()) != 0;
+        case json::value_t::boolean:
+            return value.get<bool>() ? has_true_ : has_false_;
+        case json::value_t::null:
+            return has_null_;
+        case json::value_t::number_integer:
+        case json::value_t::number_unsigned:
+        case json::value_t::number_float:
+        {
+            std::int64_t integer = 0;
+            if (integralValue(value, integer))
+            {
+                return integers_.count(integer) != 0;
+            }
+            if (reals_.count(value.get<double>()) != 0)
+            {
+                return true;
+            }
+            break;  // Unsigned beyond int64_t: compared with others_
+        }
+        default:
+            break;
+    }
+
+    return std::any_of(others_.begin(), others_.end(), [&value](const json* entry) { return *entry == value; });
+}
+
+const std::string& EnumIndex::errorMessage() const
+{
+    std::call_once(message_once_, [this]() {
+        std::string allowed;
+        for (const auto& entry : entries_)
+        {
+            if (!allowed.empty())
+            {
+                allowed += ", ";
+            }
+            allowed += formatValue(entry);
+        }
+        message_ = "Value must be one of: " + allowed;
+    });
+    return message_;
+}
+
+std::string EnumIndex::formatValue(const json& value)
+{
+    if (value.is_string())
+    {
+        return "\"" + value.get<std::string>() + "\"";
+    }
+    if (value.is_boolean())
+    {
+        return value.get<bool>() ? "true" : "false";
+    }
+    return value.dump();
+}
+
+} // namespace validators
+} // namespace configgui
@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: MIT
+// EnumIndex - Hash index over the values of an "enum" constraint
+
+#ifndef CONFIGGUI_VALIDATORS_ENUM_INDEX_H
+#define CONFIGGUI_VALIDATORS_ENUM_INDEX_H
+
+#include "ivalidator.h"
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace configgui {
+namespace validators {
+
+/**
+ * @class EnumIndex
+ * @brief Membership test for an "enum" array in O(1) instead of O(n)
+ *
+ * Entries are split by type into hash sets: strings (views into the index's
+ * own copy of the array, so looking up a string value copies nothing),
+ * integers, and non-integral numbers. Booleans and null are flags; arrays,
+ * objects and unsigned values beyond int64_t are compared one by one.
+ * Numbers are keyed by value, so 3, 3u and 3.0 match each other as they do
+ * under json ==.
+ *
+ * OPTIMIZATION: The "Value must be one of: ..." message is formatted on the
+ * first failure and reused, instead of joining every entry on each failure.
+ *
+ * Immutable after construction apart from the message cache, which is
+ * thread-safe; share instances through std::shared_ptr<const EnumIndex>.
+ */
+class EnumIndex
+{
+public:
+    /**
+     * @brief Build the index
+     * @param enums The schema's "enum" array (copied)
+     */
+    explicit EnumIndex(const json& enums);
+
+    // Holds views into entries_: neither copyable nor movable
+    EnumIndex(const EnumIndex&) = delete;
+    EnumIndex& operator=(const EnumIndex&) = delete;
+
+    /**
+     * @brief Check whether value equals one of the entries
+     * @param value Value to look up
+     * @return True if found
+     */
+    bool contains(const json& value) const;
+
+    /**
+     * @brief Error message listing all entries (formatted once, then cached)
+     */
+    const std::string& errorMessage() const;
+
+    /**
+     * @brief Number of entries
+     */
+    std::size_t size() const { return entries_.size(); }
+
+    /**
+     * @brief Enum entry as shown in error messages
+     * @param value JSON value
+     * @return Strings quoted, everything else as JSON text
+     */
+    static std::string formatValue(const json& value);
+
+private:
+    json entries_;
+    std::unordered_set<std::string_view> strings_;
+    std::unordered_set<std::int64_t> integers_;
+    std::unordered_set<double> reals_;
+    bool has_true_ = false;
+    bool has_false_ = false;
+    bool has_null_ = false;
+    std::vector<const json*> others_;  ///< Arrays, objects, unsigned above INT64_MAX
+
+    mutable std::once_flag message_once_;
+    mutable std::string message_;
+};
+
+} // namespace validators
+} // namespace configgui
+
+#endif // CONFIGGUI_VALIDATORS_ENUM_INDEX_H
@@ -2,67 +2,80 @@
 // EnumValidator - Implementation
 
 #include "enum_validator.h"
+#include <algorithm>
 
 namespace configgui {
 namespace validators {
 
-ValidationResult EnumValidator::validate(const json& value, const json& schema)
+EnumValidator::EnumValidator(const json& schema)
 {
-    if (!schema.contains("enum"))
+    const auto enums = schema.find("enum");
+    if (enums != schema.end() && enums->is_array())
     {
-        return success();
+        bound_enums_ = &*enums;
+        index_ = std::make_shared<const EnumIndex>(*enums);
     }
+}
 
-    const auto& enums = schema["enum"];
-    if (!enums.is_array())
+ValidationResult EnumValidator::validate(const json& value, const json& schema)
+{
+    const auto enums = schema.find("enum");
+    if (enums == schema.end() || !enums->is_array())
     {
         return success();
     }
 
-    // Check if value is in enum list
-    for (const auto& enum_val : enums)
+    if (const EnumIndex* index = boundIndex(*enums))
     {
-        if (value == enum_val)
+        if (index->contains(value))
         {
             return success();
         }
+        // The message lives in the index; share it rather than copy it
+        return failure(ValidationError::enumMismatch(
+            std::shared_ptr<const std::string>(index_, &index->errorMessage())));
+    }
+
+    if (std::find(enums->begin(), enums->end(), value) != enums->end())
+    {
+        return success();
     }
 
-    // Value not found in enum - build error message
-    std::string allowed_values;
-    for (size_t i = 0; i < enums.size(); ++i)
+    std::string allowed;
+    for (const auto& entry : *enums)
     {
-        if (i > 0)
+        if (!allowed.empty())
         {
-            allowed_values += ", ";
+            allowed += ", ";
         }
-        allowed_values += valueToString(enums[i]);
+        allowed += EnumIndex::formatValue(entry);
     }
-
-    std::string message = "Value must be one of: " + allowed_values;
-    return failure({makeError("value", message, "ENUM_MISMATCH")});
+    return failure(ValidationError::enumMismatch(
+        std::make_shared<const std::string>("Value must be one of: " + allowed)));
 }
 
-std::string EnumValidator::valueToString(const json& value) const
+bool EnumValidator::isValid(const json& value, const json& schema)
 {
-    if (value.is_string())
-    {
-        return "\"" + value.get<std::string>() + "\"";
-    }
-    if (value.is_number())
+    const auto enums = schema.find("enum");
+    if (enums == schema.end() || !enums->is_array())
     {
-        return value.dump();
+        return true;
     }
-    if (value.is_boolean())
+    if (const EnumIndex* index = boundIndex(*enums))
     {
-        return value.get<bool>() ? "true" : "false";
+        return index->contains(value);
     }
-    if (value.is_null())
+    return std::find(enums->begin(), enums->end(), value) != enums->end();
+}
+
+const EnumIndex* EnumValidator::boundIndex(const json& enums) const
+{
+    // Size guards against a bound array that grew or shrank since binding
+    if (&enums == bound_enums_ && enums.size() == index_->size())
     {
-        return "null";
+        return index_.get();
     }
-
-    return value.dump();
+    return nullptr;
 }
 
 } // namespace validators
@@ -4,7 +4,9 @@
 #ifndef CONFIGGUI_VALIDATORS_ENUM_VALIDATOR_H
 #define CONFIGGUI_VALIDATORS_ENUM_VALIDATOR_H
 
+#include "enum_index.h"
 #include "ivalidator.h"
+#include <memory>
 
 namespace configgui {
 namespace validators {
@@ -15,10 +17,29 @@ namespace validators {
  *
  * Checks that values are in the allowed set of values.
  * Supports "enum" constraint from JSON Schema.
+ *
+ * OPTIMIZATION: A validator bound to a schema (see the schema constructor)
+ * indexes its "enum" array once in an EnumIndex, as ValidatorProgram does, and
+ * reuses the index's formatted error message.
+ * Expected improvement: one hash lookup per check instead of a comparison
+ * against every entry, plus no message formatting per failure.
  */
 class EnumValidator : public IValidator
 {
 public:
+    /// Unbound validator: each call scans the schema's "enum" array
+    EnumValidator() = default;
+
+    /**
+     * @brief Bind the validator to a schema node, indexing its "enum" once
+     *
+     * Calls passed this schema look values up in the index; any other schema
+     * is scanned. The index is a snapshot: bind a new validator after editing
+     * the array, and keep the schema alive while the validator is in use.
+     * @param schema Schema with enum constraint
+     */
+    explicit EnumValidator(const json& schema);
+
     ~EnumValidator() override = default;
 
     /**
@@ -29,19 +50,32 @@ public:
      */
     ValidationResult validate(const json& value, const json& schema) override;
 
+    /**
+     * @brief Check enum membership without building an error
+     * @return True if validate() would succeed
+     */
+    bool isValid(const json& value, const json& schema) override;
+
     /**
      * @brief Get validator name
      * @return "EnumValidator"
      */
     std::string getName() const override { return "EnumValidator"; }
 
+    /**
+     * @brief Whether the validator holds an index (see the schema constructor)
+     */
+    bool isBound() const { return index_ != nullptr; }
+
 private:
     /**
-     * @brief Convert JSON value to string for display
-     * @param value JSON value
-     * @return String representation
+     * @brief Index for an "enum" node, or null when the node is not the bound one
+     * @param enums The schema's "enum" array
      */
-    std::string valueToString(const json& value) const;
+    const EnumIndex* boundIndex(const json& enums) const;
+
+    const json* bound_enums_ = nullptr;        ///< Node the index was built from
+    std::shared_ptr<const EnumIndex> index_;
 };
 
 } // namespace validators
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: MIT
+// IValidator - Error codes and lazily formatted messages
+
+#include "ivalidator.h"
+#include <iomanip>
+#include <sstream>
+
+namespace configgui {
+namespace validators {
+
+namespace
+{
+
+std::string formatBound(const char* prefix, double bound)
+{
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2) << prefix << bound;
+    return oss.str();
+}
+
+} // namespace
+
+const char* toString(ErrorCode code)
+{
+    switch (code)
+    {
+        case ErrorCode::TypeMismatch:
+            return "TYPE_MISMATCH";
+        case ErrorCode::BelowMinimum:
+            return "BELOW_MINIMUM";
+        case ErrorCode::AboveMaximum:
+            return "ABOVE_MAXIMUM";
+        case ErrorCode::StringTooShort:
+            return "STRING_TOO_SHORT";
+        case ErrorCode::StringTooLong:
+            return "STRING_TOO_LONG";
+        case ErrorCode::EnumMismatch:
+            return "ENUM_MISMATCH";
+        case ErrorCode::PatternMismatch:
+            return "PATTERN_MISMATCH";
+        case ErrorCode::RequiredFieldMissing:
+            return "REQUIRED_FIELD_MISSING";
+    }
+    return "VALIDATION_ERROR";
+}
+
+ValidationError ValidationError::typeMismatch(std::shared_ptr<const std::string> expected, bool one_of,
+                                              const char* actual)
+{
+    ValidationError error("value", ErrorCode::TypeMismatch);
+    error.text_ = std::move(expected);
+    error.flag_ = one_of;
+    error.detail_ = actual;
+    return error;
+}
+
+ValidationError ValidationError::belowMinimum(double minimum, bool exclusive)
+{
+    ValidationError error("value", ErrorCode::BelowMinimum);
+    error.number_ = minimum;
+    error.flag_ = exclusive;
+    return error;
+}
+
+ValidationError ValidationError::aboveMaximum(double maximum, bool exclusive)
+{
+    ValidationError error("value", ErrorCode::AboveMaximum);
+    error.number_ = maximum;
+    error.flag_ = exclusive;
+    return error;
+}
+
+ValidationError ValidationError::stringTooShort(std::int64_t min_length)
+{
+    ValidationError error("value", ErrorCode::StringTooShort);
+    error.number_ = static_cast<double>(min_length);
+    return error;
+}
+
+ValidationError ValidationError::stringTooLong(std::int64_t max_length)
+{
+    ValidationError error("value", ErrorCode::StringTooLong);
+    error.number_ = static_cast<double>(max_length);
+    return error;
+}
+
+ValidationError ValidationError::enumMismatch(std::shared_ptr<const std::string> message)
+{
+    ValidationError error("value", ErrorCode::EnumMismatch);
+    error.text_ = std::move(message);
+    return error;
+}
+
+ValidationError ValidationError::patternMismatch(std::shared_ptr<const std::string> pattern)
+{
+    ValidationError error("value", ErrorCode::PatternMismatch);
+    error.text_ = std::move(pattern);
+    return error;
+}
+
+ValidationError ValidationError::requiredFieldMissing(std::string field)
+{
+    return ValidationError(std::move(field), ErrorCode::RequiredFieldMissing);
+}
+
+std::string ValidationError::message() const
+{
+    const std::string text = text_ ? *text_ : std::string();
+    switch (error_code)
+    {
+        case ErrorCode::TypeMismatch:
+            return (flag_ ? "Expected one of [" + text + "] but got '" : "Expected type '" + text + "' but got '") +
+                   (detail_ ? detail_ : "unknown") + "'";
+        case ErrorCode::BelowMinimum:
+            return formatBound(flag_ ? "Value must be greater than " : "Value must be at least ", number_);
+        case ErrorCode::AboveMaximum:
+            return formatBound(flag_ ? "Value must be less than " : "Value must be at most ", number_);
+        case ErrorCode::StringTooShort:
+            return "String must be at least " + std::to_string(static_cast<std::int64_t>(number_)) + " characters";
+        case ErrorCode::StringTooLong:
+            return "String must be at most " + std::to_string(static_cast<std::int64_t>(number_)) + " characters";
+        case ErrorCode::EnumMismatch:
+            return text;
+        case ErrorCode::PatternMismatch:
+            return "String does not match pattern: " + text;
+        case ErrorCode::RequiredFieldMissing:
+            return "Field '" + field + "' is required";
+    }
+    return text;
+}
+
+} // namespace validators
+} // namespace configgui
@@ -6,6 +6,12 @@
 
 #include "../core/result.h"
 #include <nlohmann/json.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
 #include <vector>
 
 using json = nlohmann::ordered_json;
@@ -14,13 +20,149 @@ namespace configgui {
 namespace validators {
 
 /**
- * @struct ValidationError
- * @brief Single validation error result
+ * @enum ErrorCode
+ * @brief Kind of validation error
+ *
+ * toString() gives the wire name ("TYPE_MISMATCH", ...); codes also compare
+ * equal to their names, so checks written against the old string codes
+ * keep working.
  */
-struct ValidationError {
-    std::string field;
-    std::string message;
-    std::string error_code;
+enum class ErrorCode : std::uint8_t
+{
+    TypeMismatch,
+    BelowMinimum,
+    AboveMaximum,
+    StringTooShort,
+    StringTooLong,
+    EnumMismatch,
+    PatternMismatch,
+    RequiredFieldMissing
+};
+
+/**
+ * @brief Wire name of an error code
+ * @param code Error code
+ * @return Static string, e.g. "BELOW_MINIMUM"
+ */
+const char* toString(ErrorCode code);
+
+inline bool operator==(ErrorCode code, std::string_view name) { return name == toString(code); }
+inline bool operator==(std::string_view name, ErrorCode code) { return name == toString(code); }
+inline bool operator!=(ErrorCode code, std::string_view name) { return !(code == name); }
+inline bool operator!=(std::string_view name, ErrorCode code) { return !(code == name); }
+
+inline std::ostream& operator<<(std::ostream& os, ErrorCode code) { return os << toString(code); }
+
+/**
+ * @class ValidationError
+ * @brief Single validation error
+ *
+ * OPTIMIZATION: Holds the error code and the arguments of its message, not
+ * the message: message() formats it on demand. Text taken from the schema
+ * (expected types, the pattern, the enum listing) is shared, so a validator
+ * that prepared it up front, like ValidatorProgram, reports an error without
+ * copying it.
+ */
+class ValidationError
+{
+public:
+    std::string field;  ///< Field the error is about ("value" for the value itself)
+    ErrorCode error_code = ErrorCode::TypeMismatch;
+
+    ValidationError() = default;
+
+    /**
+     * @param expected Expected type name, or the comma-separated list when one_of
+     * @param one_of True when the schema allows several types
+     * @param actual Type name of the value (static string)
+     */
+    static ValidationError typeMismatch(std::shared_ptr<const std::string> expected, bool one_of,
+                                        const char* actual);
+    static ValidationError belowMinimum(double minimum, bool exclusive);
+    static ValidationError aboveMaximum(double maximum, bool exclusive);
+    static ValidationError stringTooShort(std::int64_t min_length);
+    static ValidationError stringTooLong(std::int64_t max_length);
+
+    /// @param message Message listing the allowed values (EnumIndex::errorMessage())
+    static ValidationError enumMismatch(std::shared_ptr<const std::string> message);
+    static ValidationError patternMismatch(std::shared_ptr<const std::string> pattern);
+    static ValidationError requiredFieldMissing(std::string field);
+
+    /**
+     * @brief Human-readable message, formatted on each call
+     */
+    std::string message() const;
+
+    /**
+     * @brief Wire name of the error code
+     */
+    const char* code() const { return toString(error_code); }
+
+private:
+    ValidationError(std::string field_name, ErrorCode code) : field(std::move(field_name)), error_code(code) {}
+
+    std::shared_ptr<const std::string> text_;  ///< Schema text the message quotes
+    const char* detail_ = nullptr;             ///< Static text (actual type name)
+    double number_ = 0.0;                      ///< Bound or length
+    bool flag_ = false;                        ///< Exclusive bound / several allowed types
+};
+
+/**
+ * @class ErrorList
+ * @brief Errors of one validation, stored inline up to kInlineCapacity
+ *
+ * OPTIMIZATION: A validator reports zero or one error for most values, so
+ * the first errors live in the list itself and only a longer list moves to
+ * the heap. An empty list owns no heap memory.
+ */
+class ErrorList
+{
+public:
+    static constexpr size_t kInlineCapacity = 2;
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    const ValidationError* begin() const { return data(); }
+    const ValidationError* end() const { return data() + size_; }
+    ValidationError* begin() { return data(); }
+    ValidationError* end() { return data() + size_; }
+
+    const ValidationError& operator[](size_t i) const { return data()[i]; }
+    ValidationError& operator[](size_t i) { return data()[i]; }
+
+    void push_back(ValidationError error)
+    {
+        if (heap_.empty() && size_ < kInlineCapacity)
+        {
+            inline_[size_++] = std::move(error);
+            return;
+        }
+        if (heap_.empty())
+        {
+            heap_.reserve(kInlineCapacity * 2);
+            for (auto& spilled : inline_)
+            {
+                heap_.push_back(std::move(spilled));
+            }
+        }
+        heap_.push_back(std::move(error));
+        ++size_;
+    }
+
+    void clear()
+    {
+        heap_.clear();
+        size_ = 0;
+    }
+
+private:
+    const ValidationError* data() const { return heap_.empty() ? inline_.data() : heap_.data(); }
+    ValidationError* data() { return heap_.empty() ? inline_.data() : heap_.data(); }
+
+    std::array<ValidationError, kInlineCapacity> inline_;
+    std::vector<ValidationError> heap_;  ///< All errors, once there are more than kInlineCapacity
+    size_t size_ = 0;
 };
 
 /**
@@ -29,11 +171,81 @@ struct ValidationError {
  */
 struct ValidationResult {
     bool is_valid;
-    std::vector<ValidationError> errors;
+    ErrorList errors;
 
     explicit operator bool() const { return is_valid; }
 };
 
+/**
+ * @struct ValueSpan
+ * @brief Read-only view of contiguous JSON values (std::span is C++20)
+ */
+struct ValueSpan {
+    const json* data = nullptr;
+    size_t size = 0;
+
+    const json* begin() const { return data; }
+    const json* end() const { return data + size; }
+    const json& operator[](size_t i) const { return data[i]; }
+
+    /**
+     * @brief View the elements of a JSON array
+     * @param array Array value (anything else yields an empty span)
+     */
+    static ValueSpan of(const json& array)
+    {
+        if (!array.is_array())
+        {
+            return {};
+        }
+        const auto& elements = array.get_ref<const json::array_t&>();
+        return {elements.data(), elements.size()};
+    }
+};
+
+/**
+ * @class BatchErrors
+ * @brief Reusable error buffer for batch validation
+ *
+ * Each error records the position of its value in the batch. clear() keeps
+ * the storage, so a buffer reused across batches stops allocating once it
+ * has held its largest error set.
+ */
+class BatchErrors
+{
+public:
+    /// @brief Forget all errors, keeping the storage
+    void clear()
+    {
+        errors_.clear();
+        indices_.clear();
+    }
+
+    size_t size() const { return errors_.size(); }
+    bool empty() const { return errors_.empty(); }
+
+    /// @brief i-th error
+    const ValidationError& error(size_t i) const { return errors_[i]; }
+
+    /// @brief Position in the batch of the value the i-th error belongs to
+    size_t index(size_t i) const { return indices_[i]; }
+
+    /**
+     * @brief Append an error
+     * @param index Position of the value in the batch
+     * @param error The error
+     */
+    void add(size_t index, ValidationError error)
+    {
+        errors_.push_back(std::move(error));
+        indices_.push_back(index);
+    }
+
+private:
+    std::vector<ValidationError> errors_;
+    std::vector<size_t> indices_;
+};
+
 /**
  * @class IValidator
  * @brief Base interface for all validators
@@ -55,26 +267,55 @@ public:
     virtual ValidationResult validate(const json& value, const json& schema) = 0;
 
     /**
-     * @brief Get validator name
-     * @return Name of this validator
+     * @brief Check a value without reporting errors
+     *
+     * Runs validate() by default. OPTIMIZATION: The validators here override
+     * it to stop at the first violation and create no ValidationError, for
+     * callers that only need a yes/no answer.
+     * @param value JSON value to check
+     * @param schema Schema constraints
+     * @return True if validate() would report no errors
      */
-    virtual std::string getName() const = 0;
+    virtual bool isValid(const json& value, const json& schema)
+    {
+        return validate(value, schema).is_valid;
+    }
 
-protected:
     /**
-     * @brief Create validation error
-     * @param field Field name
-     * @param message Error message
-     * @param code Error code
-     * @return ValidationError
+     * @brief Validate many values against one schema
+     *
+     * Runs validate() per value by default; validators override it when
+     * they can read the schema once for the whole batch.
+     * @param values Values to validate (e.g. ValueSpan::of(array))
+     * @param schema Schema constraints shared by all values
+     * @param errors Buffer the errors are appended to
+     * @return Number of values that failed
      */
-    static ValidationError makeError(const std::string& field,
-                                     const std::string& message,
-                                     const std::string& code = "VALIDATION_ERROR")
+    virtual size_t validateBatch(ValueSpan values, const json& schema, BatchErrors& errors)
     {
-        return ValidationError{field, message, code};
+        size_t failed = 0;
+        for (size_t i = 0; i < values.size; ++i)
+        {
+            auto result = validate(values[i], schema);
+            if (!result.is_valid)
+            {
+                ++failed;
+                for (auto& error : result.errors)
+                {
+                    errors.add(i, std::move(error));
+                }
+            }
+        }
+        return failed;
     }
 
+    /**
+     * @brief Get validator name
+     * @return Name of this validator
+     */
+    virtual std::string getName() const = 0;
+
+protected:
     /**
      * @brief Create successful validation result
      * @return ValidationResult with is_valid=true
@@ -84,14 +325,26 @@ protected:
         return ValidationResult{true, {}};
     }
 
+    /**
+     * @brief Create failed validation result
+     * @param error The validation error
+     * @return ValidationResult with is_valid=false
+     */
+    static ValidationResult failure(ValidationError error)
+    {
+        ValidationResult result{false, {}};
+        result.errors.push_back(std::move(error));
+        return result;
+    }
+
     /**
      * @brief Create failed validation result
      * @param errors List of validation errors
      * @return ValidationResult with is_valid=false
      */
-    static ValidationResult failure(const std::vector<ValidationError>& errors)
+    static ValidationResult failure(ErrorList errors)
     {
-        return ValidationResult{false, errors};
+        return ValidationResult{false, std::move(errors)};
     }
 };
 
@@ -0,0 +1,875 @@
+// SPDX-License-Identifier: MIT
+// LinearRegex - Implementation
+
+#include "linear_regex.h"
+#include <algorithm>
+#include <limits>
+#include <map>
+
+namespace configgui {
+namespace validators {
+
+namespace
+{
+
+constexpr std::uint32_t kUnbounded = std::numeric_limits<std::uint32_t>::max();
+constexpr std::uint32_t kMaxRepeat = 1000;  ///< Largest {n,m} bound before the pattern is left to std::regex
+constexpr std::size_t kMaxNesting = 200;    ///< Group depth limit, keeps the parser's recursion bounded
+
+bool isWordByte(unsigned char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+std::bitset<256> rangeSet(unsigned char first, unsigned char last)
+{
+    std::bitset<256> set;
+    for (unsigned c = first; c <= last; ++c)
+    {
+        set.set(c);
+    }
+    return set;
+}
+
+std::bitset<256> wordSet()
+{
+    return rangeSet('a', 'z') | rangeSet('A', 'Z') | rangeSet('0', '9') | rangeSet('_', '_');
+}
+
+std::bitset<256> spaceSet()
+{
+    // isspace() in the "C" locale, which std::regex's \s uses
+    return rangeSet('\t', '\r') | rangeSet(' ', ' ');
+}
+
+int hexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+} // namespace
+
+struct LinearRegex::Node
+{
+    enum class Kind
+    {
+        Empty,
+        Class,
+        Concat,
+        Alternate,
+        Repeat,
+        Assert
+    };
+
+    Kind kind = Kind::Empty;
+    std::uint32_t arg = 0;  ///< Class index or AssertKind
+    std::uint32_t min = 0;
+    std::uint32_t max = 0;  ///< kUnbounded for * and +
+    std::vector<std::unique_ptr<Node>> children;
+};
+
+/**
+ * @brief Recursive-descent parser for the supported ECMAScript subset
+ * Every construct it does not model exactly makes parse() return nullptr.
+ */
+class LinearRegex::Parser
+{
+public:
+    Parser(std::string_view pattern, std::vector<std::bitset<256>>& classes)
+        : pattern_(pattern)
+        , classes_(classes)
+    {
+    }
+
+    std::unique_ptr<Node> parse()
+    {
+        auto root = parseAlternation();
+        return (root && pos_ == pattern_.size()) ? std::move(root) : nullptr;
+    }
+
+    bool hasWordBoundary() const { return has_word_boundary_; }
+
+private:
+    using NodePtr = std::unique_ptr<Node>;
+
+    bool atEnd() const { return pos_ >= pattern_.size(); }
+    char peek() const { return pattern_[pos_]; }
+
+    NodePtr make(Node::Kind kind, std::uint32_t arg = 0)
+    {
+        auto node = std::make_unique<Node>();
+        node->kind = kind;
+        node->arg = arg;
+        return node;
+    }
+
+    NodePtr classNode(const std::bitset<256>& set)
+    {
+        classes_.push_back(set);
+        return make(Node::Kind::Class, static_cast<std::uint32_t>(classes_.size() - 1));
+    }
+
+    NodePtr parseAlternation()
+    {
+        auto first = parseConcatenation();
+        if (!first || atEnd() || peek() != '|')
+        {
+            return first;
+        }
+
+        auto alternate = make(Node::Kind::Alternate);
+        alternate->children.push_back(std::move(first));
+        while (!atEnd() && peek() == '|')
+        {
+            ++pos_;
+            auto branch = parseConcatenation();
+            if (!branch)
+            {
+                return nullptr;
+            }
+            alternate->children.push_back(std::move(branch));
+        }
+        return alternate;
+    }
+
+    NodePtr parseConcatenation()
+    {
+        auto concat = make(Node::Kind::Concat);
+        while (!atEnd() && peek() != '|' && peek() != ')')
+        {
+            auto item = parseRepeat();
+            if (!item)
+            {
+                return nullptr;
+            }
+            concat->children.push_back(std::move(item));
+        }
+        if (concat->children.size() == 1)
+        {
+            return std::move(concat->children.front());
+        }
+        return concat;
+    }
+
+    NodePtr parseRepeat()
+    {
+        auto atom = parseAtom();
+        if (!atom || atEnd())
+        {
+            return atom;
+        }
+
+        std::uint32_t min = 0;
+        std::uint32_t max = 0;
+        switch (peek())
+        {
+            case '*':
+                ++pos_;
+                max = kUnbounded;
+                break;
+            case '+':
+                ++pos_;
+                min = 1;
+                max = kUnbounded;
+                break;
+            case '?':
+                ++pos_;
+                max = 1;
+                break;
+            case '{':
+                if (!parseBraces(min, max))
+                {
+                    return nullptr;
+                }
+                break;
+            default:
+                return atom;
+        }
+
+        if (atom->kind == Node::Kind::Assert)
+        {
+            return nullptr;  // std::regex rejects quantified assertions
+        }
+        if (!atEnd() && peek() == '?')
+        {
+            ++pos_;  // Lazy and greedy quantifiers accept the same strings
+        }
+        if (!atEnd() && (peek() == '*' || peek() == '+' || peek() == '?' || peek() == '{'))
+        {
+            return nullptr;  // "a**" and friends are errors in ECMAScript
+        }
+
+        auto repeat = make(Node::Kind::Repeat);
+        repeat->min = min;
+        repeat->max = max;
+        repeat->children.push_back(std::move(atom));
+        return repeat;
+    }
+
+    bool parseNumber(std::uint32_t& out)
+    {
+        const std::size_t start = pos_;
+        std::uint64_t value = 0;
+        while (!atEnd() && peek() >= '0' && peek() <= '9')
+        {
+            value = value * 10 + static_cast<std::uint64_t>(peek() - '0');
+            if (value > kMaxRepeat)
+            {
+                return false;
+            }
+            ++pos_;
+        }
+        out = static_cast<std::uint32_t>(value);
+        return pos_ > start;
+    }
+
+    bool parseBraces(std::uint32_t& min, std::uint32_t& max)
+    {
+        ++pos_;  // '{'
+        if (!parseNumber(min) || atEnd())
+        {
+            return false;
+        }
+        max = min;
+        if (peek() == ',')
+        {
+            ++pos_;
+            max = kUnbounded;
+            if (!atEnd() && peek() != '}' && !parseNumber(max))
+            {
+                return false;
+            }
+        }
+        if (atEnd() || peek() != '}' || max < min)
+        {
+            return false;
+        }
+        ++pos_;
+        return true;
+    }
+
+    NodePtr parseAtom()
+    {
+        const char c = peek();
+        switch (c)
+        {
+            case '(':
+            {
+                ++pos_;
+                if (!atEnd() && peek() == '?')
+                {
+                    if (pos_ + 1 >= pattern_.size() || pattern_[pos_ + 1] != ':')
+                    {
+                        return nullptr;  // Lookaround
+                    }
+                    pos_ += 2;
+                }
+                if (++depth_ > kMaxNesting)
+                {
+                    return nullptr;
+                }
+                auto inner = parseAlternation();
+                --depth_;
+                if (!inner || atEnd() || peek() != ')')
+                {
+                    return nullptr;
+                }
+                ++pos_;
+                return inner;
+            }
+            case '[':
+            {
+                std::bitset<256> set;
+                return parseClass(set) ? classNode(set) : nullptr;
+            }
+            case '.':
+                ++pos_;
+                return classNode(~(rangeSet('\n', '\n') | rangeSet('\r', '\r')));
+            case '^':
+                ++pos_;
+                return make(Node::Kind::Assert, kBegin);
+            case '$':
+                ++pos_;
+                return make(Node::Kind::Assert, kEnd);
+            case '\\':
+                if (pos_ + 1 < pattern_.size() && (pattern_[pos_ + 1] == 'b' || pattern_[pos_ + 1] == 'B'))
+                {
+                    const bool boundary = pattern_[pos_ + 1] == 'b';
+                    pos_ += 2;
+                    has_word_boundary_ = true;
+                    return make(Node::Kind::Assert, boundary ? kWordBoundary : kNotWordBoundary);
+                }
+                else
+                {
+                    std::bitset<256> set;
+                    bool single = false;
+                    return parseEscape(set, false, single) ? classNode(set) : nullptr;
+                }
+            case '*':
+            case '+':
+            case '?':
+            case '{':
+            case '}':
+            case ']':
+                return nullptr;  // Nothing to repeat, or a stray bracket std::regex may reject
+            default:
+                ++pos_;
+                return classNode(rangeSet(static_cast<unsigned char>(c), static_cast<unsigned char>(c)));
+        }
+    }
+
+    /// @brief Parse an escape at pos_ into set; single tells whether it is one byte (usable in a range)
+    bool parseEscape(std::bitset<256>& set, bool in_class, bool& single)
+    {
+        ++pos_;  // '\'
+        if (atEnd())
+        {
+            return false;
+        }
+        const char c = pattern_[pos_++];
+        single = true;
+        auto byte = [&set](unsigned value) {
+            set.set(value);
+            return true;
+        };
+
+        switch (c)
+        {
+            case 'd':
+            case 'D':
+            case 'w':
+            case 'W':
+            case 's':
+            case 'S':
+            {
+                single = false;
+                const char lower = static_cast<char>(c | 0x20);
+                std::bitset<256> base = (lower == 'd') ? rangeSet('0', '9') : (lower == 'w') ? wordSet() : spaceSet();
+                set |= (c == lower) ? base : ~base;
+                return true;
+            }
+            case 'n':
+                return byte('\n');
+            case 'r':
+                return byte('\r');
+            case 't':
+                return byte('\t');
+            case 'v':
+                return byte('\v');
+            case 'f':
+                return byte('\f');
+            case 'b':
+                return in_class && byte('\b');
+            case '0':
+                return (atEnd() || peek() < '0' || peek() > '9') && byte(0);
+            case 'x':
+            case 'u':
+            {
+                const std::size_t digits = (c == 'x') ? 2 : 4;
+                unsigned value = 0;
+                for (std::size_t i = 0; i < digits; ++i)
+                {
+                    const int digit = atEnd() ? -1 : hexValue(pattern_[pos_++]);
+                    if (digit < 0)
+                    {
+                        return false;
+                    }
+                    value = value * 16 + static_cast<unsigned>(digit);
+                }
+                // Code points above ASCII are several bytes in UTF-8; leave those to std::regex
+                return value < 0x80 && byte(value);
+            }
+            default:
+                if ((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'))
+                {
+                    return false;  // Backreferences, \c, \k, \p ...
+                }
+                return byte(static_cast<unsigned char>(c));  // Escaped punctuation
+        }
+    }
+
+    bool parseClass(std::bitset<256>& set)
+    {
+        ++pos_;  // '['
+        bool negate = false;
+        if (!atEnd() && peek() == '^')
+        {
+            negate = true;
+            ++pos_;
+        }
+        if (!atEnd() && peek() == ']')
+        {
+            return false;  // "[]" and "[^]": ECMAScript and std::regex disagree
+        }
+
+        while (true)
+        {
+            if (atEnd())
+            {
+                return false;
+            }
+            if (peek() == ']')
+            {
+                ++pos_;
+                break;
+            }
+
+            std::bitset<256> item;
+            bool single = true;
+            unsigned char first = 0;
+            if (!parseClassItem(item, single, first))
+            {
+                return false;
+            }
+
+            if (pos_ + 1 < pattern_.size() && peek() == '-' && pattern_[pos_ + 1] != ']')
+            {
+                ++pos_;  // '-'
+                std::bitset<256> end_item;
+                bool end_single = true;
+                unsigned char last = 0;
+                if (!single || !parseClassItem(end_item, end_single, last) || !end_single || last < first)
+                {
+                    return false;
+                }
+                item = rangeSet(first, last);
+            }
+            set |= item;
+        }
+
+        if (negate)
+        {
+            set.flip();
+        }
+        return true;
+    }
+
+    bool parseClassItem(std::bitset<256>& item, bool& single, unsigned char& value)
+    {
+        if (peek() == '\\')
+        {
+            if (!parseEscape(item, true, single))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            if (peek() == '[')
+            {
+                return false;  // POSIX classes such as [[:alpha:]]
+            }
+            item.set(static_cast<unsigned char>(pattern_[pos_++]));
+            single = true;
+        }
+        if (single)
+        {
+            for (unsigned c = 0; c < 256; ++c)
+            {
+                if (item.test(c))
+                {
+                    value = static_cast<unsigned char>(c);
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+
+    std::string_view pattern_;
+    std::vector<std::bitset<256>>& classes_;
+    std::size_t pos_ = 0;
+    std::size_t depth_ = 0;
+    bool has_word_boundary_ = false;
+};
+
+std::unique_ptr<LinearRegex> LinearRegex::compile(std::string_view pattern)
+{
+    std::unique_ptr<LinearRegex> regex(new LinearRegex());
+    Parser parser(pattern, regex->classes_);
+    const auto root = parser.parse();
+    if (!root || !regex->emit(*root))
+    {
+        return nullptr;
+    }
+    regex->append(Op::Match);
+    if (regex->program_.size() > kMaxInstructions)
+    {
+        return nullptr;
+    }
+
+    regex->has_word_boundary_ = parser.hasWordBoundary();
+    if (!regex->has_word_boundary_)
+    {
+        regex->buildDfa();  // Too many states: stay on the Pike VM
+    }
+    return regex;
+}
+
+std::uint32_t LinearRegex::append(Op op, std::uint32_t x, std::uint32_t y, std::uint32_t arg)
+{
+    program_.push_back(Instruction{op, x, y, arg});
+    return static_cast<std::uint32_t>(program_.size() - 1);
+}
+
+bool LinearRegex::emit(const Node& node)
+{
+    if (program_.size() > kMaxInstructions)
+    {
+        return false;
+    }
+
+    auto next = [this]() { return static_cast<std::uint32_t>(program_.size()); };
+    switch (node.kind)
+    {
+        case Node::Kind::Empty:
+            return true;
+        case Node::Kind::Class:
+            append(Op::Class, 0, 0, node.arg);
+            return true;
+        case Node::Kind::Assert:
+            append(Op::Assert, 0, 0, node.arg);
+            return true;
+        case Node::Kind::Concat:
+            for (const auto& child : node.children)
+            {
+                if (!emit(*child))
+                {
+                    return false;
+                }
+            }
+            return true;
+        case Node::Kind::Alternate:
+        {
+            std::vector<std::uint32_t> jumps;
+            for (std::size_t i = 0; i < node.children.size(); ++i)
+            {
+                const bool last = (i + 1 == node.children.size());
+                const std::uint32_t split = last ? 0 : append(Op::Split);
+                if (!last)
+                {
+                    program_[split].x = next();
+                }
+                if (!emit(*node.children[i]))
+                {
+                    return false;
+                }
+                if (!last)
+                {
+                    jumps.push_back(append(Op::Jump));
+                    program_[split].y = next();
+                }
+            }
+            for (const auto jump : jumps)
+            {
+                program_[jump].x = next();
+            }
+            return true;
+        }
+        case Node::Kind::Repeat:
+        {
+            const Node& body = *node.children.front();
+            for (std::uint32_t i = 0; i < node.min; ++i)
+            {
+                if (!emit(body))
+                {
+                    return false;
+                }
+            }
+            if (node.max == kUnbounded)
+            {
+                const std::uint32_t loop = append(Op::Split);
+                program_[loop].x = next();
+                if (!emit(body))
+                {
+                    return false;
+                }
+                append(Op::Jump, loop);
+                program_[loop].y = next();
+                return true;
+            }
+
+            // Optional copies: each one may be skipped to the end
+            std::vector<std::uint32_t> splits;
+            for (std::uint32_t i = node.min; i < node.max; ++i)
+            {
+                splits.push_back(append(Op::Split));
+                program_[splits.back()].x = next();
+                if (!emit(body))
+                {
+                    return false;
+                }
+            }
+            for (const auto split : splits)
+            {
+                program_[split].y = next();
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void LinearRegex::closure(std::uint32_t pc, const Position& position, std::vector<std::uint32_t>& out,
+                          Visited& visited) const
+{
+    visited.stack.clear();
+    visited.stack.push_back(pc);
+    while (!visited.stack.empty())
+    {
+        const std::uint32_t current = visited.stack.back();
+        visited.stack.pop_back();
+        if (visited.marks[current] == visited.generation)
+        {
+            continue;
+        }
+        visited.marks[current] = visited.generation;
+
+        const Instruction& instruction = program_[current];
+        switch (instruction.op)
+        {
+            case Op::Class:
+            case Op::Match:
+                out.push_back(current);
+                break;
+            case Op::Jump:
+                visited.stack.push_back(instruction.x);
+                break;
+            case Op::Split:
+                visited.stack.push_back(instruction.y);
+                visited.stack.push_back(instruction.x);
+                break;
+            case Op::Assert:
+            {
+                bool holds = false;
+                switch (instruction.arg)
+                {
+                    case kBegin:
+                        holds = position.at_begin;
+                        break;
+                    case kEnd:
+                        if (position.defer_end)
+                        {
+                            out.push_back(current);
+                        }
+                        holds = !position.defer_end && position.at_end;
+                        break;
+                    case kWordBoundary:
+                        holds = position.boundary;
+                        break;
+                    default:
+                        holds = !position.boundary;
+                        break;
+                }
+                if (holds)
+                {
+                    visited.stack.push_back(current + 1);
+                }
+                break;
+            }
+        }
+    }
+}
+
+bool LinearRegex::buildDfa()
+{
+    // Bytes that every class treats alike share a column of the transition table
+    std::map<std::vector<bool>, std::uint8_t> signatures;
+    std::vector<unsigned char> representative;
+    for (unsigned c = 0; c < 256; ++c)
+    {
+        std::vector<bool> signature(classes_.size());
+        for (std::size_t i = 0; i < classes_.size(); ++i)
+        {
+            signature[i] = classes_[i].test(c);
+        }
+        const auto inserted = signatures.emplace(std::move(signature), static_cast<std::uint8_t>(signatures.size()));
+        if (inserted.second)
+        {
+            representative.push_back(static_cast<unsigned char>(c));
+        }
+        byte_class_[c] = inserted.first->second;
+    }
+    class_count_ = representative.size();
+
+    Visited visited;
+    visited.marks.assign(program_.size(), 0);
+    auto contains_match = [this](const std::vector<std::uint32_t>& pcs) {
+        return std::any_of(pcs.begin(), pcs.end(), [this](std::uint32_t pc) { return program_[pc].op == Op::Match; });
+    };
+
+    Position start_position;
+    start_position.at_begin = true;
+    start_position.defer_end = true;
+    std::vector<std::uint32_t> start;
+    ++visited.generation;
+    closure(0, start_position, start, visited);
+    std::sort(start.begin(), start.end());
+
+    Position empty_position;
+    empty_position.at_begin = true;
+    empty_position.at_end = true;
+    std::vector<std::uint32_t> empty;
+    ++visited.generation;
+    closure(0, empty_position, empty, visited);
+    dfa_start_accepts_empty_ = contains_match(empty);
+
+    if (start.empty())
+    {
+        dfa_dead_start_ = true;
+        return true;
+    }
+
+    std::map<std::vector<std::uint32_t>, std::int32_t> ids;
+    std::vector<std::vector<std::uint32_t>> states;
+    ids.emplace(start, 0);
+    states.push_back(std::move(start));
+
+    Position step_position;
+    step_position.defer_end = true;
+    Position end_position;
+    end_position.at_end = true;
+
+    std::vector<std::uint32_t> target;
+    for (std::size_t s = 0; s < states.size(); ++s)
+    {
+        // Accepting: a Match thread, or a pending "$" that leads to one at the end of input
+        std::vector<std::uint32_t> at_end;
+        ++visited.generation;
+        for (const auto pc : states[s])
+        {
+            if (program_[pc].op == Op::Match)
+            {
+                at_end.push_back(pc);
+            }
+            else if (program_[pc].op == Op::Assert)
+            {
+                closure(pc + 1, end_position, at_end, visited);
+            }
+        }
+        dfa_accepts_.push_back(contains_match(at_end));
+
+        for (std::size_t column = 0; column < class_count_; ++column)
+        {
+            const unsigned char c = representative[column];
+            target.clear();
+            ++visited.generation;
+            for (const auto pc : states[s])
+            {
+                if (program_[pc].op == Op::Class && classes_[program_[pc].arg].test(c))
+                {
+                    closure(pc + 1, step_position, target, visited);
+                }
+            }
+
+            std::int32_t id = -1;
+            if (!target.empty())
+            {
+                std::sort(target.begin(), target.end());
+                const auto found = ids.find(target);
+                if (found != ids.end())
+                {
+                    id = found->second;
+                }
+                else
+                {
+                    if (states.size() >= kMaxDfaStates)
+                    {
+                        dfa_.clear();
+                        dfa_accepts_.clear();
+                        return false;
+                    }
+                    id = static_cast<std::int32_t>(states.size());
+                    ids.emplace(target, id);
+                    states.push_back(target);
+                }
+            }
+            dfa_.push_back(id);
+        }
+    }
+    return true;
+}
+
+bool LinearRegex::fullMatch(std::string_view text) const
+{
+    if (!usesDfa())
+    {
+        return pikeMatch(text);
+    }
+    if (dfa_dead_start_)
+    {
+        return false;
+    }
+    if (text.empty())
+    {
+        return dfa_start_accepts_empty_;
+    }
+
+    std::size_t state = 0;
+    for (const char c : text)
+    {
+        const std::int32_t next = dfa_[state * class_count_ + byte_class_[static_cast<unsigned char>(c)]];
+        if (next < 0)
+        {
+            return false;
+        }
+        state = static_cast<std::size_t>(next);
+    }
+    return dfa_accepts_[state];
+}
+
+bool LinearRegex::pikeMatch(std::string_view text) const
+{
+    Visited visited;
+    visited.marks.assign(program_.size(), 0);
+    std::vector<std::uint32_t> current;
+    std::vector<std::uint32_t> next;
+
+    auto word_at = [&text](std::size_t i) {
+        return i < text.size() && isWordByte(static_cast<unsigned char>(text[i]));
+    };
+
+    Position position;
+    position.at_begin = true;
+    position.at_end = text.empty();
+    position.boundary = word_at(0);
+    ++visited.generation;
+    closure(0, position, current, visited);
+
+    for (std::size_t i = 0; i < text.size() && !current.empty(); ++i)
+    {
+        const auto c = static_cast<unsigned char>(text[i]);
+        position.at_begin = false;
+        position.at_end = (i + 1 == text.size());
+        position.boundary = isWordByte(c) != word_at(i + 1);
+
+        next.clear();
+        ++visited.generation;
+        for (const auto pc : current)
+        {
+            if (program_[pc].op == Op::Class && classes_[program_[pc].arg].test(c))
+            {
+                closure(pc + 1, position, next, visited);
+            }
+        }
+        current.swap(next);
+    }
+
+    return std::any_of(current.begin(), current.end(),
+                       [this](std::uint32_t pc) { return program_[pc].op == Op::Match; });
+}
+
+} // namespace validators
+} // namespace configgui
@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: MIT
+// LinearRegex - Automaton regex engine with linear-time matching
+
+#ifndef CONFIGGUI_VALIDATORS_LINEAR_REGEX_H
+#define CONFIGGUI_VALIDATORS_LINEAR_REGEX_H
+
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace configgui {
+namespace validators {
+
+/**
+ * @class LinearRegex
+ * @brief Regex matcher whose running time is linear in the input, whatever the pattern
+ *
+ * Accepts the ECMAScript subset that schema patterns use: literals and
+ * escapes, ".", bracket classes, \d \w \s (and negations), groups, "|",
+ * the quantifiers * + ? {n} {n,} {n,m} (greedy or lazy), and the
+ * assertions ^ $ \b \B. Matching is byte-wise with std::regex's
+ * ECMAScript semantics ("." excludes \n and \r, ^/$ bind to the ends of
+ * the input), so results agree with std::regex_match.
+ *
+ * Patterns are compiled to a Thompson NFA and, when they have no word
+ * boundaries and determinize to at most kMaxDfaStates states, to a DFA
+ * over byte classes; matching is then one table lookup per byte. Other
+ * patterns run the NFA as a Pike VM (all threads in lock step). Neither
+ * backtracks, so "(a+)+$" cannot blow up the way it does in std::regex.
+ *
+ * Backreferences and lookaround need backtracking; compile() returns
+ * nullptr for them (and for anything else outside the subset) so the
+ * caller can fall back to std::regex.
+ *
+ * Immutable after compile(); safe to share across threads.
+ */
+class LinearRegex
+{
+public:
+    /// @brief Largest program (NFA instructions) compile() accepts
+    static constexpr std::size_t kMaxInstructions = 20000;
+
+    /// @brief Largest DFA compile() builds before settling for the Pike VM
+    static constexpr std::size_t kMaxDfaStates = 1024;
+
+    /**
+     * @brief Compile a pattern
+     * @param pattern ECMAScript pattern
+     * @return Compiled regex, or nullptr if the pattern is outside the subset
+     */
+    static std::unique_ptr<LinearRegex> compile(std::string_view pattern);
+
+    /**
+     * @brief Whole-input match, like std::regex_match
+     * @param text Input bytes
+     * @return True if the entire text matches
+     */
+    bool fullMatch(std::string_view text) const;
+
+    /**
+     * @brief True when matching runs on the precomputed DFA
+     */
+    bool usesDfa() const { return !dfa_.empty() || dfa_dead_start_; }
+
+private:
+    enum class Op : std::uint8_t
+    {
+        Class,   ///< Consume one byte in classes_[arg]
+        Split,   ///< Continue at x and at y
+        Jump,    ///< Continue at x
+        Assert,  ///< Zero-width test of kind arg
+        Match
+    };
+
+    enum AssertKind : std::uint32_t
+    {
+        kBegin,
+        kEnd,
+        kWordBoundary,
+        kNotWordBoundary
+    };
+
+    struct Instruction
+    {
+        Op op = Op::Match;
+        std::uint32_t x = 0;
+        std::uint32_t y = 0;
+        std::uint32_t arg = 0;
+    };
+
+    /// @brief Where in the input a closure is taken
+    struct Position
+    {
+        bool at_begin = false;
+        bool at_end = false;
+        bool boundary = false;   ///< Word boundary between the previous and next byte
+        bool defer_end = false;  ///< End not known yet: keep "$" pcs instead of testing them
+    };
+
+    /// @brief Reusable visited marks for closure()
+    struct Visited
+    {
+        std::vector<std::uint32_t> marks;  ///< pc was reached in the current generation
+        std::vector<std::uint32_t> stack;
+        std::uint32_t generation = 0;
+    };
+
+    struct Node;
+    class Parser;
+
+    LinearRegex() = default;
+
+    bool emit(const Node& node);
+    std::uint32_t append(Op op, std::uint32_t x = 0, std::uint32_t y = 0, std::uint32_t arg = 0);
+
+    /// @brief Follow Split/Jump/Assert from pc, collecting the Class and Match pcs it reaches
+    void closure(std::uint32_t pc, const Position& position, std::vector<std::uint32_t>& out, Visited& visited) const;
+
+    bool buildDfa();
+    bool pikeMatch(std::string_view text) const;
+
+    std::vector<Instruction> program_;
+    std::vector<std::bitset<256>> classes_;
+    bool has_word_boundary_ = false;
+
+    // DFA: state s on byte b goes to dfa_[s * class_count_ + byte_class_[b]] (-1 = dead)
+    std::uint8_t byte_class_[256] = {};
+    std::size_t class_count_ = 0;
+    std::vector<std::int32_t> dfa_;
+    std::vector<bool> dfa_accepts_;
+    bool dfa_start_accepts_empty_ = false;
+    bool dfa_dead_start_ = false;
+};
+
+} // namespace validators
+} // namespace configgui
+
+#endif // CONFIGGUI_VALIDATORS_LINEAR_REGEX_H
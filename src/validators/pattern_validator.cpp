@@ -2,46 +2,56 @@
 // PatternValidator - Implementation
 
 #include "pattern_validator.h"
-#include <mutex>
 
 namespace configgui {
 namespace validators {
 
 // Initialize static members
-std::shared_mutex PatternValidator::s_regex_cache_mutex;
-std::unordered_map<std::string, std::shared_ptr<const std::regex>> PatternValidator::s_regex_cache;
-size_t PatternValidator::s_cache_lookups = 0;
+RegexCache PatternValidator::s_regex_cache;
+std::atomic<RegexBackend> PatternValidator::s_backend{RegexBackend::Linear};
 
 ValidationResult PatternValidator::validate(const json& value, const json& schema)
 {
-    if (!value.is_string() || !schema.contains("pattern"))
+    if (!value.is_string())
     {
         return success();
     }
 
-    if (!schema["pattern"].is_string())
+    const auto pattern = schema.find("pattern");
+    if (pattern == schema.end() || !pattern->is_string())
     {
         return success();
     }
 
-    const auto str = value.get<std::string>();
-    const auto pattern = schema["pattern"].get<std::string>();
-
-    if (!matchesPattern(str, pattern))
+    const auto& pattern_str = pattern->get_ref<const std::string&>();
+    if (!matchesPattern(value.get_ref<const std::string&>(), pattern_str))
     {
-        std::string message = "String does not match pattern: " + pattern;
-        return failure({makeError("value", message, "PATTERN_MISMATCH")});
+        return failure(ValidationError::patternMismatch(std::make_shared<const std::string>(pattern_str)));
     }
 
     return success();
 }
 
+bool PatternValidator::isValid(const json& value, const json& schema)
+{
+    if (!value.is_string())
+    {
+        return true;
+    }
+    const auto pattern = schema.find("pattern");
+    if (pattern == schema.end() || !pattern->is_string())
+    {
+        return true;
+    }
+    return matchesPattern(value.get_ref<const std::string&>(), pattern->get_ref<const std::string&>());
+}
+
 bool PatternValidator::matchesPattern(const std::string& str, const std::string& pattern) const
 {
     try
     {
         auto regex_ptr = getCachedRegex(pattern);
-        return std::regex_match(str, *regex_ptr);
+        return regex_ptr->fullMatch(str);
     }
     catch (const std::regex_error&)
     {
@@ -50,51 +60,37 @@ bool PatternValidator::matchesPattern(const std::string& str, const std::string&
     }
 }
 
-std::shared_ptr<const std::regex> PatternValidator::getCachedRegex(const std::string& pattern)
+std::shared_ptr<const CompiledRegex> PatternValidator::getCachedRegex(const std::string& pattern)
 {
-    // Increment lookup counter (for statistics)
-    ++s_cache_lookups;
-
-    // Try to read from cache first (shared lock)
-    {
-        std::shared_lock<std::shared_mutex> read_lock(s_regex_cache_mutex);
-        auto it = s_regex_cache.find(pattern);
-        if (it != s_regex_cache.end())
-        {
-            return it->second;
-        }
-    }
-
-    // Pattern not in cache, compile and store it (exclusive lock)
-    std::unique_lock<std::shared_mutex> write_lock(s_regex_cache_mutex);
+    return s_regex_cache.get(pattern, s_backend.load());
+}
 
-    // Double-check pattern wasn't inserted by another thread
-    auto it = s_regex_cache.find(pattern);
-    if (it != s_regex_cache.end())
-    {
-        return it->second;
-    }
+void PatternValidator::clearCache()
+{
+    s_regex_cache.clear();
+}
 
-    // Compile and cache the new pattern
-    auto compiled_regex = std::make_shared<const std::regex>(pattern);
-    s_regex_cache[pattern] = compiled_regex;
+void PatternValidator::setRegexBackend(RegexBackend backend)
+{
+    // Entries are keyed by backend too, so a lookup racing with the switch never sees the wrong engine
+    s_backend.store(backend);
+    s_regex_cache.clear();
+}
 
-    return compiled_regex;
+RegexBackend PatternValidator::getRegexBackend()
+{
+    return s_backend.load();
 }
 
-void PatternValidator::clearCache()
+RegexCacheStats PatternValidator::getCacheStats()
 {
-    std::unique_lock<std::shared_mutex> lock(s_regex_cache_mutex);
-    s_regex_cache.clear();
-    s_cache_lookups = 0;
+    return s_regex_cache.stats();
 }
 
-std::pair<size_t, size_t> PatternValidator::getCacheStats()
+void PatternValidator::setCacheCapacity(size_t capacity)
 {
-    std::shared_lock<std::shared_mutex> lock(s_regex_cache_mutex);
-    return {s_regex_cache.size(), s_cache_lookups};
+    s_regex_cache.setCapacity(capacity);
 }
 
 } // namespace validators
 } // namespace configgui
-
@@ -5,9 +5,10 @@
 #define CONFIGGUI_VALIDATORS_PATTERN_VALIDATOR_H
 
 #include "ivalidator.h"
+#include "regex_backend.h"
+#include "regex_cache.h"
+#include <atomic>
 #include <regex>
-#include <unordered_map>
-#include <shared_mutex>
 #include <memory>
 
 namespace configgui {
@@ -20,8 +21,14 @@ namespace validators {
  * Checks that string values match regex patterns.
  * Supports "pattern" constraint from JSON Schema.
  *
- * OPTIMIZATION: Caches compiled regex patterns for reuse.
+ * OPTIMIZATION: Caches compiled regex patterns for reuse in a bounded
+ * RegexCache (sharded LRU, lock-free repeat lookups per thread).
  * Expected improvement: 10-50x faster for repeated patterns.
+ *
+ * Patterns compile with the LinearRegex automaton engine by default, so
+ * matching time is linear in the value and patterns such as "(a+)+$"
+ * cannot stall the caller; patterns outside its subset (backreferences,
+ * lookaround) fall back to std::regex. See setRegexBackend().
  */
 class PatternValidator : public IValidator
 {
@@ -36,6 +43,12 @@ public:
      */
     ValidationResult validate(const json& value, const json& schema) override;
 
+    /**
+     * @brief Check the pattern without building an error
+     * @return True if validate() would succeed
+     */
+    bool isValid(const json& value, const json& schema) override;
+
     /**
      * @brief Get validator name
      * @return "PatternValidator"
@@ -50,31 +63,50 @@ public:
 
     /**
      * @brief Get cache statistics for performance analysis
-     * @return pair<cached_patterns_count, total_lookups>
+     * @return Entry count, capacity and hit/miss/eviction counters
      */
-    static std::pair<size_t, size_t> getCacheStats();
+    static RegexCacheStats getCacheStats();
 
-private:
     /**
-     * @brief Check if string matches pattern with cached regex
-     * @param str String to match
-     * @param pattern Regex pattern
-     * @return True if matches
+     * @brief Bound the number of cached patterns
+     * @param capacity Maximum patterns (default RegexCache::kDefaultCapacity)
      */
-    bool matchesPattern(const std::string& str, const std::string& pattern) const;
+    static void setCacheCapacity(size_t capacity);
+
+    /**
+     * @brief Select the engine for patterns compiled from now on
+     * Clears the cache so every pattern is recompiled with the new engine
+     * @param backend RegexBackend::Linear (default) or RegexBackend::Std
+     */
+    static void setRegexBackend(RegexBackend backend);
+
+    /**
+     * @brief Engine currently used for new patterns
+     */
+    static RegexBackend getRegexBackend();
 
     /**
      * @brief Get or compile regex pattern from cache
-     * Thread-safe access to cached patterns
+     * Thread-safe access to cached patterns; also used by ValidatorProgram
+     * to bind a node's regex once at compile time
      * @param pattern Pattern string to compile
      * @return Shared pointer to compiled regex
+     * @throws std::regex_error if the pattern does not compile
+     */
+    static std::shared_ptr<const CompiledRegex> getCachedRegex(const std::string& pattern);
+
+private:
+    /**
+     * @brief Check if string matches pattern with cached regex
+     * @param str String to match
+     * @param pattern Regex pattern
+     * @return True if matches
      */
-    static std::shared_ptr<const std::regex> getCachedRegex(const std::string& pattern);
+    bool matchesPattern(const std::string& str, const std::string& pattern) const;
 
     // Static thread-safe regex cache
-    static std::shared_mutex s_regex_cache_mutex;
-    static std::unordered_map<std::string, std::shared_ptr<const std::regex>> s_regex_cache;
-    static size_t s_cache_lookups;
+    static RegexCache s_regex_cache;
+    static std::atomic<RegexBackend> s_backend;
 };
 
 } // namespace validators
@@ -2,101 +2,210 @@
 // RangeValidator - Implementation
 
 #include "range_validator.h"
-#include <sstream>
-#include <iomanip>
+#include <algorithm>
+#include <limits>
 
 namespace configgui {
 namespace validators {
 
-ValidationResult RangeValidator::validate(const json& value, const json& schema)
+namespace
 {
-    if (value.is_number())
+
+/// @brief Values outside the bounds; exclusive flags are template arguments so the loop has no branches
+template <bool ExclusiveMinimum, bool ExclusiveMaximum>
+size_t countKernel(const double* values, size_t count, double minimum, double maximum)
+{
+    // 64-bit counter: same lane width as the doubles, which lets the loop vectorize
+    std::uint64_t failed = 0;
+    for (size_t i = 0; i < count; ++i)
     {
-        return validateNumericRange(value, schema);
+        const double value = values[i];
+        const bool below = ExclusiveMinimum ? value <= minimum : value < minimum;
+        const bool above = ExclusiveMaximum ? value >= maximum : value > maximum;
+        failed += static_cast<std::uint64_t>(below | above);
     }
-    if (value.is_string())
+    return static_cast<size_t>(failed);
+}
+
+template <bool ExclusiveMinimum, bool ExclusiveMaximum>
+void flagKernel(const double* values, size_t count, double minimum, double maximum, std::uint8_t* flags)
+{
+    for (size_t i = 0; i < count; ++i)
     {
-        return validateStringLength(value, schema);
+        const double value = values[i];
+        const bool below = ExclusiveMinimum ? value <= minimum : value < minimum;
+        const bool above = ExclusiveMaximum ? value >= maximum : value > maximum;
+        flags[i] = below ? RangeValidator::kBelowMinimum : above ? RangeValidator::kAboveMaximum : 0;
     }
+}
 
-    return success();
+template <bool ExclusiveMinimum, bool ExclusiveMaximum>
+size_t checkRange(const double* values, size_t count, double minimum, double maximum, std::uint8_t* flags)
+{
+    // Failures are rare: count first, locate them only when there are any
+    const size_t failed = countKernel<ExclusiveMinimum, ExclusiveMaximum>(values, count, minimum, maximum);
+    if (failed == 0)
+    {
+        std::fill(flags, flags + count, std::uint8_t{0});
+        return 0;
+    }
+    flagKernel<ExclusiveMinimum, ExclusiveMaximum>(values, count, minimum, maximum, flags);
+    return failed;
 }
 
-ValidationResult RangeValidator::validateNumericRange(const json& value, const json& schema)
+/// @brief Per-thread scratch for validateBatch(), reused across batches
+thread_local std::vector<double> t_numbers;
+thread_local std::vector<std::uint8_t> t_flags;
+
+} // namespace
+
+NumericBounds NumericBounds::fromSchema(const json& schema)
 {
-    std::vector<ValidationError> errors;
+    NumericBounds bounds;
+    if (!schema.is_object())
+    {
+        return bounds;
+    }
+    auto boolFlag = [&schema](const char* key) {
+        const auto it = schema.find(key);
+        return it != schema.end() && it->is_boolean() && it->get<bool>();
+    };
+    const auto minimum = schema.find("minimum");
+    if (minimum != schema.end() && minimum->is_number())
+    {
+        bounds.has_minimum = true;
+        bounds.minimum = minimum->get<double>();
+        bounds.exclusive_minimum = boolFlag("exclusiveMinimum");
+    }
+    const auto maximum = schema.find("maximum");
+    if (maximum != schema.end() && maximum->is_number())
+    {
+        bounds.has_maximum = true;
+        bounds.maximum = maximum->get<double>();
+        bounds.exclusive_maximum = boolFlag("exclusiveMaximum");
+    }
+    return bounds;
+}
+
+size_t RangeValidator::flagOutOfRange(const double* values, size_t count, const NumericBounds& bounds,
+                                      std::uint8_t* flags)
+{
+    // A missing bound becomes an infinite inclusive one, which no value crosses
+    const double minimum = bounds.has_minimum ? bounds.minimum : -std::numeric_limits<double>::infinity();
+    const double maximum = bounds.has_maximum ? bounds.maximum : std::numeric_limits<double>::infinity();
+    const bool exclusive_minimum = bounds.has_minimum && bounds.exclusive_minimum;
+    const bool exclusive_maximum = bounds.has_maximum && bounds.exclusive_maximum;
 
-    // OPTIMIZATION: Early exit on first error if no minimum/maximum constraints
-    if (!schema.contains("minimum") && !schema.contains("maximum"))
+    if (exclusive_minimum)
     {
-        return success();
+        return exclusive_maximum ? checkRange<true, true>(values, count, minimum, maximum, flags)
+                                 : checkRange<true, false>(values, count, minimum, maximum, flags);
     }
+    return exclusive_maximum ? checkRange<false, true>(values, count, minimum, maximum, flags)
+                             : checkRange<false, false>(values, count, minimum, maximum, flags);
+}
 
-    if (schema.contains("minimum"))
+size_t RangeValidator::validateBatch(ValueSpan values, const json& schema, BatchErrors& errors)
+{
+    // Gather into a contiguous array; anything but numbers takes the per-value path
+    auto& numbers = t_numbers;
+    numbers.resize(values.size);
+    for (size_t i = 0; i < values.size; ++i)
     {
-        const auto minimum = schema["minimum"];
-        const bool exclusive = schema.contains("exclusiveMinimum") && schema["exclusiveMinimum"].is_boolean()
-                                   ? schema["exclusiveMinimum"].get<bool>()
-                                   : false;
+        if (!values[i].is_number())
+        {
+            return IValidator::validateBatch(values, schema, errors);
+        }
+        numbers[i] = values[i].get<double>();
+    }
+
+    const NumericBounds bounds = NumericBounds::fromSchema(schema);
+    if (!bounds.any())
+    {
+        return 0;
+    }
 
-        if (minimum.is_number())
+    auto& flags = t_flags;
+    flags.resize(values.size);
+    const size_t failed = flagOutOfRange(numbers.data(), values.size, bounds, flags.data());
+    if (failed == 0)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < values.size; ++i)
+    {
+        if (flags[i] == kBelowMinimum)
         {
-            const auto min_val = minimum.get<double>();
-            const auto val = value.get<double>();
-
-            if (exclusive && val <= min_val)
-            {
-                std::ostringstream oss;
-                oss << std::fixed << std::setprecision(2) << "Value must be greater than " << min_val;
-                errors.push_back(makeError("value", oss.str(), "BELOW_MINIMUM"));
-                // OPTIMIZATION: Return early for exclusive minimum failure
-                return failure(errors);
-            }
-            else if (!exclusive && val < min_val)
-            {
-                std::ostringstream oss;
-                oss << std::fixed << std::setprecision(2) << "Value must be at least " << min_val;
-                errors.push_back(makeError("value", oss.str(), "BELOW_MINIMUM"));
-                // OPTIMIZATION: Return early for inclusive minimum failure
-                return failure(errors);
-            }
+            errors.add(i, ValidationError::belowMinimum(bounds.minimum, bounds.exclusive_minimum));
+        }
+        else if (flags[i] == kAboveMaximum)
+        {
+            errors.add(i, ValidationError::aboveMaximum(bounds.maximum, bounds.exclusive_maximum));
         }
     }
+    return failed;
+}
 
-    if (schema.contains("maximum"))
+ValidationResult RangeValidator::validate(const json& value, const json& schema)
+{
+    if (value.is_number())
+    {
+        return validateNumericRange(value, schema);
+    }
+    if (value.is_string())
     {
-        const auto maximum = schema["maximum"];
-        const bool exclusive = schema.contains("exclusiveMaximum") && schema["exclusiveMaximum"].is_boolean()
-                                   ? schema["exclusiveMaximum"].get<bool>()
-                                   : false;
+        return validateStringLength(value, schema);
+    }
 
-        if (maximum.is_number())
+    return success();
+}
+
+bool RangeValidator::isValid(const json& value, const json& schema)
+{
+    if (value.is_number())
+    {
+        const NumericBounds bounds = NumericBounds::fromSchema(schema);
+        const auto val = value.get<double>();
+        const bool below = bounds.has_minimum && (bounds.exclusive_minimum ? val <= bounds.minimum : val < bounds.minimum);
+        const bool above = bounds.has_maximum && (bounds.exclusive_maximum ? val >= bounds.maximum : val > bounds.maximum);
+        return !below && !above;
+    }
+    if (value.is_string())
+    {
+        const auto length = static_cast<std::int64_t>(value.get_ref<const std::string&>().length());
+        const auto min_length = schema.find("minLength");
+        if (min_length != schema.end() && min_length->is_number_integer() && length < min_length->get<std::int64_t>())
         {
-            const auto max_val = maximum.get<double>();
-            const auto val = value.get<double>();
-
-            if (exclusive && val >= max_val)
-            {
-                std::ostringstream oss;
-                oss << std::fixed << std::setprecision(2) << "Value must be less than " << max_val;
-                errors.push_back(makeError("value", oss.str(), "ABOVE_MAXIMUM"));
-                return failure(errors);
-            }
-            else if (!exclusive && val > max_val)
-            {
-                std::ostringstream oss;
-                oss << std::fixed << std::setprecision(2) << "Value must be at most " << max_val;
-                errors.push_back(makeError("value", oss.str(), "ABOVE_MAXIMUM"));
-                return failure(errors);
-            }
+            return false;
         }
+        const auto max_length = schema.find("maxLength");
+        return max_length == schema.end() || !max_length->is_number_integer() ||
+               length <= max_length->get<std::int64_t>();
     }
+    return true;
+}
 
-    if (errors.empty())
+ValidationResult RangeValidator::validateNumericRange(const json& value, const json& schema)
+{
+    const NumericBounds bounds = NumericBounds::fromSchema(schema);
+    // OPTIMIZATION: Early exit if no minimum/maximum constraints
+    if (!bounds.any())
     {
         return success();
     }
-    return failure(errors);
+
+    const auto val = value.get<double>();
+    // A failed minimum ends the check
+    if (bounds.has_minimum && (bounds.exclusive_minimum ? val <= bounds.minimum : val < bounds.minimum))
+    {
+        return failure(ValidationError::belowMinimum(bounds.minimum, bounds.exclusive_minimum));
+    }
+    if (bounds.has_maximum && (bounds.exclusive_maximum ? val >= bounds.maximum : val > bounds.maximum))
+    {
+        return failure(ValidationError::aboveMaximum(bounds.maximum, bounds.exclusive_maximum));
+    }
+    return success();
 }
 
 ValidationResult RangeValidator::validateStringLength(const json& value, const json& schema)
@@ -106,35 +215,26 @@ ValidationResult RangeValidator::validateStringLength(const json& value, const j
         return success();
     }
 
-    std::vector<ValidationError> errors;
-    const auto str = value.get<std::string>();
-    const auto length = str.length();
+    ErrorList errors;
+    const auto length = static_cast<std::int64_t>(value.get_ref<const std::string&>().length());
 
-    if (schema.contains("minLength"))
+    const auto min_length = schema.find("minLength");
+    if (min_length != schema.end() && min_length->is_number_integer())
     {
-        if (schema["minLength"].is_number_integer())
+        const auto min_value = min_length->get<std::int64_t>();
+        if (length < min_value)
         {
-            const auto min_length = schema["minLength"].get<int>();
-            if (static_cast<int>(length) < min_length)
-            {
-                std::ostringstream oss;
-                oss << "String must be at least " << min_length << " characters";
-                errors.push_back(makeError("value", oss.str(), "STRING_TOO_SHORT"));
-            }
+            errors.push_back(ValidationError::stringTooShort(min_value));
         }
     }
 
-    if (schema.contains("maxLength"))
+    const auto max_length = schema.find("maxLength");
+    if (max_length != schema.end() && max_length->is_number_integer())
     {
-        if (schema["maxLength"].is_number_integer())
+        const auto max_value = max_length->get<std::int64_t>();
+        if (length > max_value)
         {
-            const auto max_length = schema["maxLength"].get<int>();
-            if (static_cast<int>(length) > max_length)
-            {
-                std::ostringstream oss;
-                oss << "String must be at most " << max_length << " characters";
-                errors.push_back(makeError("value", oss.str(), "STRING_TOO_LONG"));
-            }
+            errors.push_back(ValidationError::stringTooLong(max_value));
         }
     }
 
@@ -142,7 +242,7 @@ ValidationResult RangeValidator::validateStringLength(const json& value, const j
     {
         return success();
     }
-    return failure(errors);
+    return failure(std::move(errors));
 }
 
 } // namespace validators
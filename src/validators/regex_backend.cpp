@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+// RegexBackend - Implementation
+
+#include "regex_backend.h"
+#include "linear_regex.h"
+#include <regex>
+
+namespace configgui {
+namespace validators {
+
+namespace
+{
+
+class LinearCompiledRegex : public CompiledRegex
+{
+public:
+    explicit LinearCompiledRegex(std::unique_ptr<LinearRegex> regex)
+        : regex_(std::move(regex))
+    {
+    }
+
+    bool fullMatch(const std::string& text) const override { return regex_->fullMatch(text); }
+    const char* engine() const override { return "linear"; }
+
+private:
+    std::unique_ptr<LinearRegex> regex_;
+};
+
+class StdCompiledRegex : public CompiledRegex
+{
+public:
+    explicit StdCompiledRegex(const std::string& pattern)
+        : regex_(pattern)
+    {
+    }
+
+    bool fullMatch(const std::string& text) const override { return std::regex_match(text, regex_); }
+    const char* engine() const override { return "std"; }
+
+private:
+    std::regex regex_;
+};
+
+} // namespace
+
+std::shared_ptr<const CompiledRegex> CompiledRegex::compile(const std::string& pattern, RegexBackend backend)
+{
+    if (backend == RegexBackend::Linear)
+    {
+        if (auto linear = LinearRegex::compile(pattern))
+        {
+            return std::make_shared<const LinearCompiledRegex>(std::move(linear));
+        }
+    }
+    // Backreferences, lookaround and anything else outside the linear subset
+    return std::make_shared<const StdCompiledRegex>(pattern);
+}
+
+} // namespace validators
+} // namespace configgui
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+// RegexBackend - Pluggable regex engines for pattern validation
+
+#ifndef CONFIGGUI_VALIDATORS_REGEX_BACKEND_H
+#define CONFIGGUI_VALIDATORS_REGEX_BACKEND_H
+
+#include <memory>
+#include <string>
+
+namespace configgui {
+namespace validators {
+
+/**
+ * @enum RegexBackend
+ * @brief Engine used to compile "pattern" constraints
+ */
+enum class RegexBackend
+{
+    Linear,  ///< LinearRegex when the pattern is in its subset, std::regex otherwise (default)
+    Std      ///< Always std::regex
+};
+
+/**
+ * @class CompiledRegex
+ * @brief A compiled pattern, independent of the engine behind it
+ *
+ * Immutable; shared between threads through std::shared_ptr<const CompiledRegex>.
+ */
+class CompiledRegex
+{
+public:
+    virtual ~CompiledRegex() = default;
+
+    /**
+     * @brief Whole-string match with std::regex_match semantics
+     * @param text String to match
+     * @return True if the entire string matches
+     * @throws std::regex_error if std::regex gives up (error_complexity, error_stack)
+     */
+    virtual bool fullMatch(const std::string& text) const = 0;
+
+    /**
+     * @brief Engine that compiled the pattern: "linear" or "std"
+     */
+    virtual const char* engine() const = 0;
+
+    /**
+     * @brief Compile a pattern with the given backend
+     * @param pattern ECMAScript pattern
+     * @param backend Preferred engine
+     * @return Compiled pattern
+     * @throws std::regex_error if the pattern is invalid
+     */
+    static std::shared_ptr<const CompiledRegex> compile(const std::string& pattern, RegexBackend backend);
+};
+
+} // namespace validators
+} // namespace configgui
+
+#endif // CONFIGGUI_VALIDATORS_REGEX_BACKEND_H
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+// RegexCache - Implementation
+
+#include "regex_cache.h"
+#include <algorithm>
+#include <functional>
+
+namespace configgui {
+namespace validators {
+
+namespace
+{
+
+std::atomic<uint64_t> s_next_instance_id{1};
+std::atomic<size_t> s_next_stripe{0};
+
+/// @brief One thread's view of one cache: its recently used entries
+struct ThreadSnapshot {
+    uint64_t instance_id = 0;
+    uint64_t generation = 0;
+    std::unordered_map<std::string, std::pair<RegexBackend, std::shared_ptr<const CompiledRegex>>> entries;
+};
+
+thread_local ThreadSnapshot t_snapshot;
+thread_local size_t t_stripe = s_next_stripe.fetch_add(1, std::memory_order_relaxed);
+
+} // namespace
+
+RegexCache::RegexCache(size_t capacity)
+    : instance_id_(s_next_instance_id.fetch_add(1, std::memory_order_relaxed))
+    , shard_capacity_(perShard(capacity))
+{
+}
+
+size_t RegexCache::perShard(size_t capacity)
+{
+    return std::max<size_t>(1, (capacity + kShardCount - 1) / kShardCount);
+}
+
+RegexCache::Shard& RegexCache::shardFor(const std::string& pattern)
+{
+    return shards_[std::hash<std::string>{}(pattern) % kShardCount];
+}
+
+RegexCache::CounterStripe& RegexCache::stripe()
+{
+    return counters_[t_stripe % kShardCount];
+}
+
+std::shared_ptr<const CompiledRegex> RegexCache::get(const std::string& pattern, RegexBackend backend)
+{
+    // Lock-free path: this thread's snapshot, valid while the generation is unchanged
+    const uint64_t generation = generation_.load(std::memory_order_acquire);
+    ThreadSnapshot& snapshot = t_snapshot;
+    if (snapshot.instance_id != instance_id_ || snapshot.generation != generation)
+    {
+        snapshot.entries.clear();
+        snapshot.instance_id = instance_id_;
+        snapshot.generation = generation;
+    }
+
+    const auto local = snapshot.entries.find(pattern);
+    if (local != snapshot.entries.end() && local->second.first == backend)
+    {
+        stripe().hits.fetch_add(1, std::memory_order_relaxed);
+        return local->second.second;
+    }
+
+    auto regex = getShared(pattern, backend);
+    if (snapshot.entries.size() >= kThreadCacheSize)
+    {
+        snapshot.entries.clear();
+    }
+    snapshot.entries[pattern] = {backend, regex};
+    return regex;
+}
+
+std::shared_ptr<const CompiledRegex> RegexCache::getShared(const std::string& pattern, RegexBackend backend)
+{
+    Shard& shard = shardFor(pattern);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const auto it = shard.index.find(pattern);
+        if (it != shard.index.end() && it->second->backend == backend)
+        {
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            stripe().hits.fetch_add(1, std::memory_order_relaxed);
+            return it->second->regex;
+        }
+    }
+
+    // Compile outside the lock; a slow pattern must not block its whole shard
+    auto regex = CompiledRegex::compile(pattern, backend);
+    stripe().misses.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const auto it = shard.index.find(pattern);
+    if (it != shard.index.end())
+    {
+        if (it->second->backend == backend)
+        {
+            return it->second->regex;  // Another thread compiled it meanwhile
+        }
+        shard.lru.erase(it->second);
+        shard.index.erase(it);
+    }
+
+    shard.lru.push_front(Entry{pattern, backend, regex});
+    shard.index[pattern] = shard.lru.begin();
+    const size_t capacity = shard_capacity_.load(std::memory_order_relaxed);
+    while (shard.lru.size() > capacity)
+    {
+        shard.index.erase(shard.lru.back().pattern);
+        shard.lru.pop_back();
+        stripe().evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+    return regex;
+}
+
+void RegexCache::clear()
+{
+    for (auto& shard : shards_)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.lru.clear();
+        shard.index.clear();
+    }
+    for (auto& counters : counters_)
+    {
+        counters.hits.store(0, std::memory_order_relaxed);
+        counters.misses.store(0, std::memory_order_relaxed);
+        counters.evictions.store(0, std::memory_order_relaxed);
+    }
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void RegexCache::setCapacity(size_t capacity)
+{
+    const size_t per_shard = perShard(capacity);
+    shard_capacity_.store(per_shard, std::memory_order_relaxed);
+    for (auto& shard : shards_)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        while (shard.lru.size() > per_shard)
+        {
+            shard.index.erase(shard.lru.back().pattern);
+            shard.lru.pop_back();
+            stripe().evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+RegexCacheStats RegexCache::stats() const
+{
+    RegexCacheStats stats;
+    stats.capacity = shard_capacity_.load(std::memory_order_relaxed) * kShardCount;
+    for (const auto& shard : shards_)
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        stats.entries += shard.lru.size();
+    }
+    for (const auto& counters : counters_)
+    {
+        stats.hits += counters.hits.load(std::memory_order_relaxed);
+        stats.misses += counters.misses.load(std::memory_order_relaxed);
+        stats.evictions += counters.evictions.load(std::memory_order_relaxed);
+    }
+    stats.lookups = stats.hits + stats.misses;
+    return stats;
+}
+
+} // namespace validators
+} // namespace configgui
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: MIT
+// RegexCache - Bounded, sharded cache of compiled patterns
+
+#ifndef CONFIGGUI_VALIDATORS_REGEX_CACHE_H
+#define CONFIGGUI_VALIDATORS_REGEX_CACHE_H
+
+#include "regex_backend.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace configgui {
+namespace validators {
+
+/**
+ * @struct RegexCacheStats
+ * @brief Snapshot of RegexCache counters
+ */
+struct RegexCacheStats {
+    size_t entries = 0;     ///< Patterns held by the shared shards
+    size_t capacity = 0;    ///< Bound on entries
+    uint64_t lookups = 0;   ///< hits + misses
+    uint64_t hits = 0;      ///< Served without compiling
+    uint64_t misses = 0;    ///< Compiled
+    uint64_t evictions = 0; ///< Dropped to stay within capacity
+
+    /// @brief Fraction of lookups served without compiling (0 when idle)
+    double hitRate() const
+    {
+        return lookups > 0 ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0;
+    }
+};
+
+/**
+ * @class RegexCache
+ * @brief Thread-safe pattern -> CompiledRegex cache with a fixed size bound
+ *
+ * Entries live in kShardCount shards, each an LRU list behind its own
+ * mutex; a full shard evicts its least recently used pattern. Arbitrary
+ * patterns typed into the rule editor therefore cannot grow the cache
+ * without bound, and threads working on different patterns rarely meet
+ * on the same lock.
+ *
+ * OPTIMIZATION: Reads are lock-free in the steady state. Every thread
+ * keeps a small snapshot (up to kThreadCacheSize patterns) of the entries
+ * it has used and serves repeat lookups from it, touching no shared state
+ * except one atomic generation load; clear() bumps the generation, which
+ * retires all snapshots. Only misses in the snapshot take a shard lock.
+ * Recency is what the shards see, so snapshot hits do not refresh an
+ * entry's LRU position; an entry evicted from its shard stays valid in the
+ * snapshots that hold it until they are replaced.
+ *
+ * Counters are atomics striped across cache lines, so counting does not
+ * reintroduce the contention the snapshots avoid.
+ */
+class RegexCache
+{
+public:
+    static constexpr size_t kShardCount = 16;
+    static constexpr size_t kDefaultCapacity = 512;
+    static constexpr size_t kThreadCacheSize = 64;
+
+    /**
+     * @param capacity Maximum cached patterns (split evenly across shards, rounded up to at least one each)
+     */
+    explicit RegexCache(size_t capacity = kDefaultCapacity);
+
+    // Non-copyable, non-movable (threads hold snapshots tagged with this instance)
+    RegexCache(const RegexCache&) = delete;
+    RegexCache& operator=(const RegexCache&) = delete;
+
+    /**
+     * @brief Get or compile a pattern
+     * @param pattern ECMAScript pattern
+     * @param backend Engine to compile with (part of the key)
+     * @return Compiled pattern
+     * @throws std::regex_error if the pattern does not compile
+     */
+    std::shared_ptr<const CompiledRegex> get(const std::string& pattern, RegexBackend backend);
+
+    /**
+     * @brief Drop every entry and snapshot, and reset the counters
+     */
+    void clear();
+
+    /**
+     * @brief Change the bound, evicting immediately if needed
+     * @param capacity Maximum cached patterns
+     */
+    void setCapacity(size_t capacity);
+
+    /**
+     * @brief Current counters and size
+     */
+    RegexCacheStats stats() const;
+
+private:
+    struct Entry {
+        std::string pattern;
+        RegexBackend backend;
+        std::shared_ptr<const CompiledRegex> regex;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::list<Entry> lru;  ///< Most recently used first
+        std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    };
+
+    struct alignas(64) CounterStripe {
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> evictions{0};
+    };
+
+    Shard& shardFor(const std::string& pattern);
+    CounterStripe& stripe();
+    static size_t perShard(size_t capacity);
+
+    std::shared_ptr<const CompiledRegex> getShared(const std::string& pattern, RegexBackend backend);
+
+    const uint64_t instance_id_;
+    std::atomic<uint64_t> generation_{0};
+    std::atomic<size_t> shard_capacity_;
+    std::array<Shard, kShardCount> shards_;
+    std::array<CounterStripe, kShardCount> counters_;
+};
+
+} // namespace validators
+} // namespace configgui
+
+#endif // CONFIGGUI_VALIDATORS_REGEX_CACHE_H
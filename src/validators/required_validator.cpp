@@ -8,33 +8,33 @@ namespace validators {
 
 ValidationResult RequiredValidator::validate(const json& value, const json& schema)
 {
-    if (!value.is_object() || !schema.contains("required"))
+    if (!value.is_object())
     {
         return success();
     }
 
-    const auto& required = schema["required"];
-    if (!required.is_array())
+    const auto required = schema.find("required");
+    if (required == schema.end() || !required->is_array())
     {
         return success();
     }
 
-    std::vector<ValidationError> errors;
+    ErrorList errors;
 
-    for (const auto& field : required)
+    for (const auto& field : *required)
     {
         if (!field.is_string())
         {
             continue;
         }
 
-        const auto field_name = field.get<std::string>();
+        const auto& field_name = field.get_ref<const std::string&>();
 
         // Check if field exists and is not null
-        if (!value.contains(field_name) || value[field_name].is_null())
+        const auto it = value.find(field_name);
+        if (it == value.end() || it->is_null())
         {
-            std::string message = "Field '" + field_name + "' is required";
-            errors.push_back(makeError(field_name, message, "REQUIRED_FIELD_MISSING"));
+            errors.push_back(ValidationError::requiredFieldMissing(field_name));
         }
     }
 
@@ -42,7 +42,33 @@ ValidationResult RequiredValidator::validate(const json& value, const json& sche
     {
         return success();
     }
-    return failure(errors);
+    return failure(std::move(errors));
+}
+
+bool RequiredValidator::isValid(const json& value, const json& schema)
+{
+    if (!value.is_object())
+    {
+        return true;
+    }
+    const auto required = schema.find("required");
+    if (required == schema.end() || !required->is_array())
+    {
+        return true;
+    }
+    for (const auto& field : *required)
+    {
+        if (!field.is_string())
+        {
+            continue;
+        }
+        const auto it = value.find(field.get_ref<const std::string&>());
+        if (it == value.end() || it->is_null())
+        {
+            return false;
+        }
+    }
+    return true;
 }
 
 } // namespace validators
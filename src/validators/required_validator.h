@@ -29,6 +29,12 @@ public:
      */
     ValidationResult validate(const json& value, const json& schema) override;
 
+    /**
+     * @brief Check required fields, stopping at the first missing one without building an error
+     * @return True if validate() would succeed
+     */
+    bool isValid(const json& value, const json& schema) override;
+
     /**
      * @brief Get validator name
      * @return "RequiredValidator"
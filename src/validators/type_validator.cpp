@@ -8,56 +8,74 @@ namespace validators {
 
 ValidationResult TypeValidator::validate(const json& value, const json& schema)
 {
-    if (!schema.contains("type"))
+    const auto type_constraint = schema.find("type");
+    if (type_constraint == schema.end())
     {
         return success();
     }
 
-    const auto type_constraint = schema["type"];
-
-    if (type_constraint.is_string())
+    if (type_constraint->is_string())
     {
-        const auto type_str = type_constraint.get<std::string>();
+        const auto& type_str = type_constraint->get_ref<const std::string&>();
         if (!matchesType(value, type_str))
         {
-            const auto actual_type = getJsonType(value);
-            std::string message = "Expected type '" + type_str + "' but got '" + actual_type + "'";
-            return failure({makeError("value", message, "TYPE_MISMATCH")});
+            return failure(ValidationError::typeMismatch(std::make_shared<const std::string>(type_str), false,
+                                                         getJsonType(value)));
         }
     }
-    else if (type_constraint.is_array())
+    else if (type_constraint->is_array())
     {
-        bool found_match = false;
-        std::string allowed_types;
+        for (const auto& type : *type_constraint)
+        {
+            if (type.is_string() && matchesType(value, type.get_ref<const std::string&>()))
+            {
+                return success();
+            }
+        }
 
-        for (const auto& type : type_constraint)
+        // The allowed list is only needed for the message
+        std::string allowed_types;
+        for (const auto& type : *type_constraint)
         {
             if (type.is_string())
             {
-                const auto type_str = type.get<std::string>();
                 if (!allowed_types.empty())
                 {
                     allowed_types += ", ";
                 }
-                allowed_types += type_str;
-
-                if (matchesType(value, type_str))
-                {
-                    found_match = true;
-                    break;
-                }
+                allowed_types += type.get_ref<const std::string&>();
             }
         }
+        return failure(ValidationError::typeMismatch(std::make_shared<const std::string>(std::move(allowed_types)),
+                                                     true, getJsonType(value)));
+    }
+
+    return success();
+}
 
-        if (!found_match)
+bool TypeValidator::isValid(const json& value, const json& schema)
+{
+    const auto type_constraint = schema.find("type");
+    if (type_constraint == schema.end())
+    {
+        return true;
+    }
+    if (type_constraint->is_string())
+    {
+        return matchesType(value, type_constraint->get_ref<const std::string&>());
+    }
+    if (type_constraint->is_array())
+    {
+        for (const auto& type : *type_constraint)
         {
-            const auto actual_type = getJsonType(value);
-            std::string message = "Expected one of [" + allowed_types + "] but got '" + actual_type + "'";
-            return failure({makeError("value", message, "TYPE_MISMATCH")});
+            if (type.is_string() && matchesType(value, type.get_ref<const std::string&>()))
+            {
+                return true;
+            }
         }
+        return false;
     }
-
-    return success();
+    return true;
 }
 
 bool TypeValidator::matchesType(const json& value, const std::string& type_str) const
@@ -94,7 +112,7 @@ bool TypeValidator::matchesType(const json& value, const std::string& type_str)
     return false;
 }
 
-std::string TypeValidator::getJsonType(const json& value) const
+const char* TypeValidator::getJsonType(const json& value) const
 {
     if (value.is_string())
     {
@@ -29,6 +29,12 @@ public:
      */
     ValidationResult validate(const json& value, const json& schema) override;
 
+    /**
+     * @brief Check the type without building an error
+     * @return True if validate() would succeed
+     */
+    bool isValid(const json& value, const json& schema) override;
+
     /**
      * @brief Get validator name
      * @return "TypeValidator"
@@ -47,9 +53,9 @@ private:
     /**
      * @brief Get JSON type string
      * @param value Value to inspect
-     * @return Type name as string
+     * @return Type name (static string)
      */
-    std::string getJsonType(const json& value) const;
+    const char* getJsonType(const json& value) const;
 };
 
 } // namespace validators
@@ -0,0 +1,500 @@
+// SPDX-License-Identifier: MIT
+// ValidatorProgram - Implementation
+
+#include "validator_program.h"
+#include "pattern_validator.h"
+#include <algorithm>
+
+namespace configgui {
+namespace validators {
+
+namespace
+{
+
+constexpr std::uint8_t bit(TypeTag tag)
+{
+    return static_cast<std::uint8_t>(tag);
+}
+
+std::uint8_t tagForName(const std::string& name)
+{
+    if (name == "string")
+    {
+        return bit(TypeTag::String);
+    }
+    if (name == "integer")
+    {
+        return bit(TypeTag::Integer);
+    }
+    if (name == "number")
+    {
+        return bit(TypeTag::Number);
+    }
+    if (name == "boolean")
+    {
+        return bit(TypeTag::Boolean);
+    }
+    if (name == "object")
+    {
+        return bit(TypeTag::Object);
+    }
+    if (name == "array")
+    {
+        return bit(TypeTag::Array);
+    }
+    if (name == "null")
+    {
+        return bit(TypeTag::Null);
+    }
+    return 0;  // Unknown names match nothing, as in TypeValidator
+}
+
+/// @brief Type name reported for a value (same wording as TypeValidator)
+const char* typeName(const json& value)
+{
+    if (value.is_string())
+    {
+        return "string";
+    }
+    if (value.is_number_integer())
+    {
+        return "integer";
+    }
+    if (value.is_number_float())
+    {
+        return "number";
+    }
+    if (value.is_boolean())
+    {
+        return "boolean";
+    }
+    if (value.is_object())
+    {
+        return "object";
+    }
+    if (value.is_array())
+    {
+        return "array";
+    }
+    if (value.is_null())
+    {
+        return "null";
+    }
+    return "unknown";
+}
+
+/// @brief Per-thread scratch for runBatch(), reused across batches
+thread_local std::vector<double> t_numbers;
+thread_local std::vector<std::uint8_t> t_range_flags;
+thread_local std::vector<std::uint8_t> t_type_flags;
+
+} // namespace
+
+ValidatorProgram ValidatorProgram::compile(const json& schema)
+{
+    ValidatorProgram program;
+    if (!schema.is_object())
+    {
+        return program;
+    }
+
+    // TypeValidator
+    const auto type = schema.find("type");
+    if (type != schema.end() && (type->is_string() || type->is_array()))
+    {
+        if (type->is_string())
+        {
+            const auto& name = type->get_ref<const std::string&>();
+            program.type_mask_ = tagForName(name);
+            program.type_expected_ = std::make_shared<const std::string>(name);
+        }
+        else
+        {
+            std::string allowed;
+            for (const auto& name : *type)
+            {
+                if (name.is_string())
+                {
+                    allowed += (allowed.empty() ? "" : ", ") + name.get<std::string>();
+                    program.type_mask_ = static_cast<std::uint8_t>(program.type_mask_ |
+                                                                   tagForName(name.get<std::string>()));
+                }
+            }
+            program.type_expected_ = std::make_shared<const std::string>(std::move(allowed));
+            program.type_one_of_ = true;
+        }
+        program.ops_.push_back(Op::Type);
+    }
+
+    // RangeValidator: numbers
+    program.bounds_ = NumericBounds::fromSchema(schema);
+    if (program.bounds_.any())
+    {
+        program.ops_.push_back(Op::NumberRange);
+    }
+
+    // RangeValidator: strings
+    const auto min_length = schema.find("minLength");
+    if (min_length != schema.end() && min_length->is_number_integer())
+    {
+        program.has_min_length_ = true;
+        program.min_length_ = min_length->get<std::int64_t>();
+    }
+    const auto max_length = schema.find("maxLength");
+    if (max_length != schema.end() && max_length->is_number_integer())
+    {
+        program.has_max_length_ = true;
+        program.max_length_ = max_length->get<std::int64_t>();
+    }
+    if (program.has_min_length_ || program.has_max_length_)
+    {
+        program.ops_.push_back(Op::StringLength);
+    }
+
+    // EnumValidator
+    const auto enums = schema.find("enum");
+    if (enums != schema.end() && enums->is_array())
+    {
+        program.enum_index_ = std::make_shared<const EnumIndex>(*enums);
+        program.enum_message_ =
+            std::shared_ptr<const std::string>(program.enum_index_, &program.enum_index_->errorMessage());
+        program.ops_.push_back(Op::Enum);
+    }
+
+    // PatternValidator (an invalid pattern never fails validation there either)
+    const auto pattern = schema.find("pattern");
+    if (pattern != schema.end() && pattern->is_string())
+    {
+        const auto& source = pattern->get_ref<const std::string&>();
+        try
+        {
+            program.regex_ = PatternValidator::getCachedRegex(source);
+            program.pattern_ = std::make_shared<const std::string>(source);
+            program.ops_.push_back(Op::Pattern);
+        }
+        catch (const std::regex_error&)
+        {
+            program.regex_.reset();
+        }
+    }
+
+    // RequiredValidator
+    const auto required = schema.find("required");
+    if (required != schema.end() && required->is_array())
+    {
+        for (const auto& key : *required)
+        {
+            if (key.is_string())
+            {
+                program.required_.push_back(key.get<std::string>());
+            }
+        }
+        if (!program.required_.empty())
+        {
+            program.ops_.push_back(Op::Required);
+        }
+    }
+
+    return program;
+}
+
+ValidationResult ValidatorProgram::run(const json& value) const
+{
+    ValidationResult result{true, {}};
+    for (const Op op : ops_)
+    {
+        switch (op)
+        {
+            case Op::Type:
+                checkType(value, result.errors);
+                break;
+            case Op::NumberRange:
+                checkNumberRange(value, result.errors);
+                break;
+            case Op::StringLength:
+                checkStringLength(value, result.errors);
+                break;
+            case Op::Enum:
+                checkEnum(value, result.errors);
+                break;
+            case Op::Pattern:
+                checkPattern(value, result.errors);
+                break;
+            case Op::Required:
+                checkRequired(value, result.errors);
+                break;
+        }
+    }
+    result.is_valid = result.errors.empty();
+    return result;
+}
+
+bool ValidatorProgram::isValid(const json& value) const
+{
+    for (const Op op : ops_)
+    {
+        bool passed = true;
+        switch (op)
+        {
+            case Op::Type:
+                passed = (type_mask_ & typeBits(value)) != 0;
+                break;
+            case Op::NumberRange:
+                if (value.is_number())
+                {
+                    const auto number = value.get<double>();
+                    passed = !(bounds_.has_minimum &&
+                               (bounds_.exclusive_minimum ? number <= bounds_.minimum : number < bounds_.minimum)) &&
+                             !(bounds_.has_maximum &&
+                               (bounds_.exclusive_maximum ? number >= bounds_.maximum : number > bounds_.maximum));
+                }
+                break;
+            case Op::StringLength:
+                if (value.is_string())
+                {
+                    const auto length = static_cast<std::int64_t>(value.get_ref<const std::string&>().length());
+                    passed = !(has_min_length_ && length < min_length_) && !(has_max_length_ && length > max_length_);
+                }
+                break;
+            case Op::Enum:
+                passed = enum_index_->contains(value);
+                break;
+            case Op::Pattern:
+                passed = !value.is_string() || patternMatches(value.get_ref<const std::string&>());
+                break;
+            case Op::Required:
+                if (value.is_object())
+                {
+                    passed = std::all_of(required_.begin(), required_.end(), [&value](const std::string& key) {
+                        const auto it = value.find(key);
+                        return it != value.end() && !it->is_null();
+                    });
+                }
+                break;
+        }
+        if (!passed)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::size_t ValidatorProgram::runBatch(ValueSpan values, BatchErrors& errors) const
+{
+    std::size_t failed = 0;
+    if (runNumericBatch(values, errors, failed))
+    {
+        return failed;
+    }
+
+    for (std::size_t i = 0; i < values.size; ++i)
+    {
+        auto result = run(values[i]);
+        if (!result.is_valid)
+        {
+            ++failed;
+            for (auto& error : result.errors)
+            {
+                errors.add(i, std::move(error));
+            }
+        }
+    }
+    return failed;
+}
+
+bool ValidatorProgram::runNumericBatch(ValueSpan values, BatchErrors& errors, std::size_t& failed) const
+{
+    bool has_type = false;
+    bool has_range = false;
+    for (const Op op : ops_)
+    {
+        if (op == Op::Type)
+        {
+            has_type = true;
+        }
+        else if (op == Op::NumberRange)
+        {
+            has_range = true;
+        }
+        else if (op != Op::StringLength && op != Op::Pattern && op != Op::Required)
+        {
+            return false;  // Enum looks at each value itself
+        }
+    }
+
+    // Gather; a type check remains only when the mask does not accept every number
+    const bool check_type = has_type && (type_mask_ & bit(TypeTag::Number)) == 0;
+    auto& numbers = t_numbers;
+    auto& type_flags = t_type_flags;
+    numbers.resize(values.size);
+    type_flags.resize(check_type ? values.size : 0);
+    std::size_t type_failures = 0;
+    for (std::size_t i = 0; i < values.size; ++i)
+    {
+        const json& value = values[i];
+        if (!value.is_number())
+        {
+            return false;
+        }
+        numbers[i] = value.get<double>();
+        if (check_type)
+        {
+            const bool mismatch = (type_mask_ & typeBits(value)) == 0;
+            type_flags[i] = mismatch ? 1 : 0;
+            type_failures += mismatch ? 1u : 0u;
+        }
+    }
+
+    auto& range_flags = t_range_flags;
+    std::size_t range_failures = 0;
+    if (has_range)
+    {
+        range_flags.resize(values.size);
+        range_failures = RangeValidator::flagOutOfRange(numbers.data(), values.size, bounds_, range_flags.data());
+    }
+    if (type_failures == 0 && range_failures == 0)
+    {
+        return true;
+    }
+
+    // Report in run() order: type, then bounds
+    for (std::size_t i = 0; i < values.size; ++i)
+    {
+        const bool type_failed = check_type && type_flags[i] != 0;
+        const std::uint8_t range_flag = has_range ? range_flags[i] : 0;
+        if (!type_failed && range_flag == 0)
+        {
+            continue;
+        }
+        ++failed;
+        if (type_failed)
+        {
+            errors.add(i, ValidationError::typeMismatch(type_expected_, type_one_of_, typeName(values[i])));
+        }
+        if (range_flag == RangeValidator::kBelowMinimum)
+        {
+            errors.add(i, ValidationError::belowMinimum(bounds_.minimum, bounds_.exclusive_minimum));
+        }
+        else if (range_flag == RangeValidator::kAboveMaximum)
+        {
+            errors.add(i, ValidationError::aboveMaximum(bounds_.maximum, bounds_.exclusive_maximum));
+        }
+    }
+    return true;
+}
+
+std::uint8_t ValidatorProgram::typeBits(const json& value)
+{
+    switch (value.type())
+    {
+        case json::value_t::null:
+            return bit(TypeTag::Null);
+        case json::value_t::boolean:
+            return bit(TypeTag::Boolean);
+        case json::value_t::number_integer:
+        case json::value_t::number_unsigned:
+            return bit(TypeTag::Integer) | bit(TypeTag::Number);
+        case json::value_t::number_float:
+            return bit(TypeTag::Number);
+        case json::value_t::string:
+            return bit(TypeTag::String);
+        case json::value_t::array:
+            return bit(TypeTag::Array);
+        case json::value_t::object:
+            return bit(TypeTag::Object);
+        default:
+            return 0;
+    }
+}
+
+void ValidatorProgram::checkType(const json& value, ErrorList& errors) const
+{
+    if ((type_mask_ & typeBits(value)) == 0)
+    {
+        errors.push_back(ValidationError::typeMismatch(type_expected_, type_one_of_, typeName(value)));
+    }
+}
+
+void ValidatorProgram::checkNumberRange(const json& value, ErrorList& errors) const
+{
+    if (!value.is_number())
+    {
+        return;
+    }
+    const auto number = value.get<double>();
+    // A failed minimum ends the check, as in RangeValidator
+    if (bounds_.has_minimum && (bounds_.exclusive_minimum ? number <= bounds_.minimum : number < bounds_.minimum))
+    {
+        errors.push_back(ValidationError::belowMinimum(bounds_.minimum, bounds_.exclusive_minimum));
+        return;
+    }
+    if (bounds_.has_maximum && (bounds_.exclusive_maximum ? number >= bounds_.maximum : number > bounds_.maximum))
+    {
+        errors.push_back(ValidationError::aboveMaximum(bounds_.maximum, bounds_.exclusive_maximum));
+    }
+}
+
+void ValidatorProgram::checkStringLength(const json& value, ErrorList& errors) const
+{
+    if (!value.is_string())
+    {
+        return;
+    }
+    const auto length = static_cast<std::int64_t>(value.get_ref<const std::string&>().length());
+    if (has_min_length_ && length < min_length_)
+    {
+        errors.push_back(ValidationError::stringTooShort(min_length_));
+    }
+    if (has_max_length_ && length > max_length_)
+    {
+        errors.push_back(ValidationError::stringTooLong(max_length_));
+    }
+}
+
+void ValidatorProgram::checkEnum(const json& value, ErrorList& errors) const
+{
+    if (!enum_index_->contains(value))
+    {
+        errors.push_back(ValidationError::enumMismatch(enum_message_));
+    }
+}
+
+void ValidatorProgram::checkPattern(const json& value, ErrorList& errors) const
+{
+    if (value.is_string() && !patternMatches(value.get_ref<const std::string&>()))
+    {
+        errors.push_back(ValidationError::patternMismatch(pattern_));
+    }
+}
+
+bool ValidatorProgram::patternMatches(const std::string& text) const
+{
+    try
+    {
+        return regex_->fullMatch(text);
+    }
+    catch (const std::regex_error&)
+    {
+        return true;  // Too complex to match: PatternValidator lets the value through
+    }
+}
+
+void ValidatorProgram::checkRequired(const json& value, ErrorList& errors) const
+{
+    if (!value.is_object())
+    {
+        return;
+    }
+    for (const auto& key : required_)
+    {
+        const auto it = value.find(key);
+        if (it == value.end() || it->is_null())
+        {
+            errors.push_back(ValidationError::requiredFieldMissing(key));
+        }
+    }
+}
+
+} // namespace validators
+} // namespace configgui
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: MIT
+// ValidatorProgram - Pre-bound validator chain for one schema node
+
+#ifndef CONFIGGUI_VALIDATORS_VALIDATOR_PROGRAM_H
+#define CONFIGGUI_VALIDATORS_VALIDATOR_PROGRAM_H
+
+#include "enum_index.h"
+#include "ivalidator.h"
+#include "range_validator.h"
+#include "regex_backend.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace configgui {
+namespace validators {
+
+/**
+ * @enum TypeTag
+ * @brief JSON Schema "type" names as bits, so a union of types is one mask
+ */
+enum class TypeTag : std::uint8_t
+{
+    None = 0,
+    Null = 1u << 0,
+    Boolean = 1u << 1,
+    Integer = 1u << 2,
+    Number = 1u << 3,
+    String = 1u << 4,
+    Array = 1u << 5,
+    Object = 1u << 6
+};
+
+/**
+ * @class ValidatorProgram
+ * @brief A schema node compiled into the checks of the IValidator family
+ *
+ * Runs TypeValidator, RangeValidator, EnumValidator, PatternValidator and
+ * RequiredValidator in that order and reports the same errors, but reads the
+ * schema only once, in compile(): the type becomes a TypeTag mask, bounds
+ * become doubles, the enum a hash set, the pattern a compiled regex handle
+ * and "required" a key list. Schema text quoted by error messages is shared
+ * with the errors instead of being copied into each.
+ *
+ * OPTIMIZATION: run() performs no schema lookups and allocates nothing when
+ * the value is valid, nor for one or two errors, where the interpreted chain
+ * repeats lookups on the schema on every call.
+ * Immutable after compile(), so one program can be shared across threads.
+ */
+class ValidatorProgram
+{
+public:
+    /**
+     * @brief Compile a schema node
+     * @param schema Schema object (anything else compiles to an empty program)
+     * @return Program equivalent to the interpreted validator chain
+     */
+    static ValidatorProgram compile(const json& schema);
+
+    /**
+     * @brief Validate a value against the compiled node
+     * @param value Value to check
+     * @return ValidationResult (errors in validator chain order)
+     */
+    ValidationResult run(const json& value) const;
+
+    /**
+     * @brief Check a value against the compiled node without reporting errors
+     *
+     * OPTIMIZATION: Returns at the first failing instruction and creates no
+     * ValidationError, for callers that only need a yes/no answer.
+     * @param value Value to check
+     * @return True if run() would report no errors
+     */
+    bool isValid(const json& value) const;
+
+    /**
+     * @brief Validate a run of values against the compiled node
+     *
+     * OPTIMIZATION: A program made only of type and numeric bound checks,
+     * given numbers only (a homogeneous numeric array), gathers them into
+     * a contiguous array of doubles and checks the bounds with
+     * RangeValidator::flagOutOfRange(), which the compiler vectorizes.
+     * Errors go to the caller's buffer, which keeps its storage between
+     * batches. Other batches run() each value.
+     * @param values Values to check (e.g. ValueSpan::of(array))
+     * @param errors Buffer the errors are appended to
+     * @return Number of values that failed
+     */
+    std::size_t runBatch(ValueSpan values, BatchErrors& errors) const;
+
+    /**
+     * @brief Number of bound instructions (0 = accepts everything)
+     */
+    std::size_t size() const { return ops_.size(); }
+
+    /**
+     * @brief TypeTag bits accepted by "type" (TypeTag::None when unconstrained)
+     */
+    std::uint8_t typeMask() const { return type_mask_; }
+
+private:
+    enum class Op : std::uint8_t
+    {
+        Type,
+        NumberRange,
+        StringLength,
+        Enum,
+        Pattern,
+        Required
+    };
+
+    /// @brief Bits of TypeTag a value satisfies (integers are numbers too)
+    static std::uint8_t typeBits(const json& value);
+
+    void checkType(const json& value, ErrorList& errors) const;
+    void checkNumberRange(const json& value, ErrorList& errors) const;
+    void checkStringLength(const json& value, ErrorList& errors) const;
+    void checkEnum(const json& value, ErrorList& errors) const;
+    void checkPattern(const json& value, ErrorList& errors) const;
+    void checkRequired(const json& value, ErrorList& errors) const;
+
+    /// @brief Pattern check shared by checkPattern() and isValid() (true when not matchable)
+    bool patternMatches(const std::string& text) const;
+
+    std::vector<Op> ops_;
+
+    // Type
+    std::uint8_t type_mask_ = 0;
+    std::shared_ptr<const std::string> type_expected_;  ///< Type name, or the allowed list when type_one_of_
+    bool type_one_of_ = false;
+
+    /// @brief runBatch() over numbers only, when the program allows it
+    bool runNumericBatch(ValueSpan values, BatchErrors& errors, std::size_t& failed) const;
+
+    // Numeric bounds
+    NumericBounds bounds_;
+
+    // String length
+    bool has_min_length_ = false;
+    bool has_max_length_ = false;
+    std::int64_t min_length_ = 0;
+    std::int64_t max_length_ = 0;
+
+    // Enum
+    std::shared_ptr<const EnumIndex> enum_index_;
+    std::shared_ptr<const std::string> enum_message_;  ///< Aliases enum_index_'s message
+
+    // Pattern (null when the pattern does not compile; PatternValidator ignores it then)
+    std::shared_ptr<const CompiledRegex> regex_;
+    std::shared_ptr<const std::string> pattern_;
+
+    // Required keys
+    std::vector<std::string> required_;
+};
+
+} // namespace validators
+} // namespace configgui
+
+#endif // CONFIGGUI_VALIDATORS_VALIDATOR_PROGRAM_H
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: MIT
+// Batch validation throughput: a sequential validateAll loop against
+// BatchValidator at increasing worker counts, all sharing one compiled schema.
+// Reports documents per second and the scaling relative to one thread.
+
+#include "bench_common.h"
+#include "core/schema/batch_validator.h"
+#include "core/schema/schema_validator.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace configgui::core;
+
+int main(int argc, char* argv[])
+{
+    const std::size_t document_count = (argc > 1) ? std::stoul(argv[1]) : 10000;
+    constexpr std::size_t kFields = 40;
+
+    json schema = {{"type", "object"}, {"properties", json::object()}, {"required", json::array()}};
+    for (std::size_t i = 0; i < kFields; ++i) {
+        const std::string name = "field_" + std::to_string(i);
+        schema["properties"][name] = (i % 2 == 0)
+            ? json{{"type", "integer"}, {"minimum", 0}, {"maximum", 1000}}
+            : json{{"type", "string"}, {"minLength", 1}, {"maxLength", 64}};
+        schema["required"].push_back(name);
+    }
+
+    // Tenant configs; every tenth one carries a few violations
+    std::vector<json> documents;
+    documents.reserve(document_count);
+    for (std::size_t d = 0; d < document_count; ++d) {
+        json document = json::object();
+        for (std::size_t i = 0; i < kFields; ++i) {
+            const std::string name = "field_" + std::to_string(i);
+            if (i % 2 == 0) {
+                document[name] = (d % 10 == 0 && i < 6) ? 5000 : static_cast<int>((d + i) % 1000);
+            } else {
+                document[name] = "tenant-" + std::to_string(d);
+            }
+        }
+        documents.push_back(std::move(document));
+    }
+
+    auto validator = std::make_shared<const SchemaValidator>(schema);
+    std::printf("Batch validation benchmark (%zu documents, %zu fields, compiled plan: %s)\n",
+                document_count, kFields, validator->usesCompiledPlan() ? "yes" : "no");
+
+    std::size_t sequential_errors = 0;
+    const double sequential_us = bench::time_once([&]() {
+        for (const auto& document : documents) {
+            sequential_errors += validator->validateAll(document).size();
+        }
+    });
+    const double sequential_rate = 1e6 * static_cast<double>(document_count) / sequential_us;
+    std::printf("  sequential loop          %10.0f docs/s (%zu errors)\n", sequential_rate, sequential_errors);
+
+    const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    double single_rate = 0.0;
+    for (std::size_t workers = 1; workers <= hardware; workers *= 2) {
+        BatchValidator batch(validator, workers);
+        const auto stats = batch.validateDocuments(documents, nullptr);
+        const double rate = stats.documentsPerSecond();
+        if (workers == 1) {
+            single_rate = rate;
+        }
+        std::printf("  BatchValidator %2zu thread(s) %10.0f docs/s (%zu errors, %.2fx vs 1 thread)\n",
+                    stats.workers, rate, stats.errors, rate / single_rate);
+        if (workers * 2 > hardware && workers != hardware) {
+            workers = hardware / 2;  // Finish with exactly the hardware thread count
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT
+// Batch validation: one schema constraint over a 1M-element numeric array,
+// value by value through validate()/run() against the span APIs that read
+// the schema once and check bounds over a contiguous array of doubles.
+// One value in a thousand is out of range.
+
+#include "bench_common.h"
+#include "validators/range_validator.h"
+#include "validators/validator_program.h"
+#include <string>
+#include <vector>
+
+using namespace configgui::validators;
+
+namespace {
+
+json makeValues(std::size_t count, bool integers)
+{
+    json values = json::array();
+    auto& elements = values.get_ref<json::array_t&>();
+    elements.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const bool violation = i % 1000 == 999;
+        if (integers) {
+            elements.emplace_back(violation ? 70000 : static_cast<int>(1 + i % 65535));
+        } else {
+            elements.emplace_back(violation ? -0.5 : static_cast<double>(i % 1000) * 0.001);
+        }
+    }
+    return values;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t count = (argc > 1) ? std::stoul(argv[1]) : 1000000;
+    constexpr std::size_t kIterations = 10;
+
+    struct Case {
+        const char* name;
+        json schema;
+        json values;
+    };
+    const std::vector<Case> cases = {
+        {"integer port range", {{"type", "integer"}, {"minimum", 1}, {"maximum", 65535}}, makeValues(count, true)},
+        {"number ratio (exclusive)",
+         {{"type", "number"}, {"minimum", 0}, {"maximum", 1}, {"exclusiveMaximum", true}},
+         makeValues(count, false)},
+    };
+
+    std::printf("Batch validation benchmark (%zu values per sample)\n", count);
+
+    std::size_t sink = 0;
+    for (const auto& c : cases) {
+        std::printf("\n%s\n", c.name);
+        const ValueSpan span = ValueSpan::of(c.values);
+        BatchErrors errors;
+
+        RangeValidator range;
+        const auto per_value = bench::measure(kIterations, [&](std::size_t) {
+            for (std::size_t i = 0; i < span.size; ++i) {
+                sink += range.validate(span[i], c.schema).errors.size();
+            }
+        });
+        const auto range_batch = bench::measure(kIterations, [&](std::size_t) {
+            errors.clear();
+            sink += range.validateBatch(span, c.schema, errors);
+        });
+        bench::report("RangeValidator::validate per value", per_value);
+        bench::report("RangeValidator::validateBatch", range_batch);
+
+        const auto program = ValidatorProgram::compile(c.schema);
+        const auto program_run = bench::measure(kIterations, [&](std::size_t) {
+            for (std::size_t i = 0; i < span.size; ++i) {
+                sink += program.run(span[i]).errors.size();
+            }
+        });
+        const auto program_batch = bench::measure(kIterations, [&](std::size_t) {
+            errors.clear();
+            sink += program.runBatch(span, errors);
+        });
+        bench::report("ValidatorProgram::run per value", program_run);
+        bench::report("ValidatorProgram::runBatch", program_batch);
+
+        std::printf("  %zu errors per batch; speedup %.1fx (range), %.1fx (program)\n", errors.size(),
+                    per_value.median_us / range_batch.median_us, program_run.median_us / program_batch.median_us);
+    }
+
+    std::printf("\n(sink %zu)\n", sink);
+    return 0;
+}
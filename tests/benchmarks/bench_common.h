@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: MIT
+// Common timing helpers for benchmark executables
+
+#ifndef TESTS_BENCHMARKS_BENCH_COMMON_H
+#define TESTS_BENCHMARKS_BENCH_COMMON_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+/**
+ * @struct Stats
+ * @brief Summary of repeated timing samples (microseconds)
+ */
+struct Stats {
+    double min_us = 0.0;
+    double median_us = 0.0;
+    double p99_us = 0.0;
+    double total_us = 0.0;
+    std::size_t samples = 0;
+};
+
+/**
+ * @brief Run a callable repeatedly and collect per-iteration latency
+ * @param iterations Number of timed calls
+ * @param fn Callable to time
+ * @return Latency summary
+ */
+template <typename Fn>
+Stats measure(std::size_t iterations, Fn&& fn)
+{
+    std::vector<double> samples;
+    samples.reserve(iterations);
+
+    for (std::size_t i = 0; i < iterations; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        fn(i);
+        const auto end = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+
+    Stats stats;
+    if (samples.empty()) {
+        return stats;
+    }
+    std::sort(samples.begin(), samples.end());
+    stats.samples = samples.size();
+    stats.min_us = samples.front();
+    stats.median_us = samples[samples.size() / 2];
+    stats.p99_us = samples[std::min(samples.size() - 1, (samples.size() * 99) / 100)];
+    for (double s : samples) {
+        stats.total_us += s;
+    }
+    return stats;
+}
+
+/**
+ * @brief Time a single call of a callable
+ * @return Elapsed wall time in microseconds
+ */
+template <typename Fn>
+double time_once(Fn&& fn)
+{
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+/// Print one result row in a fixed-width table
+inline void report(const std::string& name, const Stats& stats)
+{
+    std::printf("%-44s n=%-7zu min=%10.2fus  median=%10.2fus  p99=%10.2fus\n",
+                name.c_str(), stats.samples, stats.min_us, stats.median_us, stats.p99_us);
+}
+
+} // namespace bench
+
+#endif // TESTS_BENCHMARKS_BENCH_COMMON_H
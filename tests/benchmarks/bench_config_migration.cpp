@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: MIT
+// Config migration throughput: SchemaDiff over two schema versions, then
+// ConfigMigrator streaming 10k config files (load, migrate, validate, write
+// back atomically) at increasing worker counts, then once more with
+// target-schema validation. A naive per-file load/fix/save loop
+// that re-walks both schemas for every config is shown for reference.
+// Pass a config count as the first argument.
+
+#include "bench_common.h"
+#include "core/schema/config_migrator.h"
+#include "core/schema/schema_validator.h"
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace configgui::core;
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr std::size_t kFields = 40;
+
+// v1 -> v2: every 8th field renamed, every 8th removed, every 8th retyped
+// (string -> integer), plus a few new fields with defaults
+void buildSchemas(json& v1, json& v2)
+{
+    v1 = {{"type", "object"}, {"properties", json::object()}};
+    v2 = {{"type", "object"}, {"properties", json::object()}, {"required", json::array()}};
+    for (std::size_t i = 0; i < kFields; ++i) {
+        const std::string name = "field_" + std::to_string(i);
+        const bool numeric = (i % 8 == 2);
+        v1["properties"][name] = numeric ? json{{"type", "string"}}
+                                         : json{{"type", "string"}, {"maxLength", 64 + i}};
+        switch (i % 8) {
+            case 0:
+                v2["properties"]["renamed_" + std::to_string(i)] = v1["properties"][name];
+                break;
+            case 1:
+                break;  // Removed
+            case 2:
+                v2["properties"][name] = {{"type", "integer"}};
+                break;
+            default:
+                v2["properties"][name] = v1["properties"][name];
+                break;
+        }
+    }
+    for (std::size_t i = 0; i < 5; ++i) {
+        const std::string name = "added_" + std::to_string(i);
+        v2["properties"][name] = {{"type", "integer"}, {"default", static_cast<int>(i)}};
+        v2["required"].push_back(name);
+    }
+}
+
+json oldConfig(std::size_t d)
+{
+    json config = json::object();
+    for (std::size_t i = 0; i < kFields; ++i) {
+        config["field_" + std::to_string(i)] = (i % 8 == 2) ? std::to_string(d + i) : "value-" + std::to_string(d);
+    }
+    return config;
+}
+
+void writeConfigs(const std::vector<std::string>& paths)
+{
+    for (std::size_t d = 0; d < paths.size(); ++d) {
+        std::ofstream(paths[d]) << oldConfig(d).dump(4);
+    }
+}
+
+// What a hand-written migration does per file: look every field up in both schemas
+void naiveMigrate(json& config, const json& v1, const json& v2)
+{
+    json migrated = json::object();
+    for (auto it = config.begin(); it != config.end(); ++it) {
+        if (v2["properties"].contains(it.key())) {
+            migrated[it.key()] = it.value();
+            if (v2["properties"][it.key()]["type"] == "integer" && it.value().is_string()) {
+                migrated[it.key()] = std::stoll(it.value().get<std::string>());
+            }
+            continue;
+        }
+        for (auto candidate = v2["properties"].begin(); candidate != v2["properties"].end(); ++candidate) {
+            if (!v1["properties"].contains(candidate.key()) && candidate.value() == v1["properties"][it.key()]) {
+                migrated[candidate.key()] = it.value();
+                break;
+            }
+        }
+    }
+    for (auto it = v2["properties"].begin(); it != v2["properties"].end(); ++it) {
+        if (!migrated.contains(it.key()) && it.value().contains("default")) {
+            migrated[it.key()] = it.value()["default"];
+        }
+    }
+    config = std::move(migrated);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t config_count = (argc > 1) ? std::stoul(argv[1]) : 10000;
+    const fs::path dir = fs::temp_directory_path() / "configgui_bench_migration";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    json v1;
+    json v2;
+    buildSchemas(v1, v2);
+    const JSONSchema from(v1);
+    const JSONSchema to(v2);
+
+    std::vector<std::string> paths;
+    paths.reserve(config_count);
+    for (std::size_t d = 0; d < config_count; ++d) {
+        paths.push_back((dir / ("config_" + std::to_string(d) + ".json")).string());
+    }
+
+    std::printf("Config migration benchmark (%zu configs, %zu fields)\n", config_count, kFields);
+
+    const auto diff_stats = bench::measure(200, [&](std::size_t) {
+        const SchemaDiff diff = SchemaDiff::compute(from, to);
+        (void)diff;
+    });
+    bench::report("SchemaDiff::compute", diff_stats);
+
+    auto plan = std::make_shared<const MigrationPlan>(from, to);
+    const SchemaDiff& diff = plan->diff();
+    std::printf("  diff: %zu renamed, %zu removed, %zu added, %zu retyped (%zu plan operations)\n",
+                diff.count(SchemaChangeKind::Renamed), diff.count(SchemaChangeKind::Removed),
+                diff.count(SchemaChangeKind::Added), diff.count(SchemaChangeKind::Retyped),
+                plan->operationCount());
+
+    // Reference: sequential load / hand-written fix / save per file
+    writeConfigs(paths);
+    const double naive_us = bench::time_once([&]() {
+        for (const auto& path : paths) {
+            std::ifstream in(path);
+            json config = json::parse(in);
+            in.close();
+            naiveMigrate(config, v1, v2);
+            std::ofstream(path) << config.dump(4);
+        }
+    });
+    std::printf("  naive load/fix/save loop     %10.0f configs/s\n",
+                1e6 * static_cast<double>(config_count) / naive_us);
+
+    auto validator = std::make_shared<const SchemaValidator>(v2);
+    const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    double single_rate = 0.0;
+    for (std::size_t workers = 1; workers <= hardware; workers *= 2) {
+        writeConfigs(paths);  // Fresh v1 files for every run
+        ConfigMigrator migrator(plan, nullptr, workers);
+        const auto stats = migrator.migrateFiles(paths, nullptr);
+        const double rate = stats.documentsPerSecond();
+        if (workers == 1) {
+            single_rate = rate;
+        }
+        std::printf("  ConfigMigrator %2zu thread(s)  %10.0f configs/s (%zu changed, %zu invalid, %zu failed, "
+                    "%.2fx vs 1 thread)\n",
+                    stats.workers, rate, stats.changed, stats.invalid, stats.failures, rate / single_rate);
+        if (workers * 2 > hardware && workers != hardware) {
+            workers = hardware / 2;  // Finish with exactly the hardware thread count
+        }
+    }
+
+    // Same pipeline with target-schema validation of every migrated config
+    writeConfigs(paths);
+    ConfigMigrator validating(plan, validator, hardware);
+    const auto validated = validating.migrateFiles(paths, nullptr);
+    std::printf("  + validation %2zu thread(s)    %10.0f configs/s (%zu invalid)\n",
+                validated.workers, validated.documentsPerSecond(), validated.invalid);
+
+    fs::remove_all(dir);
+    return 0;
+}
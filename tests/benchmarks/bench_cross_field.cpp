@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+// Cross-field constraints: unique ids across a 10k-item array with the hash
+// index vs. pairwise comparison, and re-running only triggered rules vs. all.
+
+#include "bench_common.h"
+#include "core/schema/constraint_engine.h"
+#include "core/schema/instance_index.h"
+#include <string>
+
+using namespace configgui::core;
+
+int main(int argc, char* argv[])
+{
+    const std::size_t item_count = (argc > 1) ? std::stoul(argv[1]) : 10000;
+
+    json document = {{"servers", json::array()}};
+    for (std::size_t i = 0; i < item_count; ++i) {
+        document["servers"].push_back({{"id", "server-" + std::to_string(i)}, {"port", 8000 + i % 1000}});
+    }
+    const json& servers = document["servers"];
+
+    std::printf("Cross-field constraint benchmark (%zu items)\n", item_count);
+
+    // Baseline: what a rule without an index does, comparing every pair of keys
+    auto pairwise = bench::measure(3, [&](std::size_t) {
+        std::size_t duplicates = 0;
+        for (std::size_t i = 0; i < servers.size(); ++i) {
+            for (std::size_t j = 0; j < i; ++j) {
+                if (instancesEqual(servers[i]["id"], servers[j]["id"])) {
+                    ++duplicates;
+                    break;
+                }
+            }
+        }
+        if (duplicates != 0) {
+            std::printf("unexpected duplicates\n");
+        }
+    });
+    bench::report("unique id, pairwise O(N^2)", pairwise);
+
+    ConstraintEngine engine;
+    engine.addUniqueKey("/servers", "/id");
+    auto indexed = bench::measure(20, [&](std::size_t) { (void)engine.evaluate(document); });
+    bench::report("unique id, hash index O(N)", indexed);
+    std::printf("  speedup: %.1fx\n", pairwise.median_us / indexed.median_us);
+
+    // 50 independent rules on other members: an edit to one of them re-runs only that rule
+    for (int r = 0; r < 50; ++r) {
+        const std::string pointer = "/option_" + std::to_string(r);
+        document["option_" + std::to_string(r)] = r;
+        engine.addRule({"option " + std::to_string(r), {pointer},
+                        [pointer](const json& doc, const ValidationErrorHandler& handler) {
+                            const auto value = doc.find(pointer.substr(1));
+                            if (value != doc.end() && !value->is_number()) {
+                                handler(ValidationError(pointer, ValidationErrorType::TypeMismatch, "Expected number", ""));
+                            }
+                        },
+                        false});
+    }
+    (void)engine.evaluate(document);
+
+    auto all_rules = bench::measure(50, [&](std::size_t) { (void)engine.evaluate(document); });
+    bench::report("edit /option_7, evaluate all rules", all_rules);
+
+    auto triggered = bench::measure(50, [&](std::size_t) { (void)engine.evaluateChanged(document, {"/option_7"}); });
+    bench::report("edit /option_7, evaluate triggered rules", triggered);
+    std::printf("  speedup: %.1fx\n", all_rules.median_us / triggered.median_us);
+    return 0;
+}
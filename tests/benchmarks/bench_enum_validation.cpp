@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: MIT
+// Large enums (10k country/SKU-style codes): the former linear EnumValidator
+// scan against the EnumIndex lookup, through an EnumValidator bound to the
+// schema and through a compiled ValidatorProgram. One check in ten misses, so
+// the failure path's message formatting is part of the cost. Exits non-zero
+// if the bound EnumValidator is not faster than the linear scan.
+
+#include "bench_common.h"
+#include "validators/enum_validator.h"
+#include "validators/validator_program.h"
+#include <string>
+#include <vector>
+
+using namespace configgui::validators;
+
+namespace {
+
+// What EnumValidator::validate did before the index
+std::size_t linearCheck(const json& value, const json& schema)
+{
+    const auto& enums = schema["enum"];
+    for (const auto& entry : enums) {
+        if (value == entry) {
+            return 0;
+        }
+    }
+    std::string allowed;
+    for (std::size_t i = 0; i < enums.size(); ++i) {
+        if (i > 0) {
+            allowed += ", ";
+        }
+        allowed += EnumIndex::formatValue(enums[i]);
+    }
+    return ("Value must be one of: " + allowed).size();
+}
+
+/// Returns whether the bound EnumValidator beat the linear scan
+bool run(const char* name, const json& schema, const std::vector<json>& values, std::size_t checks,
+         std::size_t& sink)
+{
+    constexpr std::size_t kIterations = 20;
+
+    const auto linear = bench::measure(kIterations, [&](std::size_t) {
+        for (std::size_t i = 0; i < checks; ++i) {
+            sink += linearCheck(values[i % values.size()], schema);
+        }
+    });
+
+    EnumValidator validator;
+    const double build_us = bench::time_once([&]() { validator = EnumValidator(schema); });
+    const auto indexed = bench::measure(kIterations, [&](std::size_t) {
+        for (std::size_t i = 0; i < checks; ++i) {
+            sink += validator.validate(values[i % values.size()], schema).errors.size();
+        }
+    });
+
+    const auto program = ValidatorProgram::compile(schema);
+    const auto compiled = bench::measure(kIterations, [&](std::size_t) {
+        for (std::size_t i = 0; i < checks; ++i) {
+            sink += program.run(values[i % values.size()]).errors.size();
+        }
+    });
+
+    std::printf("%s (index build %.1f us)\n", name, build_us);
+    bench::report("  linear scan (previous EnumValidator)", linear);
+    bench::report("  EnumValidator (bound EnumIndex)", indexed);
+    bench::report("  ValidatorProgram::run", compiled);
+    std::printf("  speedup: %.1fx (validator), %.1fx (program)\n",
+                linear.median_us / indexed.median_us, linear.median_us / compiled.median_us);
+    return indexed.median_us < linear.median_us;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t entries = (argc > 1) ? std::stoul(argv[1]) : 10000;
+    const std::size_t checks = (argc > 2) ? std::stoul(argv[2]) : 1000;
+
+    json strings = json::array();
+    json integers = json::array();
+    for (std::size_t i = 0; i < entries; ++i) {
+        strings.push_back("SKU-" + std::to_string(100000 + i));
+        integers.push_back(100000 + i);
+    }
+
+    // Hits spread over the whole array, every tenth value missing
+    std::vector<json> string_values;
+    std::vector<json> integer_values;
+    for (std::size_t i = 0; i < 100; ++i) {
+        const std::size_t at = (i * 7919) % entries;
+        const bool miss = (i % 10 == 9);
+        string_values.push_back(miss ? "SKU-unknown" : strings[at]);
+        integer_values.push_back(miss ? json(-1) : integers[at]);
+    }
+
+    std::printf("Enum validation benchmark (%zu entries, %zu checks per sample)\n", entries, checks);
+    std::size_t sink = 0;
+    bool faster = run("string enum", {{"enum", strings}}, string_values, checks, sink);
+    faster = run("integer enum", {{"enum", integers}}, integer_values, checks, sink) && faster;
+    std::printf("(%zu result units)\n", sink);
+    if (!faster) {
+        std::printf("FAIL: EnumValidator is not faster than the linear scan\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: MIT
+// Incremental revalidation: one edited field in a 10k-field configuration,
+// IncrementalValidator::revalidate against a full validateAll pass.
+
+#include "bench_common.h"
+#include "core/data/configuration_data.h"
+#include "core/schema/incremental_validator.h"
+#include "core/schema/schema_validator.h"
+#include <string>
+
+using namespace configgui::core;
+
+int main(int argc, char* argv[])
+{
+    const std::size_t field_count = (argc > 1) ? std::stoul(argv[1]) : 10000;
+
+    json schema = {{"type", "object"}, {"properties", json::object()}, {"required", json::array()}};
+    json data = json::object();
+    for (std::size_t i = 0; i < field_count; ++i) {
+        const std::string name = "field_" + std::to_string(i);
+        schema["properties"][name] = {{"type", "integer"}, {"minimum", 0}, {"maximum", 100}};
+        schema["required"].push_back(name);
+        data[name] = 50;
+    }
+
+    SchemaValidator validator(schema);
+    IncrementalValidator incremental(validator);
+    ConfigurationData config(data);
+    const std::string edited = "field_" + std::to_string(field_count / 2);
+
+    std::printf("Incremental validation benchmark (%zu fields, incremental: %s)\n",
+                field_count, incremental.supportsIncremental() ? "yes" : "no");
+
+    constexpr std::size_t kIterations = 100;
+
+    auto full = bench::measure(kIterations, [&](std::size_t i) {
+        config.set_value(edited, static_cast<int>(i % 200));
+        (void)incremental.validateAll(config);
+    });
+    bench::report("validateAll (full pass), 1 field edited", full);
+
+    auto partial = bench::measure(kIterations, [&](std::size_t i) {
+        config.set_value(edited, static_cast<int>(i % 200));
+        (void)incremental.revalidate(config, {edited});
+    });
+    bench::report("revalidate (dirty field only), 1 field edited", partial);
+
+    std::printf("  speedup: %.1fx\n", full.median_us / partial.median_us);
+    return 0;
+}
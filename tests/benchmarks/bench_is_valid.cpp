@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: MIT
+// Yes/no validation: SchemaValidator::validateAll() vs isValid() on a 2k-server
+// configuration (valid, and with every server invalid), with and without the
+// memo; then the IValidator chain and ValidatorProgram, validate()/run() vs
+// isValid() on values that fail.
+
+#include "bench_common.h"
+#include "core/schema/schema_validator.h"
+#include "validators/enum_validator.h"
+#include "validators/pattern_validator.h"
+#include "validators/range_validator.h"
+#include "validators/required_validator.h"
+#include "validators/type_validator.h"
+#include "validators/validator_program.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace core = configgui::core;
+namespace validators = configgui::validators;
+
+int main(int argc, char* argv[])
+{
+    const std::size_t server_count = (argc > 1) ? std::stoul(argv[1]) : 2000;
+
+    const json schema = {
+        {"type", "object"},
+        {"properties", {
+            {"servers", {
+                {"type", "array"},
+                {"items", {
+                    {"type", "object"},
+                    {"properties", {
+                        {"host", {{"type", "string"}, {"pattern", "^[a-z0-9-]+(\\.[a-z0-9-]+)*$"}}},
+                        {"port", {{"type", "integer"}, {"minimum", 1}, {"maximum", 65535}}},
+                        {"role", {{"enum", {"primary", "replica", "witness"}}}}
+                    }},
+                    {"required", {"host", "port"}},
+                    {"additionalProperties", false}
+                }}
+            }}
+        }}
+    };
+
+    json valid = {{"servers", json::array()}};
+    for (std::size_t i = 0; i < server_count; ++i) {
+        valid["servers"].push_back({{"host", "db-" + std::to_string(i) + ".internal.example"},
+                                    {"port", 5432},
+                                    {"role", i % 3 == 0 ? "primary" : "replica"}});
+    }
+    json invalid = valid;
+    for (auto& server : invalid["servers"]) {
+        server["port"] = 0;
+        server["role"] = "spare";
+    }
+
+    std::printf("Is-valid benchmark (%zu servers)\n", server_count);
+    constexpr std::size_t kIterations = 30;
+
+    core::SchemaValidator validator(schema);
+    auto full_valid = bench::measure(kIterations, [&](std::size_t) { (void)validator.validateAll(valid); });
+    bench::report("valid document, validateAll", full_valid);
+    auto check_valid = bench::measure(kIterations, [&](std::size_t) { (void)validator.isValid(valid); });
+    bench::report("valid document, isValid", check_valid);
+    std::printf("  speedup: %.1fx\n", full_valid.median_us / check_valid.median_us);
+
+    auto full_invalid = bench::measure(kIterations, [&](std::size_t) { (void)validator.validateAll(invalid); });
+    bench::report("every server invalid, validateAll", full_invalid);
+    auto check_invalid = bench::measure(kIterations, [&](std::size_t) { (void)validator.isValid(invalid); });
+    bench::report("every server invalid, isValid", check_invalid);
+    std::printf("  speedup: %.1fx\n", full_invalid.median_us / check_invalid.median_us);
+
+    // Save-button style: re-check after each edit, with the memo on
+    core::SchemaValidator memoized(schema);
+    memoized.setMemoization();
+    (void)memoized.validateAll(valid);
+    auto memo_full = bench::measure(kIterations, [&](std::size_t i) {
+        valid["servers"][server_count / 2]["port"] = 1000 + static_cast<int>(i);
+        (void)memoized.validateAll(valid);
+    });
+    bench::report("one server edited, memo + validateAll", memo_full);
+    auto memo_check = bench::measure(kIterations, [&](std::size_t i) {
+        valid["servers"][server_count / 2]["port"] = 2000 + static_cast<int>(i);
+        (void)memoized.isValid(valid);
+    });
+    bench::report("one server edited, memo + isValid", memo_check);
+    std::printf("  speedup: %.1fx\n", memo_full.median_us / memo_check.median_us);
+
+    // IValidator family on failing values, where validate() builds errors
+    const json field_schema = {{"type", json::array({"integer", "null"})}, {"minimum", 1}, {"enum", {1, 2, 3}}};
+    const json required_schema = {{"type", "object"}, {"required", {"a", "b", "c", "d"}}};
+    const json pattern_schema = {{"type", "string"}, {"pattern", "^[a-z]+$"}, {"minLength", 8}};
+    std::vector<std::pair<json, const json*>> cases;
+    for (std::size_t i = 0; i < 1000; ++i) {
+        cases.emplace_back(json("text"), &field_schema);
+        cases.emplace_back(json::object(), &required_schema);
+        cases.emplace_back(json("UPPER"), &pattern_schema);
+    }
+
+    std::vector<std::unique_ptr<validators::IValidator>> chain;
+    chain.push_back(std::make_unique<validators::TypeValidator>());
+    chain.push_back(std::make_unique<validators::RangeValidator>());
+    chain.push_back(std::make_unique<validators::EnumValidator>());
+    chain.push_back(std::make_unique<validators::PatternValidator>());
+    chain.push_back(std::make_unique<validators::RequiredValidator>());
+
+    std::size_t failed = 0;
+    auto chain_full = bench::measure(kIterations, [&](std::size_t) {
+        for (const auto& [value, node] : cases) {
+            bool ok = true;
+            for (const auto& v : chain) {
+                ok = v->validate(value, *node).is_valid && ok;
+            }
+            failed += ok ? 0u : 1u;
+        }
+    });
+    bench::report("IValidator chain, validate", chain_full);
+    auto chain_check = bench::measure(kIterations, [&](std::size_t) {
+        for (const auto& [value, node] : cases) {
+            bool ok = true;
+            for (const auto& v : chain) {
+                if (!v->isValid(value, *node)) {
+                    ok = false;
+                    break;
+                }
+            }
+            failed += ok ? 0u : 1u;
+        }
+    });
+    bench::report("IValidator chain, isValid", chain_check);
+    std::printf("  speedup: %.1fx\n", chain_full.median_us / chain_check.median_us);
+
+    const auto field_program = validators::ValidatorProgram::compile(field_schema);
+    const auto required_program = validators::ValidatorProgram::compile(required_schema);
+    const auto pattern_program = validators::ValidatorProgram::compile(pattern_schema);
+    auto programFor = [&](const json* node) -> const validators::ValidatorProgram& {
+        return node == &field_schema ? field_program : node == &required_schema ? required_program : pattern_program;
+    };
+    auto program_full = bench::measure(kIterations, [&](std::size_t) {
+        for (const auto& [value, node] : cases) {
+            failed += programFor(node).run(value).is_valid ? 0u : 1u;
+        }
+    });
+    bench::report("ValidatorProgram, run", program_full);
+    auto program_check = bench::measure(kIterations, [&](std::size_t) {
+        for (const auto& [value, node] : cases) {
+            failed += programFor(node).isValid(value) ? 0u : 1u;
+        }
+    });
+    bench::report("ValidatorProgram, isValid", program_check);
+    std::printf("  speedup: %.1fx\n", program_full.median_us / program_check.median_us);
+    std::printf("  (%zu failures)\n", failed);
+    return 0;
+}
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: MIT
+// Pattern matching engines: std::regex against the LinearRegex automaton on
+// typical schema patterns, then on "(a+)+$" with growing inputs of the form
+// "aaa...a!", where std::regex backtracks exponentially.
+
+#include "bench_common.h"
+#include "validators/regex_backend.h"
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace configgui::validators;
+
+namespace {
+
+struct Case {
+    const char* pattern;
+    std::vector<std::string> inputs;
+};
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t max_attack = (argc > 1) ? std::stoul(argv[1]) : 22;
+
+    const std::vector<Case> cases = {
+        {"^[a-z_][a-z0-9_]*$", {"server_name", "db_primary_01", "Bad-Name", "x"}},
+        {"^(\\d{1,3}\\.){3}\\d{1,3}$", {"192.168.0.1", "10.0.0.255", "256.1.1", "1.2.3.4.5"}},
+        {"[^@\\s]+@[^@\\s]+\\.[a-z]{2,}", {"user@example.com", "first.last@mail.example.org", "bad@", "x@y.z"}},
+        {"v?\\d+\\.\\d+\\.\\d+(-[0-9A-Za-z.]+)?", {"v1.2.3", "10.20.30-rc.1", "1.2", "2.0.0-beta"}},
+        {"\\d{4}-\\d{2}-\\d{2}T\\d{2}:\\d{2}:\\d{2}Z", {"2024-01-31T12:00:00Z", "2024-1-31", "1999-12-31T23:59:59Z"}}
+    };
+
+    std::printf("Regex backend benchmark\n");
+    constexpr std::size_t kIterations = 50;
+    constexpr std::size_t kChecks = 2000;
+    std::size_t sink = 0;
+
+    for (const auto& c : cases) {
+        const auto std_regex = CompiledRegex::compile(c.pattern, RegexBackend::Std);
+        const auto linear = CompiledRegex::compile(c.pattern, RegexBackend::Linear);
+
+        const auto with_std = bench::measure(kIterations, [&](std::size_t) {
+            for (std::size_t i = 0; i < kChecks; ++i) {
+                sink += std_regex->fullMatch(c.inputs[i % c.inputs.size()]) ? 1 : 0;
+            }
+        });
+        const auto with_linear = bench::measure(kIterations, [&](std::size_t) {
+            for (std::size_t i = 0; i < kChecks; ++i) {
+                sink += linear->fullMatch(c.inputs[i % c.inputs.size()]) ? 1 : 0;
+            }
+        });
+
+        const auto compile_std = bench::measure(20, [&](std::size_t) {
+            (void)CompiledRegex::compile(c.pattern, RegexBackend::Std);
+        });
+        const auto compile_linear = bench::measure(20, [&](std::size_t) {
+            (void)CompiledRegex::compile(c.pattern, RegexBackend::Linear);
+        });
+
+        std::printf("%s (%s engine; compile %.1f us std, %.1f us linear)\n", c.pattern, linear->engine(),
+                    compile_std.median_us, compile_linear.median_us);
+        bench::report("  std::regex", with_std);
+        bench::report("  LinearRegex", with_linear);
+        std::printf("  speedup: %.1fx\n", with_std.median_us / with_linear.median_us);
+    }
+
+    // Catastrophic backtracking: every extra 'a' doubles std::regex's work
+    const auto std_attack = CompiledRegex::compile("(a+)+$", RegexBackend::Std);
+    const auto linear_attack = CompiledRegex::compile("(a+)+$", RegexBackend::Linear);
+    std::printf("\n(a+)+$ on \"a...a!\"\n");
+    for (std::size_t n = 14; n <= max_attack; n += 2) {
+        const std::string input = std::string(n, 'a') + "!";
+        bool std_failed = false;
+        const double std_us = bench::time_once([&]() {
+            try {
+                sink += std_attack->fullMatch(input) ? 1 : 0;
+            } catch (const std::regex_error&) {
+                std_failed = true;  // error_complexity / error_stack
+            }
+        });
+        const double linear_us = bench::time_once([&]() { sink += linear_attack->fullMatch(input) ? 1 : 0; });
+        std::printf("  n=%-3zu std::regex %12.1f us%s   LinearRegex %8.2f us\n", n, std_us,
+                    std_failed ? " (gave up)" : "          ", linear_us);
+    }
+    const std::string long_input = std::string(100000, 'a') + "!";
+    const double long_us = bench::time_once([&]() { sink += linear_attack->fullMatch(long_input) ? 1 : 0; });
+    std::printf("  n=100000 LinearRegex %.1f us\n", long_us);
+
+    std::printf("(%zu matches)\n", sink);
+    return 0;
+}
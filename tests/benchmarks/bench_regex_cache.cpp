@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: MIT
+// Regex cache contention: the previous PatternValidator cache (one global
+// map behind a shared_mutex) against the sharded RegexCache, with several
+// threads looking up a shared set of hot patterns. Then a churn run with
+// ever-new patterns, as typed into the rule editor, to show the bound.
+
+#include "bench_common.h"
+#include "validators/regex_cache.h"
+#include <atomic>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace configgui::validators;
+
+namespace {
+
+// The cache PatternValidator used before (with its lookup counter made atomic)
+class GlobalMapCache {
+public:
+    std::shared_ptr<const CompiledRegex> get(const std::string& pattern)
+    {
+        lookups_.fetch_add(1, std::memory_order_relaxed);
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            const auto it = cache_.find(pattern);
+            if (it != cache_.end()) {
+                return it->second;
+            }
+        }
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        auto& slot = cache_[pattern];
+        if (!slot) {
+            slot = CompiledRegex::compile(pattern, RegexBackend::Linear);
+        }
+        return slot;
+    }
+
+    std::size_t size()
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return cache_.size();
+    }
+
+private:
+    std::shared_mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<const CompiledRegex>> cache_;
+    std::atomic<std::size_t> lookups_{0};
+};
+
+template <typename Lookup>
+double runThreads(std::size_t thread_count, std::size_t lookups, const std::vector<std::string>& patterns,
+                  Lookup&& lookup)
+{
+    return bench::time_once([&]() {
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&, t]() {
+                std::size_t sink = 0;
+                for (std::size_t i = 0; i < lookups; ++i) {
+                    sink += lookup(patterns[(i + t * 7) % patterns.size()]) ? 1 : 0;
+                }
+                (void)sink;
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    });
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t lookups = (argc > 1) ? std::stoul(argv[1]) : 200000;
+    const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<std::string> hot;
+    for (int i = 0; i < 32; ++i) {
+        hot.push_back("^field_" + std::to_string(i) + "_[a-z0-9]+$");
+    }
+
+    std::printf("Regex cache benchmark (%zu lookups per thread, %zu hardware threads)\n", lookups, hardware);
+    for (const std::size_t threads : {std::size_t{1}, std::size_t{2}, std::size_t{4}, std::size_t{8}}) {
+        GlobalMapCache global;
+        RegexCache sharded;
+        const double global_us = runThreads(threads, lookups, hot, [&](const std::string& p) { return global.get(p); });
+        const double sharded_us = runThreads(threads, lookups, hot, [&](const std::string& p) {
+            return sharded.get(p, RegexBackend::Linear);
+        });
+        const double total = static_cast<double>(threads * lookups);
+        const auto stats = sharded.stats();
+        std::printf("  %zu thread(s): global map %7.2f M lookups/s   RegexCache %7.2f M lookups/s   (%.1fx, hit rate %.4f)\n",
+                    threads, total / global_us, total / sharded_us, global_us / sharded_us, stats.hitRate());
+    }
+
+    // Churn: every lookup a new pattern
+    constexpr std::size_t kDistinct = 20000;
+    std::vector<std::string> churn;
+    for (std::size_t i = 0; i < kDistinct; ++i) {
+        churn.push_back("user_typed_" + std::to_string(i) + "[0-9]*");
+    }
+    GlobalMapCache global;
+    RegexCache bounded;
+    const double global_us = runThreads(1, kDistinct, churn, [&](const std::string& p) { return global.get(p); });
+    const double bounded_us = runThreads(1, kDistinct, churn, [&](const std::string& p) {
+        return bounded.get(p, RegexBackend::Linear);
+    });
+    const auto stats = bounded.stats();
+    std::printf("\nChurn (%zu distinct patterns)\n", kDistinct);
+    std::printf("  global map: %zu entries, %.1f ms\n", global.size(), global_us / 1000.0);
+    std::printf("  RegexCache: %zu entries (capacity %zu), %llu evictions, %.1f ms\n", stats.entries, stats.capacity,
+                static_cast<unsigned long long>(stats.evictions), bounded_us / 1000.0);
+    return 0;
+}
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: MIT
+// Shorthand rules: parsing a 1k-rule object with the previous substring/stringstream
+// parser, the single-pass tokenizer (cold cache) and the rule cache (warm).
+
+#include "bench_common.h"
+#include "core/schema/rule_parser.h"
+#include <sstream>
+#include <string>
+
+using namespace configgui::core;
+
+namespace
+{
+
+std::string trimmed(std::string text)
+{
+    text.erase(0, text.find_first_not_of(" \t"));
+    text.erase(text.find_last_not_of(" \t") + 1);
+    return text;
+}
+
+// Baseline: the parser this replaced (copies of every part, istringstream splits, stod)
+RuleDefinition legacyParse(const std::string& name, const std::string& shorthand)
+{
+    RuleDefinition rule;
+    rule.name = name;
+    const std::size_t end = std::min({shorthand.find('['), shorthand.find('{'), shorthand.find('?')});
+    rule.type = shorthand.substr(0, end);
+    rule.required = shorthand.find('?') == std::string::npos;
+
+    const std::size_t open = shorthand.find('[');
+    const std::size_t close = shorthand.find(']');
+    if ((rule.type == "integer" || rule.type == "float") && open != std::string::npos && close != std::string::npos) {
+        const std::string range = shorthand.substr(open + 1, close - open - 1);
+        const std::size_t comma = range.find(',');
+        if (comma != std::string::npos) {
+            const std::string low = trimmed(range.substr(0, comma));
+            const std::string high = trimmed(range.substr(comma + 1));
+            if (!low.empty() && low != "+") {
+                rule.minimum = std::stod(low);
+            }
+            if (!high.empty() && high != "+") {
+                rule.maximum = std::stod(high);
+            }
+        }
+    }
+
+    const std::size_t brace = shorthand.find('{');
+    const std::size_t brace_end = shorthand.find('}');
+    if (brace != std::string::npos && brace_end != std::string::npos) {
+        std::istringstream modifiers(shorthand.substr(brace + 1, brace_end - brace - 1));
+        std::string modifier;
+        while (std::getline(modifiers, modifier, ',')) {
+            modifier = trimmed(modifier);
+            if (modifier == "required" || modifier == "optional") {
+                rule.required = modifier == "required";
+            } else if (modifier.find("enum:") == 0) {
+                std::istringstream values(modifier.substr(5));
+                std::string value;
+                while (std::getline(values, value, '|')) {
+                    value = trimmed(value);
+                    if (!value.empty()) {
+                        rule.enum_values.push_back(value);
+                    }
+                }
+            } else if (modifier.find("pattern:") == 0) {
+                rule.pattern = modifier.substr(8);
+            }
+        }
+    }
+    rule.allow_empty = !rule.required;
+    return rule;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t rule_count = (argc > 1) ? std::stoul(argv[1]) : 1000;
+
+    static const char* const kShapes[] = {
+        "integer[0,%zu]?",
+        "float[-%zu.5,+]{required}",
+        "string{required,enum:fast|safe|balanced|off%zu}",
+        "string?{optional,pattern:^[a-z]{1,%zu}$}",
+    };
+    std::vector<std::string> names;
+    std::vector<std::string> shorthands;
+    for (std::size_t i = 0; i < rule_count; ++i) {
+        char buffer[96];
+        std::snprintf(buffer, sizeof(buffer), kShapes[i % 4], i / 4 + 1);
+        names.push_back("field_" + std::to_string(i));
+        shorthands.emplace_back(buffer);
+    }
+
+    std::printf("Rule parser benchmark (%zu shorthand rules)\n", rule_count);
+    constexpr std::size_t kIterations = 30;
+    std::size_t sink = 0;
+
+    auto legacy = bench::measure(kIterations, [&](std::size_t) {
+        for (std::size_t i = 0; i < rule_count; ++i) {
+            sink += legacyParse(names[i], shorthands[i]).enum_values.size();
+        }
+    });
+    bench::report("previous parser", legacy);
+
+    // Trailing spaces make each iteration's shorthands distinct, so every lookup misses
+    std::vector<std::vector<std::string>> unseen(kIterations);
+    for (std::size_t iteration = 0; iteration < kIterations; ++iteration) {
+        for (const auto& shorthand : shorthands) {
+            unseen[iteration].push_back(shorthand + std::string(iteration + 1, ' '));
+        }
+    }
+    auto cold = bench::measure(kIterations, [&](std::size_t iteration) {
+        for (std::size_t i = 0; i < rule_count; ++i) {
+            sink += RuleParser::parseShorthand(names[i], unseen[iteration][i]).enum_values.size();
+        }
+    });
+    bench::report("tokenizer, cold cache", cold);
+
+    auto warm = bench::measure(kIterations, [&](std::size_t) {
+        for (std::size_t i = 0; i < rule_count; ++i) {
+            sink += RuleParser::parseShorthand(names[i], shorthands[i]).enum_values.size();
+        }
+    });
+    bench::report("tokenizer, warm cache", warm);
+    std::printf("  speedup vs previous: cold %.1fx, warm %.1fx\n", legacy.median_us / cold.median_us,
+                legacy.median_us / warm.median_us);
+    std::printf("  (checksum %zu)\n", sink);
+    return 0;
+}
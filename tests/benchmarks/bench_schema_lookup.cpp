@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: MIT
+// Deep sub-schema lookup: JSONSchema's recursive path index against walking
+// "properties" level by level (each ordered_json lookup is a linear scan).
+// The generated schema has config.schema.json's shape: nested objects with
+// an array of objects at every level, several hundred sub-schemas in total.
+
+#include "bench_common.h"
+#include "core/schema/schema.h"
+#include <string>
+#include <vector>
+
+using namespace configgui::core;
+
+namespace {
+
+json makeLevel(std::size_t fanout, std::size_t depth)
+{
+    json node = {{"type", "object"}, {"properties", json::object()}};
+    for (std::size_t i = 0; i < fanout; ++i) {
+        const std::string name = "Section_" + std::to_string(i);
+        node["properties"][name] = (depth > 1) ? makeLevel(fanout, depth - 1)
+                                               : json{{"type", "integer"}, {"minimum", 0}};
+    }
+    node["properties"]["Items"] = {{"type", "array"},
+                                   {"items", {{"type", "object"},
+                                              {"properties", {{"Name", {{"type", "string"}}}}}}}};
+    return node;
+}
+
+// What callers did before the index: one scan of "properties" per component
+const json* walk(const json& root, const std::vector<std::string>& parts)
+{
+    const json* current = &root;
+    for (const auto& part : parts) {
+        const auto properties = current->find("properties");
+        if (properties == current->end()) {
+            return nullptr;
+        }
+        const auto child = properties->find(part);
+        if (child == properties->end()) {
+            return nullptr;
+        }
+        current = &*child;
+    }
+    return current;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t fanout = (argc > 1) ? std::stoul(argv[1]) : 5;
+    const std::size_t depth = (argc > 2) ? std::stoul(argv[2]) : 4;
+
+    const json schema_json = makeLevel(fanout, depth);
+    JSONSchema schema;
+    const double build_us = bench::time_once([&]() { schema = JSONSchema(schema_json); });
+
+    // Deepest, last-declared path: the worst case for a linear scan
+    std::string dotted;
+    std::string pointer;
+    std::vector<std::string> parts;
+    for (std::size_t level = 0; level < depth; ++level) {
+        const std::string name = "Section_" + std::to_string(fanout - 1);
+        dotted += (dotted.empty() ? "" : ".") + name;
+        pointer += "/" + name;
+        parts.push_back(name);
+    }
+
+    std::printf("Schema lookup benchmark (fanout %zu, depth %zu, %zu bytes, %zu indexed paths)\n",
+                fanout, depth, schema_json.dump().size(), schema.indexedPathCount());
+    std::printf("  index build: %.1f us (once per schema)\n", build_us);
+
+    constexpr std::size_t kIterations = 20000;
+
+    auto walked = bench::measure(kIterations, [&](std::size_t) { (void)walk(schema_json, parts); });
+    bench::report("properties walk, deepest path", walked);
+
+    auto by_dotted = bench::measure(kIterations, [&](std::size_t) { (void)schema.findSchema(dotted); });
+    bench::report("findSchema (dotted path)", by_dotted);
+
+    auto by_pointer = bench::measure(kIterations, [&](std::size_t) { (void)schema.findSchema(pointer); });
+    bench::report("findSchema (JSON Pointer)", by_pointer);
+
+    const std::string item_path = dotted.substr(0, dotted.rfind('.')) + ".Items.7.Name";
+    auto by_index = bench::measure(kIterations, [&](std::size_t) { (void)schema.findSchema(item_path); });
+    bench::report("findSchema (through array index)", by_index);
+
+    std::printf("  speedup (dotted vs walk): %.1fx\n", walked.median_us / by_dotted.median_us);
+    return 0;
+}
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: MIT
+// Schema startup: first load of a large schema in a fresh process, compiled
+// from source (parse, $ref resolution, json_validator compile) versus loaded
+// from its precompiled "<schema>.compiled" artifact. Each sample uses a new
+// CompiledSchemaCache, which is what a new process sees. Pass a property
+// count as the first argument.
+
+#include "bench_common.h"
+#include "core/schema/compiled_schema_cache.h"
+#include "core/schema/schema_artifact.h"
+#include "core/schema/schema_validator.h"
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace configgui::core;
+namespace fs = std::filesystem;
+
+namespace {
+
+// Shared definitions referenced from every fourth property (with_refs), or the
+// same constraints written inline, as in large product schemas
+json makeSchema(std::size_t property_count, bool with_refs)
+{
+    const json endpoint = {
+        {"type", "object"},
+        {"properties", {
+            {"host", {{"type", "string"}, {"pattern", "^[a-z0-9.-]+$"}}},
+            {"port", {{"type", "integer"}, {"minimum", 1}, {"maximum", 65535}}}
+        }},
+        {"required", {"host", "port"}}
+    };
+    json schema = {{"type", "object"}, {"properties", json::object()}};
+    if (with_refs) {
+        schema["definitions"] = {{"endpoint", endpoint}};
+    }
+    for (std::size_t i = 0; i < property_count; ++i) {
+        const std::string name = "section_" + std::to_string(i);
+        if (i % 4 != 0) {
+            schema["properties"][name] = {{"type", "string"}, {"maxLength", 128}, {"default", "value"}};
+        } else if (with_refs) {
+            schema["properties"][name] = {{"$ref", "#/definitions/endpoint"}};
+        } else {
+            schema["properties"][name] = endpoint;
+        }
+    }
+    return schema;
+}
+
+void run(const fs::path& dir, std::size_t property_count, bool with_refs)
+{
+    const std::string path = (dir / (with_refs ? "refs.schema.json" : "inline.schema.json")).string();
+    std::ofstream(path) << makeSchema(property_count, with_refs).dump(2);
+    std::printf("%s schema:\n", with_refs ? "$ref-heavy" : "Inline");
+
+    const auto from_source = bench::measure(20, [&](std::size_t) {
+        CompiledSchemaCache cache;
+        cache.setArtifactsEnabled(false);
+        (void)cache.get(path);
+    });
+    bench::report("  compile from source", from_source);
+
+    {
+        CompiledSchemaCache writer;  // Writes the artifact on first compile
+        (void)writer.get(path);
+    }
+    std::error_code ec;
+    std::printf("  artifact size: %ju bytes (schema: %ju bytes)\n",
+                static_cast<std::uintmax_t>(fs::file_size(SchemaArtifact::pathFor(path), ec)),
+                static_cast<std::uintmax_t>(fs::file_size(path, ec)));
+
+    std::size_t artifact_loads = 0;
+    const auto from_artifact = bench::measure(20, [&](std::size_t) {
+        CompiledSchemaCache cache;
+        (void)cache.get(path);
+        artifact_loads += cache.stats().artifact_loads;
+    });
+    bench::report("  load precompiled artifact", from_artifact);
+    std::printf("  artifact loads: %zu/20, speedup (median): %.2fx\n", artifact_loads,
+                from_source.median_us / from_artifact.median_us);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t property_count = (argc > 1) ? std::stoul(argv[1]) : 2000;
+    const fs::path dir = fs::temp_directory_path() / "configgui_bench_startup";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    std::printf("Schema startup benchmark (%zu properties)\n", property_count);
+    run(dir, property_count, false);
+    run(dir, property_count, true);
+
+    fs::remove_all(dir);
+    return 0;
+}
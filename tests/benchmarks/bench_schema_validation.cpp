@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+// Error reporting cost: SchemaValidator::validate (throwing json_validator,
+// one error per call) against validateAll (compiled plan, every error in one
+// pass). Reporting N errors through validate() takes N validate/fix cycles;
+// the benchmark replays those cycles by fixing one field per call. It also
+// times per-keystroke validateField, which should not grow with schema size.
+
+#include "bench_common.h"
+#include "core/schema/schema_validator.h"
+#include <string>
+
+using namespace configgui::core;
+
+int main(int argc, char* argv[])
+{
+    const std::size_t field_count = (argc > 1) ? std::stoul(argv[1]) : 200;
+
+    json schema = {{"type", "object"}, {"properties", json::object()}};
+    json invalid = json::object();
+    json valid = json::object();
+    for (std::size_t i = 0; i < field_count; ++i) {
+        const std::string name = "field_" + std::to_string(i);
+        schema["properties"][name] = {{"type", "integer"}, {"minimum", 0}, {"maximum", 100}};
+        invalid[name] = 1000;
+        valid[name] = 50;
+    }
+
+    SchemaValidator validator(schema);
+    std::printf("Schema validation benchmark (%zu fields, compiled plan: %s)\n",
+                field_count, validator.usesCompiledPlan() ? "yes" : "no");
+
+    constexpr std::size_t kIterations = 50;
+
+    auto throwing_valid = bench::measure(kIterations, [&](std::size_t) { (void)validator.validate(valid); });
+    bench::report("validate (throwing), valid config", throwing_valid);
+
+    auto plan_valid = bench::measure(kIterations, [&](std::size_t) { (void)validator.validateAll(valid); });
+    bench::report("validateAll (plan), valid config", plan_valid);
+
+    std::size_t plan_errors = 0;
+    auto plan_invalid = bench::measure(kIterations, [&](std::size_t) {
+        plan_errors = validator.validateAll(invalid).size();
+    });
+    bench::report("validateAll (plan), all fields invalid", plan_invalid);
+
+    // One validate/fix cycle per error until the config is clean
+    std::size_t cycles = 0;
+    const double cycles_us = bench::time_once([&]() {
+        json working = invalid;
+        for (std::size_t i = 0; i <= field_count; ++i) {
+            ++cycles;
+            if (validator.validate(working).empty()) {
+                break;
+            }
+            working["field_" + std::to_string(i)] = 50;
+        }
+    });
+
+    const std::string last_field = "field_" + std::to_string(field_count - 1);
+    auto field_check = bench::measure(kIterations * 20, [&](std::size_t i) {
+        (void)validator.validateField(last_field, static_cast<int>(i % 200));
+    });
+    bench::report("validateField (sub-schema), one keystroke", field_check);
+
+    std::printf("  validateAll found %zu errors in %.1f us (median)\n", plan_errors, plan_invalid.median_us);
+    std::printf("  validate needed %zu cycles totalling %.1f us to surface the same errors\n", cycles, cycles_us);
+    std::printf("  speedup: %.1fx\n", cycles_us / plan_invalid.median_us);
+    return 0;
+}
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: MIT
+// Validation memo: repeated validateAll of a 2k-server configuration with and
+// without memoization, for an unchanged document and after a one-field edit.
+
+#include "bench_common.h"
+#include "core/schema/schema_validator.h"
+#include <string>
+
+using namespace configgui::core;
+
+int main(int argc, char* argv[])
+{
+    const std::size_t server_count = (argc > 1) ? std::stoul(argv[1]) : 2000;
+
+    const json schema = {
+        {"type", "object"},
+        {"properties", {
+            {"servers", {
+                {"type", "array"},
+                {"items", {
+                    {"type", "object"},
+                    {"properties", {
+                        {"host", {{"type", "string"}, {"pattern", "^[a-z0-9-]+(\\.[a-z0-9-]+)*$"}}},
+                        {"port", {{"type", "integer"}, {"minimum", 1}, {"maximum", 65535}}},
+                        {"role", {{"enum", {"primary", "replica", "witness"}}}},
+                        {"tags", {{"type", "array"}, {"items", {{"type", "string"}, {"pattern", "^[a-z]+$"}}}}}
+                    }},
+                    {"required", {"host", "port"}},
+                    {"additionalProperties", false}
+                }}
+            }}
+        }}
+    };
+
+    json document = {{"servers", json::array()}};
+    for (std::size_t i = 0; i < server_count; ++i) {
+        document["servers"].push_back({{"host", "db-" + std::to_string(i) + ".internal.example"},
+                                       {"port", 5432},
+                                       {"role", i % 3 == 0 ? "primary" : "replica"},
+                                       {"tags", {"sql", "eu", "prod"}}});
+    }
+
+    SchemaValidator plain(schema);
+    SchemaValidator memoized(schema);
+    memoized.setMemoization();
+
+    std::printf("Validation memo benchmark (%zu servers)\n", server_count);
+    constexpr std::size_t kIterations = 30;
+
+    auto unchanged_plain = bench::measure(kIterations, [&](std::size_t) { (void)plain.validateAll(document); });
+    bench::report("unchanged document, no memo", unchanged_plain);
+    auto unchanged_memo = bench::measure(kIterations, [&](std::size_t) { (void)memoized.validateAll(document); });
+    bench::report("unchanged document, memo", unchanged_memo);
+    std::printf("  speedup: %.1fx\n", unchanged_plain.median_us / unchanged_memo.median_us);
+
+    auto edited_plain = bench::measure(kIterations, [&](std::size_t i) {
+        document["servers"][server_count / 2]["port"] = 1000 + static_cast<int>(i);
+        (void)plain.validateAll(document);
+    });
+    bench::report("one server edited, no memo", edited_plain);
+    auto edited_memo = bench::measure(kIterations, [&](std::size_t i) {
+        document["servers"][server_count / 2]["port"] = 2000 + static_cast<int>(i);
+        (void)memoized.validateAll(document);
+    });
+    bench::report("one server edited, memo", edited_memo);
+    std::printf("  speedup: %.1fx\n", edited_plain.median_us / edited_memo.median_us);
+
+    const auto stats = memoized.memoStats();
+    std::printf("  memo: %zu entries, %zu KiB, hit rate %.1f%%\n", stats.entries, stats.bytes / 1024,
+                100.0 * stats.hitRate());
+    return 0;
+}
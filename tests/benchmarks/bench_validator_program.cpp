@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: MIT
+// Validator chain: the five IValidators interpreting the schema JSON on every
+// call against one ValidatorProgram compiled per schema node. Mostly valid
+// values, as in a form being filled in, with a few violations mixed in.
+
+#include "bench_common.h"
+#include "validators/enum_validator.h"
+#include "validators/pattern_validator.h"
+#include "validators/range_validator.h"
+#include "validators/required_validator.h"
+#include "validators/type_validator.h"
+#include "validators/validator_program.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace configgui::validators;
+
+namespace {
+
+struct Field {
+    const char* name;
+    json schema;
+    std::vector<json> values;
+};
+
+std::vector<Field> makeFields()
+{
+    json environments = json::array();
+    for (const char* name : {"dev", "test", "qa", "staging", "preprod", "prod", "dr", "sandbox"}) {
+        environments.push_back(name);
+    }
+    return {
+        {"integer range", {{"type", "integer"}, {"minimum", 1}, {"maximum", 65535}}, {8080, 443, 70000, 22}},
+        {"string length + pattern",
+         {{"type", "string"}, {"minLength", 3}, {"maxLength", 32}, {"pattern", "^[a-z][a-z0-9_]*$"}},
+         {"server_name", "db_primary", "Bad-Name", "cache01"}},
+        {"string enum (8)", {{"type", "string"}, {"enum", environments}}, {"prod", "staging", "dev", "unknown"}},
+        {"object required (5)",
+         {{"type", "object"}, {"required", json::array({"host", "port", "user", "timeout", "retries"})}},
+         {{{"host", "h"}, {"port", 1}, {"user", "u"}, {"timeout", 5}, {"retries", 3}},
+          {{"host", "h"}, {"port", 1}, {"user", "u"}, {"timeout", 5}, {"retries", 3}},
+          {{"host", "h"}, {"port", 1}}}}
+    };
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const std::size_t checks = (argc > 1) ? std::stoul(argv[1]) : 10000;
+
+    std::vector<std::unique_ptr<IValidator>> chain;
+    chain.push_back(std::make_unique<TypeValidator>());
+    chain.push_back(std::make_unique<RangeValidator>());
+    chain.push_back(std::make_unique<EnumValidator>());
+    chain.push_back(std::make_unique<PatternValidator>());
+    chain.push_back(std::make_unique<RequiredValidator>());
+
+    std::printf("Validator program benchmark (%zu checks per sample)\n", checks);
+
+    constexpr std::size_t kIterations = 50;
+    std::size_t sink = 0;
+
+    for (const auto& field : makeFields()) {
+        const auto interpreted = bench::measure(kIterations, [&](std::size_t) {
+            for (std::size_t i = 0; i < checks; ++i) {
+                const json& value = field.values[i % field.values.size()];
+                for (const auto& validator : chain) {
+                    sink += validator->validate(value, field.schema).errors.size();
+                }
+            }
+        });
+
+        ValidatorProgram program;
+        const double compile_us = bench::time_once([&]() { program = ValidatorProgram::compile(field.schema); });
+        const auto compiled = bench::measure(kIterations, [&](std::size_t) {
+            for (std::size_t i = 0; i < checks; ++i) {
+                sink += program.run(field.values[i % field.values.size()]).errors.size();
+            }
+        });
+
+        std::printf("%s (compile %.1f us)\n", field.name, compile_us);
+        bench::report("  IValidator chain (interpreted)", interpreted);
+        bench::report("  ValidatorProgram::run", compiled);
+        std::printf("  speedup: %.1fx\n", interpreted.median_us / compiled.median_us);
+    }
+
+    std::printf("(%zu errors reported)\n", sink);
+    return 0;
+}
@@ -251,7 +251,7 @@ inline void ASSERT_VALID_RESULT(const auto& result)
                                  << result.errors.size();
     for (const auto& error : result.errors)
     {
-        ADD_FAILURE() << error.field << ": " << error.message;
+        ADD_FAILURE() << error.field << ": " << error.message();
     }
 }
 
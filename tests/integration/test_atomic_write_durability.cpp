@@ -0,0 +1,261 @@
+#include <gtest/gtest.h>
+#include "core/io/configuration_writer.h"
+#include "core/io/configuration_reader.h"
+#include "core/io/content_hash.h"
+#include "core/models/serialization_result.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <thread>
+
+#if defined(__linux__)
+#include <csignal>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace configgui::core;
+using namespace configgui::core::models;
+using namespace configgui::core::io;
+namespace fs = std::filesystem;
+
+class AtomicWriteDurabilityTest : public ::testing::Test {
+protected:
+    std::string temp_dir;
+    ConfigurationWriter writer;
+
+    void SetUp() override {
+        temp_dir = "/tmp/configgui_atomic_test_" + std::to_string(std::rand());
+        fs::create_directories(temp_dir);
+    }
+
+    void TearDown() override {
+        if (fs::exists(temp_dir)) {
+            fs::remove_all(temp_dir);
+        }
+    }
+
+    std::string get_temp_file(const std::string& name) {
+        return temp_dir + "/" + name;
+    }
+
+    static std::string read_all(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return buffer.str();
+    }
+
+    std::size_t count_directory_entries() const {
+        std::size_t count = 0;
+        for (const auto& entry : fs::directory_iterator(temp_dir)) {
+            (void)entry;
+            ++count;
+        }
+        return count;
+    }
+};
+
+TEST_F(AtomicWriteDurabilityTest, WritesExactContent) {
+    std::string output_file = get_temp_file("config.json");
+    std::string content = "{\n  \"name\": \"durable\"\n}\n";
+
+    auto result = writer.write_file_content(output_file, content);
+    ASSERT_TRUE(result) << result.error_msg_or_default();
+    EXPECT_EQ(read_all(output_file), content);
+}
+
+TEST_F(AtomicWriteDurabilityTest, ReplacesExistingFileWithoutLeftovers) {
+    std::string output_file = get_temp_file("config.ini");
+
+    ASSERT_TRUE(writer.write_file_content(output_file, "[a]\nx=1\n"));
+    ASSERT_TRUE(writer.write_file_content(output_file, "[a]\nx=2\n"));
+
+    EXPECT_EQ(read_all(output_file), "[a]\nx=2\n");
+    // Only the target remains: no temp files linger after a successful save
+    EXPECT_EQ(count_directory_entries(), 1u);
+}
+
+TEST_F(AtomicWriteDurabilityTest, WritesEmptyContent) {
+    std::string output_file = get_temp_file("empty.json");
+
+    ASSERT_TRUE(writer.write_file_content(output_file, ""));
+    EXPECT_TRUE(fs::exists(output_file));
+    EXPECT_EQ(fs::file_size(output_file), 0u);
+}
+
+TEST_F(AtomicWriteDurabilityTest, MissingDirectoryReportsIoError) {
+    std::string output_file = temp_dir + "/does/not/exist/config.json";
+
+    auto result = writer.write_file_content(output_file, "{}");
+    EXPECT_FALSE(result);
+    EXPECT_EQ(result.error_code(), SerializationError::FILE_IO_ERROR);
+    EXPECT_FALSE(fs::exists(output_file));
+}
+
+TEST_F(AtomicWriteDurabilityTest, IdenticalContentIsNotRewritten) {
+    std::string output_file = get_temp_file("same.json");
+    ASSERT_TRUE(writer.write_file_content(output_file, "{\"a\": 1}"));
+    const auto first_mtime = fs::last_write_time(output_file);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    auto result = writer.write_file_content(output_file, "{\"a\": 1}");
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result.is_unchanged());
+    EXPECT_EQ(fs::last_write_time(output_file), first_mtime);
+}
+
+TEST_F(AtomicWriteDurabilityTest, ChangedContentIsRewritten) {
+    std::string output_file = get_temp_file("changed.json");
+    ASSERT_TRUE(writer.write_file_content(output_file, "{\"a\": 1}"));
+
+    auto result = writer.write_file_content(output_file, "{\"a\": 2}");
+    ASSERT_TRUE(result);
+    EXPECT_FALSE(result.is_unchanged());
+    EXPECT_EQ(read_all(output_file), "{\"a\": 2}");
+}
+
+TEST_F(AtomicWriteDurabilityTest, ExternalEditInvalidatesCachedHash) {
+    std::string output_file = get_temp_file("external.json");
+    ASSERT_TRUE(writer.write_file_content(output_file, "{\"a\": 1}"));
+
+    // Same size, different bytes, written behind the writer's back
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    {
+        std::ofstream out(output_file, std::ios::binary | std::ios::trunc);
+        out << "{\"a\": 9}";
+    }
+
+    auto result = writer.write_file_content(output_file, "{\"a\": 1}");
+    ASSERT_TRUE(result);
+    EXPECT_FALSE(result.is_unchanged());
+    EXPECT_EQ(read_all(output_file), "{\"a\": 1}");
+}
+
+TEST_F(AtomicWriteDurabilityTest, SameTickRewriteIsNotTrustedToCache) {
+    std::string output_file = get_temp_file("racy.json");
+    ASSERT_TRUE(writer.write_file_content(output_file, "{\"a\": 1}"));
+    const auto saved_mtime = fs::last_write_time(output_file);
+
+    // Same size, different bytes, and (as on a coarse-mtime filesystem) the same mtime
+    {
+        std::ofstream out(output_file, std::ios::binary | std::ios::trunc);
+        out << "{\"a\": 9}";
+    }
+    fs::last_write_time(output_file, saved_mtime);
+
+    EXPECT_FALSE(writer.is_content_unchanged(output_file, "{\"a\": 1}"));
+    auto result = writer.write_file_content(output_file, "{\"a\": 1}");
+    ASSERT_TRUE(result);
+    EXPECT_FALSE(result.is_unchanged());
+    EXPECT_EQ(read_all(output_file), "{\"a\": 1}");
+}
+
+TEST_F(AtomicWriteDurabilityTest, VerifiedEntryIsTrustedOutsideTheRacyWindow) {
+    std::string output_file = get_temp_file("verified.json");
+    ASSERT_TRUE(writer.write_file_content(output_file, "{\"a\": 1}"));
+
+    // Read back well after the file's mtime tick: the entry is trusted from now on
+    const auto old_mtime = fs::last_write_time(output_file) - std::chrono::seconds(10);
+    fs::last_write_time(output_file, old_mtime);
+    EXPECT_TRUE(writer.is_content_unchanged(output_file, "{\"a\": 1}"));
+
+    // A same-size, same-mtime edit now goes unnoticed, as with git's index: the
+    // cached hash answers without reading the file
+    {
+        std::ofstream out(output_file, std::ios::binary | std::ios::trunc);
+        out << "{\"a\": 9}";
+    }
+    fs::last_write_time(output_file, old_mtime);
+    EXPECT_TRUE(writer.is_content_unchanged(output_file, "{\"a\": 1}"));
+    EXPECT_FALSE(writer.is_content_unchanged(output_file, "{\"a\": 2}"));
+}
+
+TEST_F(AtomicWriteDurabilityTest, UnchangedDetectedWithoutPriorSave) {
+    std::string output_file = get_temp_file("preexisting.json");
+    {
+        std::ofstream out(output_file, std::ios::binary);
+        out << "[section]\nkey=value\n";
+    }
+
+    ConfigurationWriter fresh_writer;
+    auto result = fresh_writer.write_file_content(output_file, "[section]\nkey=value\n");
+    ASSERT_TRUE(result);
+    EXPECT_TRUE(result.is_unchanged());
+}
+
+TEST_F(AtomicWriteDurabilityTest, SkipUnchangedCanBeDisabled) {
+    std::string output_file = get_temp_file("forced.json");
+    writer.set_skip_unchanged(false);
+
+    ASSERT_TRUE(writer.write_file_content(output_file, "{}"));
+    auto result = writer.write_file_content(output_file, "{}");
+    ASSERT_TRUE(result);
+    EXPECT_FALSE(result.is_unchanged());
+}
+
+TEST(ContentHashTest, MatchesReferenceXxh64Vectors) {
+    EXPECT_EQ(content_hash(std::string_view("")), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(content_hash(std::string_view("a")), 0xD24EC4F1A98C6E5BULL);
+    EXPECT_EQ(content_hash(std::string_view("abc")), 0x44BC2CF5AD770999ULL);
+    EXPECT_EQ(content_hash(std::string_view("Nobody inspects the spammish repetition")),
+              0xFBCEA83C8A378BF1ULL);
+}
+
+#if defined(__linux__)
+
+TEST_F(AtomicWriteDurabilityTest, CreatesFileWithOwnerWritableMode) {
+    std::string output_file = get_temp_file("mode.json");
+    const mode_t old_mask = ::umask(022);
+
+    ASSERT_TRUE(writer.write_file_content(output_file, "{}"));
+    ::umask(old_mask);
+
+    struct stat st {};
+    ASSERT_EQ(::stat(output_file.c_str(), &st), 0);
+    EXPECT_EQ(st.st_mode & 0777, 0644u);
+}
+
+// Crash-consistency harness: a child process saves alternating versions of
+// the same file in a tight loop and is SIGKILLed at a random point. Whatever
+// the interruption point, the target must hold one complete version — never
+// a zero-length or torn file. (Power loss is not simulated; SIGKILL exercises
+// the ordering of write/link/rename as seen by other processes.)
+TEST_F(AtomicWriteDurabilityTest, TargetIsNeverTornWhenWriterIsKilled) {
+    std::string output_file = get_temp_file("crash.json");
+    const std::string version_a(64 * 1024, 'a');
+    const std::string version_b(96 * 1024, 'b');
+
+    ASSERT_TRUE(writer.write_file_content(output_file, version_a));
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> delay_us(0, 5000);
+
+    constexpr int kIterations = 25;
+    for (int i = 0; i < kIterations; ++i) {
+        const pid_t child = ::fork();
+        ASSERT_GE(child, 0);
+
+        if (child == 0) {
+            ConfigurationWriter child_writer;
+            for (unsigned long n = 0;; ++n) {
+                (void)child_writer.write_file_content(output_file, (n % 2 == 0) ? version_b : version_a);
+            }
+        }
+
+        std::this_thread::sleep_for(std::chrono::microseconds(delay_us(gen)));
+        ::kill(child, SIGKILL);
+        int status = 0;
+        ::waitpid(child, &status, 0);
+
+        const std::string on_disk = read_all(output_file);
+        ASSERT_TRUE(on_disk == version_a || on_disk == version_b)
+            << "Iteration " << i << ": torn file of " << on_disk.size() << " bytes";
+    }
+}
+
+#endif // __linux__
@@ -9,8 +9,13 @@
 #include "core/models/serialization_result.h"
 #include <filesystem>
 #include <fstream>
+#include <algorithm>
 #include <cstdlib>
 
+#if defined(__linux__)
+#include <sys/stat.h>
+#endif
+
 using json = nlohmann::json;
 using namespace configgui::core;
 using namespace configgui::core::models;
@@ -188,3 +193,135 @@ TEST_F(JsonSaveWorkflowTest, NestedStructurePreservation) {
     json reloaded = deserialize_result.value();
     EXPECT_EQ(nested.dump(), reloaded.dump());
 }
+
+TEST_F(JsonSaveWorkflowTest, BatchSaveWritesAllFiles) {
+    auto factory_result = SerializerFactory::create_serializer(FormatType::JSON);
+    ASSERT_TRUE(factory_result);
+    std::shared_ptr<FormatSerializer> serializer(std::move(factory_result.value()));
+
+    // More items than the writer keeps temp descriptors open for, so both the
+    // deferred and the immediate fdatasync paths run
+    std::vector<BatchWriteItem> items;
+    for (int i = 0; i < 300; ++i) {
+        items.push_back({get_temp_file("batch_" + std::to_string(i) + ".json"),
+                         json{{"id", i}, {"name", "config"}},
+                         serializer});
+    }
+
+    auto results = writer.write_configuration_batch(items, 4);
+    ASSERT_EQ(results.size(), items.size());
+
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        EXPECT_EQ(results[i].file_path, items[i].file_path);
+        ASSERT_TRUE(results[i].result) << results[i].result.error_msg_or_default();
+
+        auto read_result = reader.read_configuration_file(items[i].file_path, serializer);
+        ASSERT_TRUE(read_result);
+        EXPECT_EQ(read_result.value()["id"], static_cast<int>(i));
+    }
+
+    // Only the targets remain: every temp file was renamed into place
+    std::size_t file_count = 0;
+    for (const auto& entry : fs::directory_iterator(temp_dir)) {
+        (void)entry;
+        ++file_count;
+    }
+    EXPECT_EQ(file_count, items.size());
+}
+
+TEST_F(JsonSaveWorkflowTest, BatchSaveReportsPerFileErrors) {
+    auto factory_result = SerializerFactory::create_serializer(FormatType::JSON);
+    ASSERT_TRUE(factory_result);
+    std::shared_ptr<FormatSerializer> serializer(std::move(factory_result.value()));
+
+    std::vector<BatchWriteItem> items = {
+        {get_temp_file("good.json"), create_test_config(), serializer},
+        {get_temp_file("missing_dir/bad.json"), create_test_config(), serializer},
+        {get_temp_file("no_serializer.json"), create_test_config(), nullptr},
+    };
+
+    auto results = writer.write_configuration_batch(items);
+    ASSERT_EQ(results.size(), 3u);
+
+    EXPECT_TRUE(results[0].result);
+    EXPECT_TRUE(fs::exists(items[0].file_path));
+
+    EXPECT_FALSE(results[1].result);
+    EXPECT_EQ(results[1].result.error_code(), SerializationError::FILE_IO_ERROR);
+
+    EXPECT_FALSE(results[2].result);
+    EXPECT_FALSE(fs::exists(items[2].file_path));
+}
+
+TEST_F(JsonSaveWorkflowTest, BatchSaveEmptyInput) {
+    auto results = writer.write_configuration_batch({});
+    EXPECT_TRUE(results.empty());
+}
+
+TEST_F(JsonSaveWorkflowTest, BatchReadLoadsAllFiles) {
+    std::vector<BatchReadItem> items;
+    for (int i = 0; i < 60; ++i) {
+        const std::string path = get_temp_file("read_" + std::to_string(i) + ".json");
+        std::ofstream(path) << json{{"id", i}}.dump();
+        items.push_back({path, nullptr});  // serializer detected from the extension
+    }
+
+    auto results = reader.read_configuration_batch(items, 4);
+    ASSERT_EQ(results.size(), items.size());
+
+    std::vector<bool> seen(items.size(), false);
+    for (const auto& entry : results) {
+        ASSERT_LT(entry.index, items.size());
+        EXPECT_FALSE(seen[entry.index]);
+        seen[entry.index] = true;
+        EXPECT_EQ(entry.file_path, items[entry.index].file_path);
+        ASSERT_TRUE(entry.result) << entry.result.error_msg_or_default();
+        EXPECT_EQ(entry.result.value()["id"], static_cast<int>(entry.index));
+    }
+}
+
+TEST_F(JsonSaveWorkflowTest, BatchReadStreamsPerFileErrors) {
+    const std::string good = get_temp_file("good.json");
+    const std::string broken = get_temp_file("broken.json");
+    std::ofstream(good) << create_test_config().dump();
+    std::ofstream(broken) << "{ not json";
+
+    std::vector<BatchReadItem> items = {
+        {good, nullptr},
+        {broken, nullptr},
+        {get_temp_file("missing.json"), nullptr},
+        {get_temp_file("unknown.txt"), nullptr},
+    };
+
+    std::vector<BatchReadResult> streamed;
+    const std::size_t delivered = reader.read_configuration_batch(
+        items, [&](BatchReadResult&& entry) { streamed.push_back(std::move(entry)); }, 2);
+    EXPECT_EQ(delivered, items.size());
+    ASSERT_EQ(streamed.size(), items.size());
+
+    std::sort(streamed.begin(), streamed.end(),
+              [](const auto& a, const auto& b) { return a.index < b.index; });
+    EXPECT_TRUE(streamed[0].result);
+    EXPECT_EQ(streamed[0].result.value()["database"]["port"], 5432);
+    EXPECT_FALSE(streamed[1].result);
+    EXPECT_FALSE(streamed[2].result);
+    EXPECT_EQ(streamed[2].result.error_code(), SerializationError::FILE_IO_ERROR);
+    EXPECT_FALSE(streamed[3].result);
+}
+
+#if defined(__linux__)
+TEST_F(JsonSaveWorkflowTest, BatchReadRejectsFifoWithoutBlocking) {
+    // Nobody ever opens the write end: a blocking open() would hang here
+    const std::string fifo = get_temp_file("pipe.json");
+    ASSERT_EQ(::mkfifo(fifo.c_str(), 0600), 0);
+
+    auto results = reader.read_configuration_batch({{fifo, nullptr}}, 1);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_FALSE(results[0].result);
+    EXPECT_EQ(results[0].result.error_code(), SerializationError::FILE_IO_ERROR);
+}
+#endif
+
+TEST_F(JsonSaveWorkflowTest, BatchReadEmptyInput) {
+    EXPECT_TRUE(reader.read_configuration_batch({}).empty());
+}
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: MIT
+// Unit tests for BatchValidator - Core module
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <filesystem>
+#include <fstream>
+#include <set>
+
+#include "core/schema/batch_validator.h"
+#include "core/schema/schema_validator.h"
+
+using json = nlohmann::ordered_json;
+namespace fs = std::filesystem;
+
+namespace configgui {
+namespace core {
+namespace test {
+
+class BatchValidatorTest : public ::testing::Test {
+protected:
+    BatchValidatorTest() {
+        validator_ = std::make_shared<const SchemaValidator>(json{
+            {"type", "object"},
+            {"properties", {
+                {"name", {{"type", "string"}, {"minLength", 1}}},
+                {"port", {{"type", "integer"}, {"minimum", 1}, {"maximum", 65535}}}
+            }},
+            {"required", {"name", "port"}}
+        });
+    }
+
+    // Every third document has two violations
+    std::vector<json> MakeDocuments(std::size_t count) const {
+        std::vector<json> documents;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (i % 3 == 0) {
+                documents.push_back({{"name", ""}, {"port", 0}});
+            } else {
+                documents.push_back({{"name", "svc" + std::to_string(i)}, {"port", 8000 + static_cast<int>(i)}});
+            }
+        }
+        return documents;
+    }
+
+    std::shared_ptr<const SchemaValidator> validator_;
+};
+
+// Test: parallel results match a sequential validateAll per document
+TEST_F(BatchValidatorTest, MatchesSequentialValidation) {
+    const auto documents = MakeDocuments(200);
+    BatchValidator batch(validator_, 4);
+
+    const auto results = batch.validateDocuments(documents);
+    ASSERT_EQ(results.size(), documents.size());
+    for (std::size_t i = 0; i < documents.size(); ++i) {
+        EXPECT_EQ(results[i].index, i);
+        EXPECT_EQ(results[i].errors.size(), validator_->validateAll(documents[i]).size()) << "document " << i;
+        EXPECT_EQ(results[i].valid, i % 3 != 0);
+    }
+}
+
+// Test: every document is streamed exactly once and counted in the stats
+TEST_F(BatchValidatorTest, StreamsEachResultAndAggregatesStats) {
+    const auto documents = MakeDocuments(99);
+    BatchValidator batch(validator_, 4);
+
+    std::set<std::size_t> seen;
+    const auto stats = batch.validateDocuments(documents, [&seen](BatchValidationResult&& result) {
+        EXPECT_TRUE(seen.insert(result.index).second);  // Serialized, so no locking needed
+    });
+
+    EXPECT_EQ(seen.size(), 99u);
+    EXPECT_EQ(stats.documents, 99u);
+    EXPECT_EQ(stats.invalid, 33u);
+    EXPECT_EQ(stats.valid, 66u);
+    EXPECT_EQ(stats.errors, 66u);
+    EXPECT_EQ(stats.load_failures, 0u);
+    EXPECT_LE(stats.workers, batch.workerCount());
+}
+
+// Test: files are loaded on the workers; unreadable ones are reported, not fatal
+TEST_F(BatchValidatorTest, ValidatesFilesAndReportsLoadFailures) {
+    const fs::path dir = fs::temp_directory_path() / "configgui_batch_validator_test";
+    fs::create_directories(dir);
+    const std::string good = (dir / "good.json").string();
+    const std::string bad = (dir / "bad.json").string();
+    std::ofstream(good) << R"({"name": "api", "port": 443})";
+    std::ofstream(bad) << R"({"name": "api", "port": 0})";
+
+    BatchValidator batch(validator_, 2);
+    std::vector<BatchValidationResult> results(3);
+    const auto stats = batch.validateFiles({good, bad, (dir / "missing.json").string()},
+                                           [&results](BatchValidationResult&& result) {
+                                               results[result.index] = std::move(result);
+                                           });
+    fs::remove_all(dir);
+
+    EXPECT_TRUE(results[0].valid);
+    EXPECT_EQ(results[0].path, good);
+    EXPECT_FALSE(results[1].valid);
+    ASSERT_EQ(results[1].errors.size(), 1u);
+    EXPECT_EQ(results[1].errors[0].field(), "/port");
+    EXPECT_FALSE(results[2].valid);
+    EXPECT_FALSE(results[2].load_error.empty());
+
+    EXPECT_EQ(stats.valid, 1u);
+    EXPECT_EQ(stats.invalid, 1u);
+    EXPECT_EQ(stats.load_failures, 1u);
+}
+
+// Test: a single-threaded validator runs on the caller
+TEST_F(BatchValidatorTest, SingleWorkerRunsInline) {
+    BatchValidator batch(validator_, 1);
+    EXPECT_EQ(batch.workerCount(), 1u);
+    const auto stats = batch.validateDocuments(MakeDocuments(10), nullptr);
+    EXPECT_EQ(stats.documents, 10u);
+    EXPECT_EQ(stats.workers, 1u);
+}
+
+}  // namespace test
+}  // namespace core
+}  // namespace configgui
@@ -0,0 +1,295 @@
+// SPDX-License-Identifier: MIT
+// Unit tests for CompiledSchemaCache - Core module
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "core/schema/compiled_schema_cache.h"
+#include "core/schema/schema.h"
+#include "core/schema/schema_artifact.h"
+#include "core/schema/schema_bundle.h"
+#include "core/schema/schema_validator.h"
+
+using json = nlohmann::ordered_json;
+namespace fs = std::filesystem;
+
+namespace configgui {
+namespace core {
+namespace test {
+
+class CompiledSchemaCacheTest : public ::testing::Test {
+protected:
+    CompiledSchemaCacheTest() {
+        test_dir_ = fs::temp_directory_path() / "configgui_schema_cache_test";
+        if (fs::exists(test_dir_)) {
+            fs::remove_all(test_dir_);
+        }
+        fs::create_directories(test_dir_);
+    }
+
+    ~CompiledSchemaCacheTest() override {
+        if (fs::exists(test_dir_)) {
+            fs::remove_all(test_dir_);
+        }
+    }
+
+    std::string WriteSchema(const std::string& filename, const json& data) {
+        const fs::path path = test_dir_ / filename;
+        std::ofstream file(path);
+        file << data.dump(2);
+        file.close();
+        return path.string();
+    }
+
+    // Force a different mtime so the stat fast path cannot match
+    static void BumpMtime(const std::string& path) {
+        fs::last_write_time(path, fs::last_write_time(path) + std::chrono::seconds(5));
+    }
+
+    // Replace from with the same-length to, keeping the file's size and mtime
+    // (an edit in the same mtime tick)
+    static void RewriteInSameTick(const std::string& path, const std::string& from, const std::string& to) {
+        const auto mtime = fs::last_write_time(path);
+        std::ifstream in(path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        in.close();
+        std::string text = buffer.str();
+        text.replace(text.find(from), from.size(), to);
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << text;
+        fs::last_write_time(path, mtime);
+    }
+
+    json schema_ = {
+        {"type", "object"},
+        {"properties", {{"name", {{"type", "string"}}}}}
+    };
+    fs::path test_dir_;
+};
+
+// Test: repeated lookups share one compiled entry
+TEST_F(CompiledSchemaCacheTest, RepeatedGetIsAHit) {
+    CompiledSchemaCache cache;
+    const std::string path = WriteSchema("a.json", schema_);
+
+    auto first = cache.get(path);
+    auto second = cache.get(path);
+    ASSERT_TRUE(first.is_success());
+    ASSERT_TRUE(second.is_success());
+    EXPECT_EQ(first.value().get(), second.value().get());
+    EXPECT_TRUE(first.value()->schema->is_valid());
+    EXPECT_EQ(first.value()->schema->raw_schema(), schema_);
+
+    const auto stats = cache.stats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.entries, 1u);
+}
+
+// Test: a touched file with identical content is served by hash
+TEST_F(CompiledSchemaCacheTest, TouchWithSameContentIsAHit) {
+    CompiledSchemaCache cache;
+    const std::string path = WriteSchema("a.json", schema_);
+
+    auto first = cache.get(path);
+    BumpMtime(path);
+    auto second = cache.get(path);
+    ASSERT_TRUE(second.is_success());
+    EXPECT_EQ(first.value().get(), second.value().get());
+    EXPECT_EQ(cache.stats().misses, 1u);
+}
+
+// Test: changed content is recompiled
+TEST_F(CompiledSchemaCacheTest, ChangedContentIsRecompiled) {
+    CompiledSchemaCache cache;
+    const std::string path = WriteSchema("a.json", schema_);
+    auto first = cache.get(path);
+
+    json changed = schema_;
+    changed["required"] = {"name"};
+    WriteSchema("a.json", changed);
+    BumpMtime(path);
+
+    auto second = cache.get(path);
+    ASSERT_TRUE(second.is_success());
+    EXPECT_NE(first.value().get(), second.value().get());
+    EXPECT_EQ(second.value()->schema->raw_schema(), changed);
+    EXPECT_EQ(cache.stats().misses, 2u);
+}
+
+// Test: the least recently used path is evicted at capacity
+TEST_F(CompiledSchemaCacheTest, EvictsLeastRecentlyUsed) {
+    CompiledSchemaCache cache(2);
+    json other = schema_;
+    other["title"] = "b";
+    json third = schema_;
+    third["title"] = "c";
+    const std::string a = WriteSchema("a.json", schema_);
+    const std::string b = WriteSchema("b.json", other);
+    const std::string c = WriteSchema("c.json", third);
+
+    ASSERT_TRUE(cache.get(a).is_success());
+    ASSERT_TRUE(cache.get(b).is_success());
+    ASSERT_TRUE(cache.get(a).is_success());  // b becomes least recently used
+    ASSERT_TRUE(cache.get(c).is_success());
+
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.evictions, 1u);
+    EXPECT_EQ(stats.entries, 2u);
+
+    ASSERT_TRUE(cache.get(a).is_success());
+    EXPECT_EQ(cache.stats().misses, 3u);
+}
+
+// Test: identical schema text is compiled once
+TEST_F(CompiledSchemaCacheTest, GetFromStringSharesByContent) {
+    CompiledSchemaCache cache;
+    auto first = cache.getFromString(schema_.dump());
+    auto second = cache.getFromString(schema_.dump());
+    ASSERT_TRUE(first.is_success());
+    ASSERT_TRUE(second.is_success());
+    EXPECT_EQ(first.value().get(), second.value().get());
+    EXPECT_EQ(cache.stats().hits, 1u);
+}
+
+// Test: loader error codes are preserved
+TEST_F(CompiledSchemaCacheTest, ReportsErrors) {
+    CompiledSchemaCache cache;
+    auto missing = cache.get((test_dir_ / "missing.json").string());
+    ASSERT_TRUE(missing.is_failure());
+    EXPECT_EQ(missing.error(), FileError::NotFound);
+
+    auto invalid = cache.getFromString("{ not json");
+    ASSERT_TRUE(invalid.is_failure());
+    EXPECT_EQ(invalid.error(), FileError::ParseError);
+
+    auto array = cache.getFromString("[1, 2]");
+    ASSERT_TRUE(array.is_failure());
+    EXPECT_EQ(array.error(), FileError::InvalidJson);
+}
+
+// Test: a second cache (next process start) loads the artifact instead of compiling
+TEST_F(CompiledSchemaCacheTest, LoadsPrecompiledArtifact) {
+    WriteSchema("types.json", {{"definitions", {{"name", {{"type", "string"}, {"minLength", 1}}}}}});
+    json schema = schema_;
+    schema["properties"]["name"] = {{"$ref", "types.json#/definitions/name"}};
+    const std::string path = WriteSchema("a.json", schema);
+
+    CompiledSchemaCache first;
+    ASSERT_TRUE(first.get(path).is_success());
+    ASSERT_TRUE(fs::exists(SchemaArtifact::pathFor(path)));
+    EXPECT_FALSE(fs::exists(SchemaArtifact::pathFor(path) + ".tmp"));
+
+    CompiledSchemaCache second;
+    auto loaded = second.get(path);
+    ASSERT_TRUE(loaded.is_success());
+    EXPECT_EQ(second.stats().artifact_loads, 1u);
+    EXPECT_EQ(second.stats().misses, 0u);
+
+    const CompiledSchema& compiled = *loaded.value();
+    EXPECT_EQ(compiled.schema->raw_schema(), schema);
+    ASSERT_NE(compiled.bundle, nullptr);
+    EXPECT_EQ(compiled.bundle->dereferenced()["properties"]["name"]["minLength"], 1);
+    EXPECT_TRUE(compiled.validator->validateSchemaFormat());
+    EXPECT_EQ(compiled.validator->validateAll(json{{"name", ""}}).size(), 1u);
+}
+
+// Test: edited referenced files and damaged artifacts fall back to compiling
+TEST_F(CompiledSchemaCacheTest, IgnoresStaleOrDamagedArtifacts) {
+    WriteSchema("types.json", {{"definitions", {{"name", {{"type", "string"}}}}}});
+    json schema = schema_;
+    schema["properties"]["name"] = {{"$ref", "types.json#/definitions/name"}};
+    const std::string path = WriteSchema("a.json", schema);
+    {
+        CompiledSchemaCache cache;
+        ASSERT_TRUE(cache.get(path).is_success());
+    }
+
+    WriteSchema("types.json", {{"definitions", {{"name", {{"type", "integer"}}}}}});
+    CompiledSchemaCache after_edit;
+    auto recompiled = after_edit.get(path);
+    ASSERT_TRUE(recompiled.is_success());
+    EXPECT_EQ(after_edit.stats().artifact_loads, 0u);
+    EXPECT_EQ(recompiled.value()->bundle->dereferenced()["properties"]["name"]["type"], "integer");
+
+    std::ofstream(SchemaArtifact::pathFor(path), std::ios::trunc) << "garbage";
+    CompiledSchemaCache after_damage;
+    ASSERT_TRUE(after_damage.get(path).is_success());
+    EXPECT_EQ(after_damage.stats().artifact_loads, 0u);
+    EXPECT_EQ(after_damage.stats().misses, 1u);
+}
+
+// Test: an edit to a referenced file alone invalidates a cached entry
+TEST_F(CompiledSchemaCacheTest, EditedReferencedFileIsRecompiled) {
+    WriteSchema("types.json", {{"definitions", {{"name", {{"type", "string"}}}}}});
+    json schema = schema_;
+    schema["properties"]["name"] = {{"$ref", "types.json#/definitions/name"}};
+    const std::string path = WriteSchema("a.json", schema);
+
+    CompiledSchemaCache cache;
+    cache.setArtifactsEnabled(false);
+    auto first = cache.get(path);
+    ASSERT_TRUE(first.is_success());
+    ASSERT_EQ(first.value()->dependencies.size(), 1u);
+    EXPECT_EQ(cache.get(path).value(), first.value());
+
+    WriteSchema("types.json", {{"definitions", {{"name", {{"type", "integer"}, {"minimum", 0}}}}}});
+    auto second = cache.get(path);
+    ASSERT_TRUE(second.is_success());
+    EXPECT_NE(second.value(), first.value());
+    EXPECT_EQ(second.value()->bundle->dereferenced()["properties"]["name"]["type"], "integer");
+    EXPECT_EQ(cache.stats().misses, 2u);
+    EXPECT_EQ(cache.get(path).value(), second.value());
+}
+
+// Test: same-size edits within one mtime tick are caught by re-reading the bytes
+TEST_F(CompiledSchemaCacheTest, SameTickRewriteIsRecompiled) {
+    CompiledSchemaCache cache;
+    cache.setArtifactsEnabled(false);
+    const std::string path = WriteSchema("a.json", schema_);
+    auto first = cache.get(path);
+    ASSERT_TRUE(first.is_success());
+
+    RewriteInSameTick(path, "\"string\"", "\"number\"");
+    auto second = cache.get(path);
+    ASSERT_TRUE(second.is_success());
+    EXPECT_NE(second.value(), first.value());
+    EXPECT_EQ(second.value()->schema->raw_schema()["properties"]["name"]["type"], "number");
+    EXPECT_EQ(cache.get(path).value(), second.value());
+
+    // The same holds for a file pulled in by $ref
+    WriteSchema("types.json", {{"definitions", {{"name", {{"type", "string"}}}}}});
+    json schema = schema_;
+    schema["properties"]["name"] = {{"$ref", "types.json#/definitions/name"}};
+    const std::string referring = WriteSchema("b.json", schema);
+    auto third = cache.get(referring);
+    ASSERT_TRUE(third.is_success());
+
+    RewriteInSameTick((test_dir_ / "types.json").string(), "\"string\"", "\"number\"");
+    auto fourth = cache.get(referring);
+    ASSERT_TRUE(fourth.is_success());
+    EXPECT_NE(fourth.value(), third.value());
+    EXPECT_EQ(fourth.value()->bundle->dereferenced()["properties"]["name"]["type"], "number");
+}
+
+// Test: entries are shared by content only when the bytes match, not the hash alone
+TEST_F(CompiledSchemaCacheTest, SharedEntriesRecordTheirSource) {
+    CompiledSchemaCache cache;
+    cache.setArtifactsEnabled(false);
+    const std::string first_path = WriteSchema("a.json", schema_);
+    const std::string second_path = WriteSchema("copy.json", schema_);
+
+    auto first = cache.get(first_path);
+    auto second = cache.get(second_path);
+    ASSERT_TRUE(second.is_success());
+    EXPECT_EQ(second.value(), first.value());
+    EXPECT_EQ(first.value()->source_text, schema_.dump(2));
+    EXPECT_EQ(first.value()->source_dir, test_dir_.string());
+}
+
+}  // namespace test
+}  // namespace core
+}  // namespace configgui
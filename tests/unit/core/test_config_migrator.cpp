@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: MIT
+// Unit tests for SchemaDiff and ConfigMigrator - Core module
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <filesystem>
+#include <fstream>
+
+#include "core/schema/config_migrator.h"
+#include "core/schema/schema_validator.h"
+
+using json = nlohmann::ordered_json;
+namespace fs = std::filesystem;
+
+namespace configgui {
+namespace core {
+namespace test {
+
+class ConfigMigratorTest : public ::testing::Test {
+protected:
+    ConfigMigratorTest() {
+        test_dir_ = fs::temp_directory_path() / "configgui_config_migrator_test";
+        if (fs::exists(test_dir_)) {
+            fs::remove_all(test_dir_);
+        }
+        fs::create_directories(test_dir_);
+
+        v1_ = json{
+            {"type", "object"},
+            {"properties", {
+                {"host", {{"type", "string"}, {"title", "Host"}}},
+                {"port", {{"type", "string"}}},
+                {"legacy", {{"type", "object"}, {"properties", {{"flag", {{"type", "boolean"}}}}}}},
+                {"servers", {{"type", "array"}, {"items", {
+                    {"type", "object"},
+                    {"properties", {{"addr", {{"type", "string"}, {"format", "ipv4"}}}}}
+                }}}}
+            }}
+        };
+        v2_ = json{
+            {"type", "object"},
+            {"properties", {
+                {"hostname", {{"type", "string"}, {"title", "Host name"}}},
+                {"port", {{"type", "integer"}}},
+                {"timeout", {{"type", "integer"}, {"default", 30}}},
+                {"servers", {{"type", "array"}, {"items", {
+                    {"type", "object"},
+                    {"properties", {{"address", {{"type", "string"}, {"format", "ipv4"}}}}}
+                }}}}
+            }},
+            {"required", {"hostname", "port", "timeout"}}
+        };
+    }
+
+    ~ConfigMigratorTest() override {
+        if (fs::exists(test_dir_)) {
+            fs::remove_all(test_dir_);
+        }
+    }
+
+    static json OldConfig(int i) {
+        return json{
+            {"host", "node" + std::to_string(i)},
+            {"port", std::to_string(8000 + i)},
+            {"legacy", {{"flag", true}}},
+            {"servers", json::array({{{"addr", "10.0.0.1"}}, {{"addr", "10.0.0.2"}}})}
+        };
+    }
+
+    fs::path test_dir_;
+    json v1_;
+    json v2_;
+};
+
+// Test: diff reports renames, removals, additions and retypes at the top of each subtree
+TEST_F(ConfigMigratorTest, DiffClassifiesChanges) {
+    const SchemaDiff diff = SchemaDiff::compute(JSONSchema(v1_), JSONSchema(v2_));
+
+    EXPECT_EQ(diff.count(SchemaChangeKind::Renamed), 2u);
+    EXPECT_EQ(diff.count(SchemaChangeKind::Removed), 1u);  // "/legacy" only, not "/legacy/flag"
+    EXPECT_EQ(diff.count(SchemaChangeKind::Added), 1u);
+    EXPECT_EQ(diff.count(SchemaChangeKind::Retyped), 1u);
+
+    for (const auto& change : diff.changes()) {
+        if (change.kind == SchemaChangeKind::Renamed && change.path == "/host") {
+            EXPECT_EQ(change.new_path, "/hostname");
+        } else if (change.kind == SchemaChangeKind::Renamed) {
+            EXPECT_EQ(change.path, "/servers/*/addr");
+            EXPECT_EQ(change.new_path, "/servers/*/address");
+        } else if (change.kind == SchemaChangeKind::Retyped) {
+            EXPECT_EQ(change.path, "/port");
+            EXPECT_EQ(change.old_type, "string");
+            EXPECT_EQ(change.new_type, "integer");
+        }
+    }
+
+    EXPECT_TRUE(SchemaDiff::compute(JSONSchema(v1_), JSONSchema(v1_)).empty());
+}
+
+// Test: ambiguous candidates stay separate removals and additions
+TEST_F(ConfigMigratorTest, AmbiguousRenamesAreNotGuessed) {
+    const json from = {{"properties", {{"a", {{"type", "string"}}}, {"b", {{"type", "string"}}}}}};
+    const json to = {{"properties", {{"c", {{"type", "string"}}}, {"d", {{"type", "string"}}}}}};
+    const SchemaDiff diff = SchemaDiff::compute(JSONSchema(from), JSONSchema(to));
+
+    EXPECT_EQ(diff.count(SchemaChangeKind::Renamed), 0u);
+    EXPECT_EQ(diff.count(SchemaChangeKind::Removed), 2u);
+    EXPECT_EQ(diff.count(SchemaChangeKind::Added), 2u);
+}
+
+// Test: the plan upgrades a config so it validates against the new schema
+TEST_F(ConfigMigratorTest, PlanUpgradesDocument) {
+    const MigrationPlan plan{JSONSchema(v1_), JSONSchema(v2_)};
+    json config = OldConfig(1);
+
+    EXPECT_TRUE(plan.apply(config));
+    EXPECT_EQ(config["hostname"], "node1");
+    EXPECT_FALSE(config.contains("host"));
+    EXPECT_FALSE(config.contains("legacy"));
+    EXPECT_EQ(config["port"], 8001);
+    EXPECT_EQ(config["timeout"], 30);
+    EXPECT_EQ(config["servers"][1]["address"], "10.0.0.2");
+    EXPECT_TRUE(SchemaValidator(v2_).validateAll(config).empty());
+
+    // Already migrated: nothing left to do
+    EXPECT_FALSE(plan.apply(config));
+}
+
+// Test: defaults behind relative-file $refs in the target schema are filled
+TEST_F(ConfigMigratorTest, PlanFillsDefaultsBehindExternalRefs) {
+    std::ofstream(test_dir_ / "limits.json") << json{{"type", "integer"}, {"default", 64}}.dump();
+    json to = v2_;
+    to["properties"]["max_clients"] = {{"$ref", "limits.json"}};
+
+    const MigrationPlan plan{JSONSchema(v1_), JSONSchema(to), test_dir_};
+    json config = OldConfig(2);
+
+    EXPECT_TRUE(plan.apply(config));
+    EXPECT_EQ(config["max_clients"], 64);
+}
+
+// Test: files are migrated in parallel, rewritten, and failures reported per file
+TEST_F(ConfigMigratorTest, MigratesFilesInParallel) {
+    std::vector<std::string> paths;
+    for (int i = 0; i < 40; ++i) {
+        const fs::path path = test_dir_ / ("config_" + std::to_string(i) + ".json");
+        std::ofstream(path) << OldConfig(i).dump();
+        paths.push_back(path.string());
+    }
+    paths.push_back((test_dir_ / "missing.json").string());
+
+    auto plan = std::make_shared<const MigrationPlan>(JSONSchema(v1_), JSONSchema(v2_));
+    ConfigMigrator migrator(plan, std::make_shared<const SchemaValidator>(v2_), 4);
+    std::size_t reported = 0;
+    const auto stats = migrator.migrateFiles(paths, [&reported](MigrationResult&& result) {
+        ++reported;
+        EXPECT_EQ(result.error.empty(), result.path.find("missing") == std::string::npos);
+    });
+
+    EXPECT_EQ(reported, paths.size());
+    EXPECT_EQ(stats.documents, paths.size());
+    EXPECT_EQ(stats.changed, 40u);
+    EXPECT_EQ(stats.invalid, 0u);
+    EXPECT_EQ(stats.failures, 1u);
+
+    std::ifstream migrated(paths[7]);
+    const json config = json::parse(migrated);
+    EXPECT_EQ(config["hostname"], "node7");
+    EXPECT_EQ(config["port"], 8007);
+
+    // Rewrites go through unique temp files that never outlive the batch
+    std::size_t entries = 0;
+    for (const auto& entry : fs::directory_iterator(test_dir_)) {
+        (void)entry;
+        ++entries;
+    }
+    EXPECT_EQ(entries, 40u);
+}
+
+}  // namespace test
+}  // namespace core
+}  // namespace configgui
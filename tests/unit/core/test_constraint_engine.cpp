@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: MIT
+// Unit tests for ConstraintEngine and InstanceIndex - Core module
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "core/schema/constraint_engine.h"
+#include "core/schema/instance_index.h"
+#include "core/schema/validation_plan.h"
+
+using json = nlohmann::ordered_json;
+
+namespace configgui {
+namespace core {
+namespace test {
+
+class ConstraintEngineTest : public ::testing::Test {
+protected:
+    json schema = {
+        {"type", "object"},
+        {"properties", {
+            {"mode", {{"enum", {"plain", "tls"}}}},
+            {"port", {{"type", "integer"}}}
+        }},
+        {"dependencies", {{"username", {"password"}}}},
+        {"if", {{"properties", {{"mode", {{"const", "tls"}}}}}, {"required", {"mode"}}}},
+        {"then", {{"required", {"certificate"}}}}
+    };
+};
+
+// Test: JSON Schema equality ignores member order and number representation
+TEST_F(ConstraintEngineTest, InstanceIndexUsesSchemaEquality) {
+    const json items = json::array({1, 1.0, json{{"a", 1}, {"b", 2}}, json{{"b", 2}, {"a", 1}}, "1", json::array({1, 2}),
+                                    json::array({2, 1}), 1.5, true, nullptr});
+    InstanceIndex index;
+    std::vector<std::size_t> duplicates_of;
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        duplicates_of.push_back(index.insert(items[i], i));
+    }
+
+    EXPECT_EQ(duplicates_of[0], InstanceIndex::npos);
+    EXPECT_EQ(duplicates_of[1], 0u);
+    EXPECT_EQ(duplicates_of[3], 2u);
+    for (std::size_t i : {4u, 5u, 6u, 7u, 8u, 9u}) {
+        EXPECT_EQ(duplicates_of[i], InstanceIndex::npos) << items[i].dump();
+    }
+    EXPECT_EQ(hashInstance(json{{"a", 1}, {"b", 2}}), hashInstance(json{{"b", 2}, {"a", 1.0}}));
+}
+
+// Test: rules derived from the schema report the same errors as the plan
+TEST_F(ConstraintEngineTest, DerivesRulesFromRootKeywords) {
+    ValidationPlan plan(schema);
+    ASSERT_TRUE(plan.isComplete());
+    ConstraintEngine engine = ConstraintEngine::fromPlan(plan);
+    ASSERT_EQ(engine.ruleCount(), 2u);
+
+    const json document = {{"username", "admin"}, {"mode", "tls"}, {"port", 1}};
+    auto report = engine.evaluate(document);
+    EXPECT_EQ(report.rules_run, 2u);
+    EXPECT_TRUE(report.custom_errors.empty());
+    ASSERT_EQ(report.errors.size(), 2u);
+    EXPECT_EQ(report.errors[0].field(), "/password");
+    EXPECT_EQ(report.errors[1].field(), "/certificate");
+
+    ValidationErrors full;
+    plan.validate(document, [&full](const ValidationError& error) { full.push_back(error); });
+    ASSERT_EQ(full.size(), 2u);
+    EXPECT_EQ(full[0], report.errors[0]);
+    EXPECT_EQ(full[1], report.errors[1]);
+}
+
+// Test: only rules whose triggers overlap the edit are re-run
+TEST_F(ConstraintEngineTest, EvaluatesOnlyTriggeredRules) {
+    ValidationPlan plan(schema);
+    ConstraintEngine engine = ConstraintEngine::fromPlan(plan);
+    json document = {{"username", "admin"}, {"mode", "plain"}};
+    ASSERT_EQ(engine.evaluate(document).errors.size(), 1u);
+
+    // "port" is read by no rule: cached errors are replayed
+    document["port"] = 8080;
+    auto report = engine.evaluateChanged(document, {"/port"});
+    EXPECT_EQ(report.rules_run, 0u);
+    EXPECT_EQ(report.errors.size(), 1u);
+    EXPECT_TRUE(report.changed_locations.empty());
+
+    // Only the conditional reads "mode"
+    document["mode"] = "tls";
+    report = engine.evaluateChanged(document, {"/mode"});
+    EXPECT_EQ(report.rules_run, 1u);
+    ASSERT_EQ(report.errors.size(), 2u);
+    EXPECT_EQ(report.changed_locations, std::vector<std::string>{"/certificate"});
+
+    document["password"] = "secret";
+    report = engine.evaluateChanged(document, {"/password"});
+    EXPECT_EQ(report.rules_run, 1u);
+    ASSERT_EQ(report.errors.size(), 1u);
+    EXPECT_EQ(report.errors[0].field(), "/certificate");
+    EXPECT_EQ(report.changed_locations, std::vector<std::string>{"/password"});
+}
+
+// Test: unique keys across an object array are found in one pass
+TEST_F(ConstraintEngineTest, UniqueKeyReportsEachDuplicate) {
+    ConstraintEngine engine;
+    engine.addUniqueKey("/servers", "/id");
+
+    json document = {{"servers", json::array()}};
+    for (int i = 0; i < 1000; ++i) {
+        document["servers"].push_back({{"id", i % 998}, {"host", "h" + std::to_string(i)}});
+    }
+    document["servers"].push_back({{"host", "no-id"}});
+
+    auto report = engine.evaluate(document);
+    ASSERT_EQ(report.errors.size(), 2u);
+    EXPECT_EQ(report.errors[0].field(), "/servers/998/id");
+    EXPECT_EQ(report.errors[0].message(), "Value 0 is already used by item 0");
+    EXPECT_EQ(report.errors[1].field(), "/servers/999/id");
+    EXPECT_EQ(report.custom_errors.size(), 2u);
+
+    // Edits inside the array re-run the rule; edits elsewhere do not
+    document["servers"][999]["id"] = 5000;
+    EXPECT_EQ(engine.evaluateChanged(document, {"/servers/999/id"}).errors.size(), 1u);
+    EXPECT_EQ(engine.evaluateChanged(document, {"/name"}).rules_run, 0u);
+}
+
+// Test: pointer overlap is component-wise
+TEST_F(ConstraintEngineTest, PointersOverlapByComponent) {
+    EXPECT_TRUE(ConstraintEngine::pointersOverlap("", "/a"));
+    EXPECT_TRUE(ConstraintEngine::pointersOverlap("/a", "/a/b"));
+    EXPECT_TRUE(ConstraintEngine::pointersOverlap("/a/b", "/a"));
+    EXPECT_FALSE(ConstraintEngine::pointersOverlap("/a", "/ab"));
+    EXPECT_FALSE(ConstraintEngine::pointersOverlap("/a/b", "/a/c"));
+}
+
+} // namespace test
+} // namespace core
+} // namespace configgui
@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: MIT
+// Unit tests for IncrementalValidator - Core module
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "core/data/configuration_data.h"
+#include "core/schema/incremental_validator.h"
+#include "core/schema/schema_validator.h"
+
+using json = nlohmann::ordered_json;
+
+namespace configgui {
+namespace core {
+namespace test {
+
+class IncrementalValidatorTest : public ::testing::Test {
+protected:
+    json schema = {
+        {"type", "object"},
+        {"properties", {
+            {"name", {{"type", "string"}, {"minLength", 1}}},
+            {"port", {{"type", "integer"}, {"minimum", 1}, {"maximum", 65535}}},
+            {"server", {
+                {"type", "object"},
+                {"properties", {{"host", {{"type", "string"}}}}},
+                {"required", {"host"}}
+            }}
+        }},
+        {"required", {"name", "port"}},
+        {"additionalProperties", false}
+    };
+};
+
+// Test: only dirty fields are rechecked
+TEST_F(IncrementalValidatorTest, RevalidatesOnlyDirtyFields) {
+    SchemaValidator validator(schema);
+    IncrementalValidator incremental(validator);
+    ASSERT_TRUE(incremental.supportsIncremental());
+
+    // "name" is invalid but never edited, so an incremental pass leaves it alone
+    ConfigurationData config(json{{"name", ""}, {"port", 80}});
+    config.set_value("port", 0);
+
+    EXPECT_FALSE(incremental.revalidateDirty(config));
+    ASSERT_EQ(config.get_errors("port").size(), 1u);
+    EXPECT_EQ(config.get_errors("port")[0].field(), "/port");
+    EXPECT_EQ(config.get_errors("port")[0].type(), ValidationErrorType::MinimumViolation);
+    EXPECT_TRUE(config.get_errors("name").empty());
+
+    // Fixing the field clears its errors in place
+    config.set_value("port", 8080);
+    EXPECT_TRUE(incremental.revalidateDirty(config));
+    EXPECT_TRUE(config.get_errors("port").empty());
+}
+
+// Test: nested errors are filed under their top-level field
+TEST_F(IncrementalValidatorTest, NestedErrorsBelongToTopLevelField) {
+    SchemaValidator validator(schema);
+    IncrementalValidator incremental(validator);
+
+    ConfigurationData config(json{{"name", "app"}, {"port", 80}});
+    config.set_value("server", json{{"host", 42}});
+
+    EXPECT_FALSE(incremental.revalidate(config, {"server"}));
+    ASSERT_EQ(config.get_errors("server").size(), 1u);
+    EXPECT_EQ(config.get_errors("server")[0].field(), "/server/host");
+}
+
+// Test: parent constraints on the edited field are enforced
+TEST_F(IncrementalValidatorTest, ChecksRequiredAndAdditionalProperties) {
+    SchemaValidator validator(schema);
+    IncrementalValidator incremental(validator);
+
+    ConfigurationData config(json{{"name", "app"}, {"port", 80}});
+    config.data().erase("port");
+    config.set_value("extra", true);
+
+    EXPECT_FALSE(incremental.revalidate(config, {"port", "extra"}));
+    ASSERT_EQ(config.get_errors("port").size(), 1u);
+    EXPECT_EQ(config.get_errors("port")[0].type(), ValidationErrorType::Required);
+    ASSERT_EQ(config.get_errors("extra").size(), 1u);
+}
+
+// Test: full validation matches the incremental result for the same edits
+TEST_F(IncrementalValidatorTest, FullPassFilesErrorsPerField) {
+    SchemaValidator validator(schema);
+    IncrementalValidator incremental(validator);
+
+    ConfigurationData config(json{{"name", ""}, {"port", 0}});
+    EXPECT_FALSE(incremental.validateAll(config));
+    EXPECT_EQ(config.get_errors("name").size(), 1u);
+    EXPECT_EQ(config.get_errors("port").size(), 1u);
+    EXPECT_EQ(config.all_errors().size(), 2u);
+}
+
+// Test: root combinators tie fields together, so a full pass is used
+TEST_F(IncrementalValidatorTest, RootCombinatorsFallBackToFullPass) {
+    json combined = {
+        {"type", "object"},
+        {"anyOf", {{{"required", {"a"}}}, {{"required", {"b"}}}}}
+    };
+    SchemaValidator validator(combined);
+    IncrementalValidator incremental(validator);
+    EXPECT_FALSE(incremental.supportsIncremental());
+
+    ConfigurationData config(json{{"c", 1}});
+    config.set_value("c", 2);
+    EXPECT_FALSE(incremental.revalidateDirty(config));
+    EXPECT_EQ(config.get_errors("").size(), 1u);
+}
+
+// Test: editing a dependency trigger refiles the dependent field's errors
+TEST_F(IncrementalValidatorTest, CrossFieldRulesRefileAffectedFields) {
+    json dependent = {
+        {"type", "object"},
+        {"properties", {
+            {"username", {{"type", "string"}}},
+            {"password", {{"type", "string"}, {"minLength", 8}}}
+        }},
+        {"dependencies", {{"username", {"password"}}}}
+    };
+    SchemaValidator validator(dependent);
+    IncrementalValidator incremental(validator);
+    ASSERT_TRUE(incremental.supportsIncremental());
+
+    ConfigurationData config(json::object());
+    EXPECT_TRUE(incremental.validateAll(config));
+
+    config.set_value("username", "admin");
+    EXPECT_FALSE(incremental.revalidateDirty(config));
+    ASSERT_EQ(config.get_errors("password").size(), 1u);
+    EXPECT_EQ(config.get_errors("password")[0].type(), ValidationErrorType::Required);
+    config.mark_clean("username");
+
+    // Adding the dependent field runs the rule again; the stale error is cleared
+    config.set_value("password", "short");
+    EXPECT_FALSE(incremental.revalidateDirty(config));
+    ASSERT_EQ(config.get_errors("password").size(), 1u);
+    EXPECT_EQ(config.get_errors("password")[0].type(), ValidationErrorType::MinLengthViolation);
+}
+
+// Test: custom rules are filed with the schema errors
+TEST_F(IncrementalValidatorTest, CustomRulesJoinValidation) {
+    json servers = {
+        {"type", "object"},
+        {"properties", {{"servers", {{"type", "array"}}}}}
+    };
+    SchemaValidator validator(servers);
+    IncrementalValidator incremental(validator);
+    incremental.constraints().addUniqueKey("/servers", "/id");
+
+    ConfigurationData config(json{{"servers", {{{"id", "a"}}, {{"id", "b"}}, {{"id", "a"}}}}});
+    EXPECT_FALSE(incremental.validateAll(config));
+    ASSERT_EQ(config.get_errors("servers").size(), 1u);
+    EXPECT_EQ(config.get_errors("servers")[0].field(), "/servers/2/id");
+
+    config.set_value("servers", json{{{"id", "a"}}, {{"id", "b"}}, {{"id", "c"}}});
+    EXPECT_TRUE(incremental.revalidateDirty(config));
+}
+
+} // namespace test
+} // namespace core
+} // namespace configgui
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: MIT
+// Unit tests for RuleParser - Core module
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "core/schema/rule_parser.h"
+#include "core/schema/validation_plan.h"
+
+using json = nlohmann::ordered_json;
+
+namespace configgui {
+namespace core {
+namespace test {
+
+class RuleParserTest : public ::testing::Test {
+protected:
+    static ValidationErrors collect(const ValidationPlan& plan, const json& document) {
+        ValidationErrors errors;
+        plan.validate(document, [&errors](const ValidationError& error) { errors.push_back(error); });
+        return errors;
+    }
+};
+
+TEST_F(RuleParserTest, ParsesTypeRangeAndModifiers) {
+    const auto rule = RuleParser::parseShorthand("level", "integer[0,5]?{enum:A| B ||C}");
+
+    EXPECT_EQ(rule.name, "level");
+    EXPECT_EQ(rule.type, "integer");
+    EXPECT_FALSE(rule.required);
+    EXPECT_TRUE(rule.allow_empty);
+    EXPECT_DOUBLE_EQ(rule.minimum, 0.0);
+    EXPECT_DOUBLE_EQ(rule.maximum, 5.0);
+    EXPECT_EQ(rule.enum_values, (std::vector<std::string>{"A", "B", "C"}));
+}
+
+TEST_F(RuleParserTest, OpenRangesAndRequiredModifier) {
+    const auto open_max = RuleParser::parseShorthand("lat", "float[-90.5,+]");
+    EXPECT_DOUBLE_EQ(open_max.minimum, -90.5);
+    EXPECT_DOUBLE_EQ(open_max.maximum, std::numeric_limits<double>::max());
+    EXPECT_TRUE(open_max.required);
+
+    // Ranges only apply to numeric types; {required} overrides '?'
+    const auto text = RuleParser::parseShorthand("name", "string[1,2]?{required}");
+    EXPECT_DOUBLE_EQ(text.minimum, std::numeric_limits<double>::lowest());
+    EXPECT_TRUE(text.required);
+    EXPECT_FALSE(text.allow_empty);
+}
+
+TEST_F(RuleParserTest, PatternRunsToClosingBrace) {
+    const auto rule = RuleParser::parseShorthand("code", "string{optional,pattern:^[A-Z]{2,3}?$}");
+
+    EXPECT_EQ(rule.pattern, "^[A-Z]{2,3}?$");
+    EXPECT_FALSE(rule.required);
+    EXPECT_EQ(rule.type, "string");
+}
+
+TEST_F(RuleParserTest, CompileCachesByShorthand) {
+    const auto first = RuleParser::compile("integer[1,65535]");
+    const auto second = RuleParser::compile("integer[1,65535]");
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_GE(RuleParser::cachedRuleCount(), 1u);
+
+    // The cached rule is shared; parseShorthand hands out named copies
+    EXPECT_EQ(RuleParser::parseShorthand("port", "integer[1,65535]").name, "port");
+    EXPECT_TRUE(first->rule.name.empty());
+    EXPECT_EQ(first->schema(), json({{"type", "integer"}, {"minimum", 1.0}, {"maximum", 65535.0}}));
+}
+
+TEST_F(RuleParserTest, ShorthandRoundTrip) {
+    const json rules = {{"mode", "string{required,enum:fast|safe}"}, {"retries", "integer[0,5]{optional}"}};
+
+    const json old_format = RuleParser::convertNewFormatToOld(rules);
+    ASSERT_EQ(old_format.size(), 2u);
+    EXPECT_EQ(old_format[0]["allowEmpty"], false);
+    EXPECT_EQ(old_format[1]["minimum"], 0.0);
+
+    EXPECT_EQ(RuleParser::convertOldFormatToNew(old_format), rules);
+}
+
+TEST_F(RuleParserTest, RulesCompileToValidationPlan) {
+    const json rules = {{"host", "string{required,pattern:^[a-z.]+$}"},
+                        {"port", "integer[1,65535]"},
+                        {"ratio", "float[0,1]?"},
+                        {"mode", {{"type", "string"}, {"enum", {"fast", "safe"}}}}};
+    const ValidationPlan plan(RuleParser::rulesToSchema(rules));
+    ASSERT_TRUE(plan.isComplete());
+
+    EXPECT_TRUE(collect(plan, {{"host", "db.local"}, {"port", 5432}, {"mode", "fast"}}).empty());
+
+    const auto errors = collect(plan, {{"host", "DB"}, {"port", 0}, {"ratio", 1.5}, {"mode", "slow"}});
+    ASSERT_EQ(errors.size(), 4u);
+    EXPECT_EQ(errors[0].field(), "/host");
+    EXPECT_EQ(errors[1].field(), "/port");
+    EXPECT_EQ(errors[2].field(), "/ratio");
+    EXPECT_EQ(errors[3].field(), "/mode");
+
+    const auto missing = collect(plan, json::object());
+    ASSERT_EQ(missing.size(), 3u);  // host, port, mode; ratio is optional
+    EXPECT_EQ(missing[0].type(), ValidationErrorType::Required);
+}
+
+} // namespace test
+} // namespace core
+} // namespace configgui
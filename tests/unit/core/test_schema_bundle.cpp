@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: MIT
+// Unit tests for SchemaBundle - Core module
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <filesystem>
+#include <fstream>
+
+#include "core/schema/schema_bundle.h"
+
+using json = nlohmann::ordered_json;
+namespace fs = std::filesystem;
+
+namespace configgui {
+namespace core {
+namespace test {
+
+class SchemaBundleTest : public ::testing::Test {
+protected:
+    SchemaBundleTest() {
+        test_dir_ = fs::temp_directory_path() / "configgui_schema_bundle_test";
+        if (fs::exists(test_dir_)) {
+            fs::remove_all(test_dir_);
+        }
+        fs::create_directories(test_dir_);
+    }
+
+    ~SchemaBundleTest() override {
+        if (fs::exists(test_dir_)) {
+            fs::remove_all(test_dir_);
+        }
+    }
+
+    std::string WriteSchema(const std::string& filename, const json& data) {
+        const fs::path path = test_dir_ / filename;
+        std::ofstream file(path);
+        file << data.dump(2);
+        file.close();
+        return path.string();
+    }
+
+    fs::path test_dir_;
+};
+
+// Test: local references are inlined and definitions dropped
+TEST_F(SchemaBundleTest, InlinesLocalReferences) {
+    const json schema = {
+        {"type", "object"},
+        {"definitions", {
+            {"port", {{"type", "integer"}, {"minimum", 1}}}
+        }},
+        {"properties", {
+            {"http", {{"$ref", "#/definitions/port"}, {"description", "HTTP port"}}},
+            {"https", {{"$ref", "#/definitions/port"}}}
+        }}
+    };
+
+    auto bundle = SchemaBundle::fromSchema(schema);
+    ASSERT_TRUE(bundle.is_success()) << bundle.error();
+    const json& view = bundle.value().dereferenced();
+
+    EXPECT_FALSE(view.contains("definitions"));
+    EXPECT_EQ(view["properties"]["https"], (json{{"type", "integer"}, {"minimum", 1}}));
+    EXPECT_EQ(view["properties"]["http"]["description"], "HTTP port");
+    EXPECT_EQ(view["properties"]["http"]["minimum"], 1);
+    EXPECT_EQ(bundle.value().refCount(), 2u);
+}
+
+// Test: property names that match keywords are still resolved as sub-schemas
+TEST_F(SchemaBundleTest, PropertyNamesAreNotKeywords) {
+    const json schema = {
+        {"$defs", {{"port", {{"type", "integer"}}}}},
+        {"properties", {
+            {"definitions", {{"type", "array"}}},
+            {"default", {{"$ref", "#/$defs/port"}}},
+            {"enum", {{"default", 3}, {"properties", {{"const", {{"$ref", "#/$defs/port"}}}}}}}
+        }},
+        {"patternProperties", {{"^examples$", {{"$ref", "#/$defs/port"}}}}}
+    };
+
+    auto bundle = SchemaBundle::fromSchema(schema);
+    ASSERT_TRUE(bundle.is_success()) << bundle.error();
+    const json& view = bundle.value().dereferenced();
+
+    EXPECT_FALSE(view.contains("$defs"));
+    EXPECT_EQ(view["properties"]["definitions"], (json{{"type", "array"}}));
+    EXPECT_EQ(view["properties"]["default"], (json{{"type", "integer"}}));
+    EXPECT_EQ(view["properties"]["enum"]["default"], 3);
+    EXPECT_EQ(view["properties"]["enum"]["properties"]["const"], (json{{"type", "integer"}}));
+    EXPECT_EQ(view["patternProperties"]["^examples$"], (json{{"type", "integer"}}));
+    EXPECT_EQ(bundle.value().refCount(), 3u);
+}
+
+// Test: relative-file references resolve against the referencing document
+TEST_F(SchemaBundleTest, InlinesRelativeFileReferences) {
+    fs::create_directories(test_dir_ / "common");
+    WriteSchema("common/types.json", {
+        {"definitions", {
+            {"host", {{"type", "string"}, {"minLength", 1}}},
+            {"endpoint", {
+                {"type", "object"},
+                {"properties", {{"host", {{"$ref", "#/definitions/host"}}}}},
+                {"required", {"host"}}
+            }}
+        }}
+    });
+    const std::string root = WriteSchema("root.json", {
+        {"type", "object"},
+        {"properties", {{"server", {{"$ref", "common/types.json#/definitions/endpoint"}}}}}
+    });
+
+    auto bundle = SchemaBundle::fromFile(root);
+    ASSERT_TRUE(bundle.is_success()) << bundle.error();
+    EXPECT_EQ(bundle.value().dereferenced()["properties"]["server"]["properties"]["host"]["minLength"], 1);
+    EXPECT_EQ(bundle.value().externalDocuments().size(), 1u);
+}
+
+// Test: cycles are reported instead of recursing forever
+TEST_F(SchemaBundleTest, DetectsCycles) {
+    const json schema = {
+        {"definitions", {
+            {"node", {
+                {"type", "object"},
+                {"properties", {{"children", {{"type", "array"}, {"items", {{"$ref", "#/definitions/node"}}}}}}}
+            }}
+        }},
+        {"$ref", "#/definitions/node"}
+    };
+
+    auto bundle = SchemaBundle::fromSchema(schema);
+    ASSERT_TRUE(bundle.is_failure());
+    EXPECT_NE(bundle.error().find("Cyclic $ref"), std::string::npos);
+}
+
+// Test: missing targets are reported
+TEST_F(SchemaBundleTest, ReportsUnresolvableReferences) {
+    auto missing_pointer = SchemaBundle::fromSchema({{"$ref", "#/definitions/absent"}});
+    ASSERT_TRUE(missing_pointer.is_failure());
+
+    auto missing_file = SchemaBundle::fromSchema({{"$ref", "absent.json#/x"}}, test_dir_);
+    ASSERT_TRUE(missing_file.is_failure());
+}
+
+// Test: path table covers properties and array items with required flags
+TEST_F(SchemaBundleTest, IndexesPathsAndRequiredSets) {
+    const json schema = {
+        {"type", "object"},
+        {"definitions", {{"server", {
+            {"type", "object"},
+            {"properties", {{"host", {{"type", "string"}}}, {"port", {{"type", "integer"}}}}},
+            {"required", {"port"}}
+        }}}},
+        {"properties", {
+            {"name", {{"type", "string"}}},
+            {"servers", {{"type", "array"}, {"items", {{"$ref", "#/definitions/server"}}}}}
+        }},
+        {"required", {"servers"}}
+    };
+
+    auto result = SchemaBundle::fromSchema(schema);
+    ASSERT_TRUE(result.is_success()) << result.error();
+    const SchemaBundle& bundle = result.value();
+
+    const auto* root = bundle.find("");
+    ASSERT_NE(root, nullptr);
+    EXPECT_EQ(root->required_mask, (std::vector<bool>{false, true}));
+
+    const auto* servers = bundle.find("/servers");
+    ASSERT_NE(servers, nullptr);
+    EXPECT_TRUE(servers->required);
+
+    const auto* port = bundle.find("/servers/3/port");
+    ASSERT_NE(port, nullptr);
+    EXPECT_TRUE(port->required);
+    EXPECT_EQ((*port->schema)["type"], "integer");
+    EXPECT_EQ(bundle.find("/servers/*/port"), port);
+
+    const auto* item = bundle.find("/servers/0");
+    ASSERT_NE(item, nullptr);
+    EXPECT_EQ(item->required_mask, (std::vector<bool>{false, true}));
+
+    EXPECT_EQ(bundle.findSchema("/servers/0/missing"), nullptr);
+    EXPECT_EQ(bundle.findSchema("/name/x"), nullptr);
+}
+
+}  // namespace test
+}  // namespace core
+}  // namespace configgui
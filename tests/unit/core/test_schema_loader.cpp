@@ -329,6 +329,77 @@ TEST_F(SchemaLoaderTest, LoadMultipleSchemasSequentially) {
     EXPECT_EQ(result2.value().title(), "Schema 2");
 }
 
+// Test: nested properties are found by dotted path and JSON Pointer
+TEST_F(SchemaLoaderTest, FindNestedSchemaByPath) {
+    json schema_json = {
+        {"type", "object"},
+        {"properties", {
+            {"Server", {
+                {"type", "object"},
+                {"properties", {
+                    {"Http", {
+                        {"type", "object"},
+                        {"properties", {{"Port", {{"type", "integer"}, {"maximum", 65535}}}}}
+                    }}
+                }}
+            }},
+            {"a/b", {{"type", "string"}}}
+        }}
+    };
+
+    JSONSchema schema(schema_json);
+    const json* by_dotted = schema.findSchema("Server.Http.Port");
+    ASSERT_NE(by_dotted, nullptr);
+    EXPECT_EQ((*by_dotted)["maximum"], 65535);
+    EXPECT_EQ(schema.findSchema("/Server/Http/Port"), by_dotted);
+    ASSERT_NE(schema.getProperty("a/b"), nullptr);
+    EXPECT_EQ(schema.findByPointer("/a~1b"), schema.getProperty("a/b"));
+    EXPECT_EQ(schema.findSchema(""), &schema.raw_schema());
+    EXPECT_EQ(schema.findSchema("Server.Missing"), nullptr);
+    EXPECT_EQ(schema.indexedPathCount(), 5u);
+}
+
+// Test: array items and local $refs are indexed
+TEST_F(SchemaLoaderTest, FindSchemaThroughItemsAndRefs) {
+    json schema_json = {
+        {"type", "object"},
+        {"definitions", {{"host", {{"type", "string"}, {"minLength", 1}}}}},
+        {"properties", {
+            {"servers", {
+                {"type", "array"},
+                {"items", {
+                    {"type", "object"},
+                    {"properties", {{"host", {{"$ref", "#/definitions/host"}}}}}
+                }}
+            }}
+        }}
+    };
+
+    JSONSchema schema(schema_json);
+    const json* host = schema.findSchema("servers.*.host");
+    ASSERT_NE(host, nullptr);
+    EXPECT_EQ((*host)["minLength"], 1);
+    EXPECT_EQ(schema.findSchema("servers.3.host"), host);
+    EXPECT_EQ(schema.findSchema("/servers/0/host"), host);
+}
+
+// Test: copies share the schema and its index
+TEST_F(SchemaLoaderTest, CopiedSchemaKeepsIndex) {
+    json schema_json = {
+        {"type", "object"},
+        {"properties", {{"name", {{"type", "string"}}}}}
+    };
+
+    JSONSchema copy;
+    {
+        JSONSchema original(schema_json);
+        copy = original;
+    }
+    ASSERT_TRUE(copy.hasProperty("name"));
+    EXPECT_EQ(copy.getProperty("name"), copy.findSchema("name"));
+    EXPECT_EQ((*copy.getProperty("name"))["type"], "string");
+}
+
 } // namespace test
 } // namespace core
 } // namespace configgui
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+// Unit tests for SchemaNormalizer - Core module
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "core/schema/schema_normalizer.h"
+
+using json = nlohmann::ordered_json;
+
+namespace configgui {
+namespace core {
+namespace test {
+
+class SchemaNormalizerTest : public ::testing::Test {
+protected:
+    json schema = {
+        {"type", "object"},
+        {"properties", {
+            {"name", {{"type", "string"}, {"default", "service"}}},
+            {"port", {{"type", "integer"}, {"default", 8080}}},
+            {"ratio", {{"type", "number"}}},
+            {"enabled", {{"type", "boolean"}}},
+            {"label", {{"type", "string"}}},
+            {"server", {
+                {"type", "object"},
+                {"properties", {
+                    {"host", {{"type", "string"}, {"default", "localhost"}}},
+                    {"timeout", {{"type", "integer"}}}
+                }}
+            }},
+            {"ports", {{"type", "array"}, {"items", {{"type", "integer"}}}}},
+            {"labels", {{"type", "object"}, {"additionalProperties", {{"type", "string"}}}}}
+        }}
+    };
+};
+
+// Test: missing members get their defaults, nested objects are created
+TEST_F(SchemaNormalizerTest, FillsDefaults) {
+    SchemaNormalizer normalizer(schema);
+    NormalizeStats stats;
+    const json result = normalizer.normalize(json{{"port", 9000}}, {}, &stats);
+
+    EXPECT_EQ(result["port"], 9000);  // Present values are kept
+    EXPECT_EQ(result["name"], "service");
+    EXPECT_EQ(result["server"], (json{{"host", "localhost"}}));
+    EXPECT_FALSE(result.contains("ratio"));  // No default anywhere below
+    EXPECT_EQ(stats.defaults_filled, 2u);
+}
+
+// Test: scalars are converted to the declared type only when lossless
+TEST_F(SchemaNormalizerTest, CoercesTypes) {
+    SchemaNormalizer normalizer(schema);
+    NormalizeStats stats;
+    const json result = normalizer.normalize(json{
+        {"port", "8443"},
+        {"ratio", "0.5"},
+        {"enabled", "TRUE"},
+        {"label", 42},
+        {"server", {{"timeout", 30.0}}},
+        {"ports", {"80", 443, "x"}},
+        {"labels", {{"tier", 1}}}
+    }, {}, &stats);
+
+    EXPECT_EQ(result["port"], 8443);
+    EXPECT_TRUE(result["port"].is_number_integer());
+    EXPECT_DOUBLE_EQ(result["ratio"].get<double>(), 0.5);
+    EXPECT_EQ(result["enabled"], true);
+    EXPECT_EQ(result["label"], "42");
+    EXPECT_TRUE(result["server"]["timeout"].is_number_integer());
+    EXPECT_EQ(result["ports"], (json{80, 443, "x"}));  // "x" is left for validation to report
+    EXPECT_EQ(result["labels"]["tier"], "1");
+    EXPECT_EQ(stats.coerced, 7u);
+}
+
+// Test: unknown members are only removed on request
+TEST_F(SchemaNormalizerTest, StripsUnknownKeysWhenAsked) {
+    SchemaNormalizer normalizer(schema);
+    const json input = {{"name", "api"}, {"legacy", true}, {"labels", {{"anything", "kept"}}}};
+
+    EXPECT_TRUE(normalizer.normalize(input)["legacy"] == true);
+
+    NormalizeOptions options;
+    options.strip_unknown = true;
+    NormalizeStats stats;
+    const json stripped = normalizer.normalize(input, options, &stats);
+    EXPECT_FALSE(stripped.contains("legacy"));
+    EXPECT_EQ(stripped["labels"]["anything"], "kept");  // additionalProperties schema keeps them
+    EXPECT_EQ(stats.stripped, 1u);
+}
+
+// Test: recursive schemas compile and fill without looping
+TEST_F(SchemaNormalizerTest, HandlesRecursiveReferences) {
+    const json recursive = {
+        {"definitions", {{"node", {
+            {"type", "object"},
+            {"properties", {
+                {"name", {{"type", "string"}, {"default", "leaf"}}},
+                {"child", {{"$ref", "#/definitions/node"}}}
+            }}
+        }}}},
+        {"$ref", "#/definitions/node"}
+    };
+
+    SchemaNormalizer normalizer(recursive);
+    const json result = normalizer.normalize(json{{"child", {{"child", json::object()}}}});
+    EXPECT_EQ(result["name"], "leaf");
+    EXPECT_EQ(result["child"]["child"]["name"], "leaf");
+    EXPECT_FALSE(result["child"]["child"].contains("child"));
+}
+
+}  // namespace test
+}  // namespace core
+}  // namespace configgui
@@ -434,6 +434,333 @@ TEST_F(SchemaValidatorTest, ValidationErrorContainsFieldInfo) {
     }
 }
 
+// Test: validateAll reports every violation with its JSON Pointer in one pass
+TEST_F(SchemaValidatorTest, ValidateAllCollectsEveryError) {
+    json schema = {
+        {"type", "object"},
+        {"properties", {
+            {"name", {{"type", "string"}, {"minLength", 3}}},
+            {"port", {{"type", "integer"}, {"minimum", 1}, {"maximum", 65535}}},
+            {"level", {{"enum", {"debug", "info"}}}},
+            {"server", {
+                {"type", "object"},
+                {"properties", {{"host", {{"type", "string"}, {"pattern", "^[a-z.]+$"}}}}},
+                {"required", {"host", "timeout"}}
+            }}
+        }},
+        {"required", {"name", "email"}}
+    };
+
+    SchemaValidator validator(schema);
+    ASSERT_TRUE(validator.usesCompiledPlan());
+
+    json data = {
+        {"name", "ab"},
+        {"port", 70000},
+        {"level", "trace"},
+        {"server", {{"host", "Bad Host"}}}
+    };
+
+    auto errors = validator.validateAll(data);
+    ASSERT_EQ(errors.size(), 6u);
+
+    auto find = [&errors](const std::string& pointer) -> const ValidationError* {
+        for (const auto& error : errors) {
+            if (error.field() == pointer) {
+                return &error;
+            }
+        }
+        return nullptr;
+    };
+
+    ASSERT_NE(find("/email"), nullptr);
+    EXPECT_EQ(find("/email")->type(), ValidationErrorType::Required);
+    ASSERT_NE(find("/name"), nullptr);
+    EXPECT_EQ(find("/name")->type(), ValidationErrorType::MinLengthViolation);
+    ASSERT_NE(find("/port"), nullptr);
+    EXPECT_EQ(find("/port")->type(), ValidationErrorType::MaximumViolation);
+    ASSERT_NE(find("/level"), nullptr);
+    EXPECT_EQ(find("/level")->type(), ValidationErrorType::EnumViolation);
+    ASSERT_NE(find("/server/host"), nullptr);
+    EXPECT_EQ(find("/server/host")->type(), ValidationErrorType::PatternMismatch);
+    ASSERT_NE(find("/server/timeout"), nullptr);
+    EXPECT_EQ(find("/server/timeout")->type(), ValidationErrorType::Required);
+}
+
+// Test: valid data produces no errors through the handler
+TEST_F(SchemaValidatorTest, ValidateWithHandlerAcceptsValidData) {
+    json schema = {
+        {"type", "object"},
+        {"properties", {
+            {"tags", {{"type", "array"}, {"items", {{"type", "string"}}}, {"maxItems", 3}}},
+            {"ratio", {{"type", "number"}, {"exclusiveMaximum", 1}}}
+        }},
+        {"additionalProperties", false}
+    };
+
+    SchemaValidator validator(schema);
+
+    int calls = 0;
+    bool valid = validator.validate(json{{"tags", {"a", "b"}}, {"ratio", 0.5}},
+                                    [&calls](const ValidationError&) { ++calls; });
+    EXPECT_TRUE(valid);
+    EXPECT_EQ(calls, 0);
+
+    auto errors = validator.validateAll(json{{"tags", {"a", 1}}, {"ratio", 1.0}, {"extra", true}});
+    ASSERT_EQ(errors.size(), 3u);
+    EXPECT_EQ(errors[0].field(), "/tags/1");
+    EXPECT_EQ(errors[0].type(), ValidationErrorType::TypeMismatch);
+    EXPECT_EQ(errors[1].field(), "/ratio");
+    EXPECT_EQ(errors[2].field(), "/extra");
+}
+
+// Test: local $ref targets are compiled into the plan
+TEST_F(SchemaValidatorTest, ValidateAllResolvesLocalRefs) {
+    json schema = {
+        {"definitions", {
+            {"port", {{"type", "integer"}, {"minimum", 1}}}
+        }},
+        {"type", "object"},
+        {"properties", {
+            {"http", {{"$ref", "#/definitions/port"}}},
+            {"https", {{"$ref", "#/definitions/port"}}}
+        }}
+    };
+
+    SchemaValidator validator(schema);
+    ASSERT_TRUE(validator.usesCompiledPlan());
+
+    auto errors = validator.validateAll(json{{"http", 0}, {"https", "443"}});
+    ASSERT_EQ(errors.size(), 2u);
+    EXPECT_EQ(errors[0].type(), ValidationErrorType::MinimumViolation);
+    EXPECT_EQ(errors[1].type(), ValidationErrorType::TypeMismatch);
+}
+
+// Test: cross-field keywords are compiled into the plan
+TEST_F(SchemaValidatorTest, ValidateAllChecksCrossFieldKeywords) {
+    json schema = {
+        {"type", "object"},
+        {"properties", {
+            {"tags", {{"type", "array"}, {"uniqueItems", true}}},
+            {"mode", {{"enum", {"plain", "tls"}}}}
+        }},
+        {"dependencies", {{"username", {"password"}}}},
+        {"if", {{"properties", {{"mode", {{"const", "tls"}}}}}}},
+        {"then", {{"required", {"certificate"}}}}
+    };
+
+    SchemaValidator validator(schema);
+    ASSERT_TRUE(validator.usesCompiledPlan());
+
+    EXPECT_TRUE(validator.validateAll(json{{"tags", {1, "1", {{"a", 1}}}}, {"mode", "plain"}}).empty());
+
+    auto errors = validator.validateAll(json{
+        {"tags", {1, {{"a", 1}, {"b", 2}}, 1.0, {{"b", 2}, {"a", 1}}}},
+        {"username", "admin"},
+        {"mode", "tls"}});
+    ASSERT_EQ(errors.size(), 4u);
+    EXPECT_EQ(errors[0].field(), "/tags/2");
+    EXPECT_EQ(errors[1].field(), "/tags/3");
+    EXPECT_EQ(errors[2].field(), "/password");
+    EXPECT_EQ(errors[2].type(), ValidationErrorType::Required);
+    EXPECT_EQ(errors[3].field(), "/certificate");
+}
+
+// Test: plan patterns search (like std::regex_search) on the linear-time engine
+TEST_F(SchemaValidatorTest, ValidateAllPatternsSearchWithoutBacktracking) {
+    json schema = {
+        {"type", "object"},
+        {"properties", {
+            {"tag", {{"type", "string"}, {"pattern", "b+|x$"}}},
+            {"word", {{"type", "string"}, {"pattern", "^(a+)+$"}}}
+        }}
+    };
+
+    SchemaValidator validator(schema);
+    ASSERT_TRUE(validator.usesCompiledPlan());
+
+    EXPECT_TRUE(validator.validateAll(json{{"tag", "abba"}}).empty());
+    EXPECT_TRUE(validator.validateAll(json{{"tag", "line\nends in x"}}).empty());
+    EXPECT_EQ(validator.validateAll(json{{"tag", "x at start"}}).size(), 1u);
+
+    // Exponential for a backtracking engine; linear here
+    EXPECT_TRUE(validator.validateAll(json{{"word", "aaaa"}}).empty());
+    const auto errors = validator.validateAll(json{{"word", std::string(64, 'a') + "!"}});
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_EQ(errors[0].type(), ValidationErrorType::PatternMismatch);
+
+    // A pattern the search wrapper would balance is still invalid
+    SchemaValidator unbalanced(json{{"properties", {{"a", {{"pattern", "a)(b"}}}}}});
+    EXPECT_FALSE(unbalanced.usesCompiledPlan());
+}
+
+// Test: schemas with keywords the plan does not implement use the library path
+TEST_F(SchemaValidatorTest, ValidateAllFallsBackForUnsupportedKeywords) {
+    json schema = {
+        {"type", "object"},
+        {"properties", {{"remote", {{"$ref", "other.json#/definitions/remote"}}}}},
+        {"patternProperties", {{"^x-", {{"type", "string"}}}}},
+        {"additionalProperties", false}
+    };
+
+    SchemaValidator validator(schema);
+    EXPECT_FALSE(validator.usesCompiledPlan());
+
+    // validateField goes to the library too, so a pattern member is not "not allowed"
+    EXPECT_TRUE(validator.validateField("x-foo", "bar").empty());
+    EXPECT_TRUE(validator.isFieldValid("x-foo", "bar"));
+}
+
+// Test: patternProperties members are described even when additionalProperties is false
+TEST_F(SchemaValidatorTest, ValidateFieldAppliesPatternProperties) {
+    json schema = {
+        {"type", "object"},
+        {"properties", {{"name", {{"type", "string"}}}}},
+        {"patternProperties", {{"^x-", {{"type", "string"}}}}},
+        {"additionalProperties", false}
+    };
+
+    SchemaValidator validator(schema);
+    ASSERT_TRUE(validator.usesCompiledPlan());
+
+    EXPECT_TRUE(validator.validateField("x-foo", "bar").empty());
+    EXPECT_TRUE(validator.isFieldValid("x-foo", "bar"));
+
+    auto errors = validator.validateField("x-foo", 1);
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_EQ(errors[0].field(), "/x-foo");
+    EXPECT_EQ(errors[0].type(), ValidationErrorType::TypeMismatch);
+
+    errors = validator.validateField("other", "bar");
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_EQ(errors[0].field(), "/other");
+    EXPECT_FALSE(validator.isFieldValid("other", "bar"));
+
+    EXPECT_TRUE(validator.validateAll(json{{"name", "a"}, {"x-foo", "b"}}).empty());
+    EXPECT_EQ(validator.validateAll(json{{"x-foo", 1}, {"other", 2}}).size(), 2u);
+}
+
+// Test: propertyNames, contains and additionalItems are compiled into the plan
+TEST_F(SchemaValidatorTest, ValidateAllChecksNameAndItemKeywords) {
+    json schema = {
+        {"type", "object"},
+        {"propertyNames", {{"maxLength", 5}}},
+        {"properties", {
+            {"tags", {{"type", "array"}, {"contains", {{"const", "core"}}}}},
+            {"pair", {{"type", "array"}, {"items", {{{"type", "string"}}, {{"type", "integer"}}}},
+                      {"additionalItems", false}}},
+            {"log", {{"type", "array"}, {"items", {{{"type", "string"}}}},
+                     {"additionalItems", {{"type", "integer"}}}}}
+        }}
+    };
+
+    SchemaValidator validator(schema);
+    ASSERT_TRUE(validator.usesCompiledPlan());
+
+    EXPECT_TRUE(validator.validateAll(json{{"tags", {"ui", "core"}}, {"pair", {"a", 1}}, {"log", {"a", 1, 2}}}).empty());
+
+    auto errors = validator.validateAll(json{{"tags", {"ui"}}, {"pair", {"a", 1, 2}}, {"log", {"a", "b"}}});
+    ASSERT_EQ(errors.size(), 3u);
+    EXPECT_EQ(errors[0].field(), "/tags");
+    EXPECT_EQ(errors[1].field(), "/pair/2");
+    EXPECT_EQ(errors[2].field(), "/log/1");
+    EXPECT_EQ(errors[2].type(), ValidationErrorType::TypeMismatch);
+
+    EXPECT_FALSE(validator.isFieldValid("toolong", 1));
+    EXPECT_TRUE(validator.isFieldValid("/log/4", 4));
+    EXPECT_FALSE(validator.isFieldValid("/log/4", "x"));
+}
+
+// Test: validateField checks only the field's sub-schema
+TEST_F(SchemaValidatorTest, ValidateFieldIgnoresRequiredSiblings) {
+    json schema = {
+        {"type", "object"},
+        {"properties", {
+            {"name", {{"type", "string"}}},
+            {"age", {{"type", "integer"}, {"minimum", 0}}}
+        }},
+        {"required", {"name", "age"}}
+    };
+
+    SchemaValidator validator(schema);
+
+    EXPECT_TRUE(validator.validateField("age", 25).empty());
+
+    auto errors = validator.validateField("age", -1);
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_EQ(errors[0].field(), "/age");
+    EXPECT_EQ(errors[0].type(), ValidationErrorType::MinimumViolation);
+}
+
+// Test: validateField resolves nested pointers, $refs and array elements
+TEST_F(SchemaValidatorTest, ValidateFieldResolvesNestedPaths) {
+    json schema = {
+        {"definitions", {
+            {"host", {{"type", "string"}, {"minLength", 1}}}
+        }},
+        {"type", "object"},
+        {"properties", {
+            {"server", {
+                {"type", "object"},
+                {"properties", {{"host", {{"$ref", "#/definitions/host"}}}}},
+                {"additionalProperties", false}
+            }},
+            {"mirrors", {{"type", "array"}, {"items", {{"$ref", "#/definitions/host"}}}}}
+        }}
+    };
+
+    SchemaValidator validator(schema);
+
+    auto host_errors = validator.validateField("/server/host", "");
+    ASSERT_EQ(host_errors.size(), 1u);
+    EXPECT_EQ(host_errors[0].field(), "/server/host");
+    EXPECT_EQ(host_errors[0].type(), ValidationErrorType::MinLengthViolation);
+
+    auto mirror_errors = validator.validateField("/mirrors/3", 42);
+    ASSERT_EQ(mirror_errors.size(), 1u);
+    EXPECT_EQ(mirror_errors[0].field(), "/mirrors/3");
+    EXPECT_EQ(mirror_errors[0].type(), ValidationErrorType::TypeMismatch);
+
+    auto extra_errors = validator.validateField("/server/port", 80);
+    ASSERT_EQ(extra_errors.size(), 1u);
+    EXPECT_EQ(extra_errors[0].field(), "/server/port");
+
+    // Unknown top-level fields are allowed by default
+    EXPECT_TRUE(validator.validateField("unknown", 1).empty());
+}
+
+// Test: isValid/isFieldValid agree with the error-collecting calls
+TEST_F(SchemaValidatorTest, IsValidMatchesValidateAll) {
+    json schema = {
+        {"type", "object"},
+        {"properties", {
+            {"name", {{"type", "string"}, {"minLength", 1}}},
+            {"ports", {{"type", "array"}, {"items", {{"type", "integer"}, {"maximum", 65535}}}, {"uniqueItems", true}}},
+            {"mode", {{"enum", {"fast", "safe"}}}}
+        }},
+        {"required", {"name"}},
+        {"additionalProperties", false}
+    };
+
+    SchemaValidator validator(schema);
+    ASSERT_TRUE(validator.usesCompiledPlan());
+
+    const std::vector<json> documents = {
+        {{"name", "app"}, {"ports", {80, 443}}, {"mode", "fast"}},
+        {{"name", ""}, {"ports", {80, 70000, 80}}, {"mode", "slow"}, {"extra", 1}},
+        {{"ports", {80, 80}}},
+        json::array()
+    };
+    for (const auto& document : documents) {
+        EXPECT_EQ(validator.isValid(document), validator.validateAll(document).empty()) << document.dump();
+    }
+
+    EXPECT_TRUE(validator.isFieldValid("/ports/1", 8080));
+    EXPECT_FALSE(validator.isFieldValid("/ports/1", 70000));
+    EXPECT_FALSE(validator.isFieldValid("extra", 1));
+    EXPECT_TRUE(validator.isFieldValid("name", "x"));
+}
+
 } // namespace test
 } // namespace core
 } // namespace configgui
@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: MIT
+// Unit tests for ValidationMemo - Core module
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include "core/schema/schema_validator.h"
+#include "core/schema/validation_memo.h"
+#include "core/schema/validation_plan.h"
+
+using json = nlohmann::ordered_json;
+
+namespace configgui {
+namespace core {
+namespace test {
+
+class ValidationMemoTest : public ::testing::Test {
+protected:
+    json schema = {
+        {"type", "object"},
+        {"properties", {
+            {"name", {{"type", "string"}, {"pattern", "^[a-z]+$"}}},
+            {"servers", {
+                {"type", "array"},
+                {"items", {
+                    {"type", "object"},
+                    {"properties", {
+                        {"host", {{"type", "string"}, {"pattern", "^[a-z.]+$"}}},
+                        {"port", {{"type", "integer"}, {"minimum", 1}}}
+                    }},
+                    {"required", {"host"}}
+                }}
+            }}
+        }}
+    };
+
+    static ValidationErrors collect(ValidationMemo& memo, const json& document) {
+        ValidationErrors errors;
+        memo.validate(document, [&errors](const ValidationError& error) { errors.push_back(error); });
+        return errors;
+    }
+
+    static ValidationErrors collect(const ValidationPlan& plan, const json& document) {
+        ValidationErrors errors;
+        plan.validate(document, [&errors](const ValidationError& error) { errors.push_back(error); });
+        return errors;
+    }
+};
+
+// Test: cached results are the plan's results, replayed at the right paths
+TEST_F(ValidationMemoTest, HitsReportTheSameErrors) {
+    ValidationPlan plan(schema);
+    ValidationMemo memo(plan);
+
+    const json document = {
+        {"name", "App"},
+        {"servers", {{{"host", "A"}, {"port", 0}}, {{"host", "b.example"}}, {{"host", "A"}, {"port", 0}}}}
+    };
+    const ValidationErrors expected = collect(plan, document);
+    ASSERT_EQ(expected.size(), 5u);
+
+    EXPECT_EQ(collect(memo, document), expected);
+    const auto first = memo.stats();
+    EXPECT_GT(first.misses, 0u);
+    EXPECT_EQ(first.hits, 1u);  // servers/2 repeats servers/0 under the same node
+
+    EXPECT_EQ(collect(memo, document), expected);
+    const auto second = memo.stats();
+    EXPECT_EQ(second.hits, first.hits + 1);  // The whole document is one lookup
+    EXPECT_EQ(second.misses, first.misses);
+    EXPECT_GT(second.hitRate(), 0.0);
+}
+
+// Test: after an edit, unchanged siblings are lookups
+TEST_F(ValidationMemoTest, UnchangedSubtreesAreLookups) {
+    ValidationPlan plan(schema);
+    ValidationMemo memo(plan);
+
+    json document = {{"name", "app"}, {"servers", json::array()}};
+    for (int i = 0; i < 10; ++i) {
+        document["servers"].push_back({{"host", "h.example"}, {"port", 1000 + i}});
+    }
+    EXPECT_TRUE(collect(memo, document).empty());
+
+    document["servers"][3]["port"] = 0;
+    const auto before = memo.stats();
+    const auto errors = collect(memo, document);
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_EQ(errors[0].field(), "/servers/3/port");
+
+    const auto after = memo.stats();
+    EXPECT_EQ(after.misses - before.misses, 3u);   // Document, servers array, servers/3
+    EXPECT_EQ(after.hits - before.hits, 11u);      // Nine other servers, servers/3/host and the name
+}
+
+// Test: isValid stops at cached valid subtrees, and a valid verdict serves full validation too
+TEST_F(ValidationMemoTest, IsValidSharesVerdicts) {
+    ValidationPlan plan(schema);
+    ValidationMemo memo(plan);
+
+    json document = {{"name", "app"}, {"servers", json::array()}};
+    for (int i = 0; i < 10; ++i) {
+        document["servers"].push_back({{"host", "h.example"}, {"port", 1000 + i}});
+    }
+    EXPECT_TRUE(memo.isValid(document));
+
+    // Found valid silently, so its (empty) error list is complete: one lookup
+    const auto before = memo.stats();
+    EXPECT_TRUE(collect(memo, document).empty());
+    EXPECT_EQ(memo.stats().hits - before.hits, 1u);
+    EXPECT_EQ(memo.stats().misses, before.misses);
+
+    // A failed silent check is not reused for reporting
+    document["servers"][3]["port"] = 0;
+    EXPECT_FALSE(memo.isValid(document));
+    const auto errors = collect(memo, document);
+    ASSERT_EQ(errors.size(), 1u);
+    EXPECT_EQ(errors[0].field(), "/servers/3/port");
+}
+
+// Test: values that compare equal but report differently are cached separately
+TEST_F(ValidationMemoTest, KeysDistinguishNumberRepresentations) {
+    json numbers = {{"type", "array"}, {"items", {{"type", "object"}, {"properties", {{"v", {{"minimum", 5}}}}}}}};
+    ValidationPlan plan(numbers);
+    ValidationMemo memo(plan);
+
+    const json document = json::array({json{{"v", 1}}, json{{"v", 1.0}}});
+    const auto errors = collect(memo, document);
+    EXPECT_EQ(errors, collect(plan, document));
+    ASSERT_EQ(errors.size(), 2u);
+    EXPECT_NE(errors[0].message(), errors[1].message());
+}
+
+// Test: the memory budget is respected by evicting old entries
+TEST_F(ValidationMemoTest, MemoryIsBounded) {
+    ValidationPlan plan(schema);
+    constexpr std::size_t kBudget = 16 * 1024;
+    ValidationMemo memo(plan, kBudget);
+
+    for (int i = 0; i < 200; ++i) {
+        json document = {{"servers", {{{"host", "h" + std::to_string(i)}, {"port", i}}}}};
+        collect(memo, document);
+        EXPECT_LE(memo.stats().bytes, kBudget);
+    }
+    const auto stats = memo.stats();
+    EXPECT_GT(stats.evictions, 0u);
+    EXPECT_GT(stats.entries, 0u);
+
+    memo.clear();
+    EXPECT_EQ(memo.stats().entries, 0u);
+    EXPECT_EQ(memo.stats().bytes, 0u);
+}
+
+// Test: SchemaValidator routes validateAll and validateField through the memo
+TEST_F(ValidationMemoTest, SchemaValidatorReportsHitRate) {
+    SchemaValidator validator(schema);
+    ASSERT_TRUE(validator.usesCompiledPlan());
+    EXPECT_EQ(validator.memoStats().hits + validator.memoStats().misses, 0u);
+
+    validator.setMemoization();
+    const json document = {{"name", "app"}, {"servers", {{{"host", "x"}, {"port", 0}}}}};
+    const auto first = validator.validateAll(document);
+    const auto second = validator.validateAll(document);
+    EXPECT_EQ(first, second);
+    ASSERT_EQ(second.size(), 1u);
+
+    const auto field_errors = validator.validateField("/servers", document["servers"]);
+    ASSERT_EQ(field_errors.size(), 1u);
+    EXPECT_EQ(field_errors[0].field(), "/servers/0/port");
+
+    const auto stats = validator.memoStats();
+    EXPECT_EQ(stats.hits, 2u);
+    EXPECT_DOUBLE_EQ(stats.hitRate(), 2.0 / static_cast<double>(stats.hits + stats.misses));
+
+    validator.setMemoization(0);
+    EXPECT_EQ(validator.memoStats().entries, 0u);
+    EXPECT_EQ(validator.validateAll(document), first);
+}
+
+} // namespace test
+} // namespace core
+} // namespace configgui
@@ -287,3 +287,27 @@ TEST_F(SchemaServiceTest, UninitializedServiceMethods) {
     EXPECT_EQ(service.getSchemaCount(), 0);
     EXPECT_EQ(service.getSchemaDir(), "");
 }
+
+// Test: normalized config keeps member order (no round trip through sorted json)
+TEST_F(SchemaServiceTest, NormalizeConfigKeepsMemberOrder) {
+    createJsonSchema("order.schema.json", json::parse(R"({
+        "type": "object",
+        "properties": {
+            "zeta": {"type": "integer"},
+            "alpha": {"type": "integer", "default": 1}
+        }
+    })"));
+
+    SchemaService service;
+    ASSERT_TRUE(service.initialize(schemaDir));
+    const auto result = service.normalizeConfig("order.schema", R"({"zeta": "5", "mid": true})", false);
+    ASSERT_FALSE(result.contains("error")) << result.dump();
+
+    std::vector<std::string> keys;
+    for (const auto& member : result["config"].items()) {
+        keys.push_back(member.key());
+    }
+    EXPECT_EQ(keys, (std::vector<std::string>{"zeta", "mid", "alpha"}));
+    EXPECT_EQ(result["config"]["zeta"], 5);
+    EXPECT_EQ(result["stats"]["defaultsFilled"], 1);
+}
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: MIT
+// Batch Validation Unit Tests
+
+#include <gtest/gtest.h>
+#include "src/validators/range_validator.h"
+#include "src/validators/type_validator.h"
+#include "src/validators/validator_program.h"
+#include <vector>
+
+using namespace configgui::validators;
+
+namespace
+{
+
+/// Errors of one value, in order, as (code, message) pairs
+std::vector<std::pair<std::string, std::string>> errorsAt(const BatchErrors& errors, size_t index)
+{
+    std::vector<std::pair<std::string, std::string>> found;
+    for (size_t i = 0; i < errors.size(); ++i)
+    {
+        if (errors.index(i) == index)
+        {
+            found.emplace_back(errors.error(i).code(), errors.error(i).message());
+        }
+    }
+    return found;
+}
+
+std::vector<std::pair<std::string, std::string>> errorsOf(const ValidationResult& result)
+{
+    std::vector<std::pair<std::string, std::string>> found;
+    for (const auto& error : result.errors)
+    {
+        found.emplace_back(error.code(), error.message());
+    }
+    return found;
+}
+
+} // namespace
+
+TEST(BatchValidationTest, RangeBatchMatchesPerValueValidation)
+{
+    const json values = json::array({-1, 0, 0.5, 10, 10.01, 99, 100, 1e9, -1e9, 42u});
+    const std::vector<json> schemas = {
+        {{"minimum", 0}, {"maximum", 100}},
+        {{"minimum", 0}, {"exclusiveMinimum", true}, {"maximum", 100}, {"exclusiveMaximum", true}},
+        {{"minimum", 10}},
+        {{"maximum", 10}, {"exclusiveMaximum", true}},
+        {{"type", "number"}},
+    };
+
+    RangeValidator validator;
+    BatchErrors errors;
+    for (const auto& schema : schemas)
+    {
+        errors.clear();
+        size_t expected_failed = 0;
+        const size_t failed = validator.validateBatch(ValueSpan::of(values), schema, errors);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            const auto expected = validator.validate(values[i], schema);
+            expected_failed += expected.is_valid ? 0 : 1;
+            EXPECT_EQ(errorsAt(errors, i), errorsOf(expected)) << schema.dump() << " value " << values[i].dump();
+        }
+        EXPECT_EQ(failed, expected_failed) << schema.dump();
+    }
+}
+
+TEST(BatchValidationTest, MixedBatchFallsBackToPerValueValidation)
+{
+    const json values = json::array({5, "ab", "abcdef", 50});
+    const json schema = {{"minimum", 10}, {"minLength", 3}};
+
+    RangeValidator validator;
+    BatchErrors errors;
+    EXPECT_EQ(validator.validateBatch(ValueSpan::of(values), schema, errors), 2u);
+    ASSERT_EQ(errors.size(), 2u);
+    EXPECT_EQ(errors.index(0), 0u);
+    EXPECT_EQ(errors.error(0).error_code, "BELOW_MINIMUM");
+    EXPECT_EQ(errors.index(1), 1u);
+    EXPECT_EQ(errors.error(1).error_code, "STRING_TOO_SHORT");
+
+    // Validators without their own batch path use the default loop
+    TypeValidator type_validator;
+    errors.clear();
+    EXPECT_EQ(type_validator.validateBatch(ValueSpan::of(values), {{"type", "string"}}, errors), 2u);
+    EXPECT_EQ(errors.index(0), 0u);
+    EXPECT_EQ(errors.index(1), 3u);
+}
+
+TEST(BatchValidationTest, ProgramBatchMatchesRun)
+{
+    const std::vector<json> batches = {
+        json::array({1, 2, 3, 2.5, -4, 70000, 65535u, 0}),
+        json::array({1, "x", nullptr, 3.5, json::object()}),
+    };
+    const std::vector<json> schemas = {
+        {{"type", "integer"}, {"minimum", 1}, {"maximum", 65535}},
+        {{"type", "number"}, {"minimum", 0}, {"exclusiveMinimum", true}},
+        {{"type", "string"}},
+        {{"type", "integer"}},
+        {{"minimum", 2}, {"minLength", 1}},
+        {{"enum", json::array({1, 2, 3})}},
+        json::object(),
+    };
+
+    BatchErrors errors;
+    for (const auto& schema : schemas)
+    {
+        const auto program = ValidatorProgram::compile(schema);
+        for (const auto& batch : batches)
+        {
+            errors.clear();
+            size_t expected_failed = 0;
+            const size_t failed = program.runBatch(ValueSpan::of(batch), errors);
+            for (size_t i = 0; i < batch.size(); ++i)
+            {
+                const auto expected = program.run(batch[i]);
+                expected_failed += expected.is_valid ? 0 : 1;
+                EXPECT_EQ(errorsAt(errors, i), errorsOf(expected)) << schema.dump() << " value " << batch[i].dump();
+            }
+            EXPECT_EQ(failed, expected_failed) << schema.dump() << " " << batch.dump();
+        }
+    }
+}
+
+TEST(BatchValidationTest, ErrorBufferIsReusedAcrossBatches)
+{
+    const auto program = ValidatorProgram::compile({{"minimum", 0}, {"maximum", 10}});
+    json values = json::array();
+    for (int i = 0; i < 64; ++i)
+    {
+        values.push_back(i % 2 == 0 ? -i - 1 : i + 100);
+    }
+
+    BatchErrors errors;
+    EXPECT_EQ(program.runBatch(ValueSpan::of(values), errors), 64u);
+    ASSERT_EQ(errors.size(), 64u);
+
+    errors.clear();
+    EXPECT_TRUE(errors.empty());
+    EXPECT_EQ(program.runBatch(ValueSpan::of(values), errors), 64u);
+    EXPECT_EQ(errors.error(0).error_code, "BELOW_MINIMUM");
+    EXPECT_EQ(errors.error(1).error_code, "ABOVE_MAXIMUM");
+    EXPECT_EQ(errors.index(63), 63u);
+
+    // Empty spans and non-arrays validate nothing
+    errors.clear();
+    EXPECT_EQ(program.runBatch(ValueSpan::of(json::array()), errors), 0u);
+    EXPECT_EQ(program.runBatch(ValueSpan::of(json(5)), errors), 0u);
+    EXPECT_TRUE(errors.empty());
+}
+
+TEST(BatchValidationTest, FlagOutOfRangeReportsMinimumFirst)
+{
+    NumericBounds bounds;
+    bounds.has_minimum = true;
+    bounds.minimum = 10.0;
+    bounds.has_maximum = true;
+    bounds.maximum = 5.0;  // Contradictory: every value fails one side or both
+
+    const double values[] = {1.0, 7.0, 12.0};
+    std::uint8_t flags[3] = {};
+    EXPECT_EQ(RangeValidator::flagOutOfRange(values, 3, bounds, flags), 3u);
+    EXPECT_EQ(flags[0], RangeValidator::kBelowMinimum);
+    EXPECT_EQ(flags[1], RangeValidator::kBelowMinimum);
+    EXPECT_EQ(flags[2], RangeValidator::kAboveMaximum);
+}
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: MIT
+// Enum Index Unit Tests
+
+#include <gtest/gtest.h>
+#include "src/validators/enum_index.h"
+#include "src/validators/enum_validator.h"
+#include <string>
+
+using namespace configgui::validators;
+
+class EnumIndexTest : public ::testing::Test
+{
+};
+
+// ========== Lookup Tests ==========
+
+TEST_F(EnumIndexTest, TypedLookups)
+{
+    EnumIndex index(json::array({"dev", "prod", 7, 2.5, false, nullptr, json::array({1, 2}), {{"k", "v"}}}));
+
+    EXPECT_TRUE(index.contains("dev"));
+    EXPECT_FALSE(index.contains("DEV"));
+    EXPECT_TRUE(index.contains(7));
+    EXPECT_TRUE(index.contains(2.5));
+    EXPECT_FALSE(index.contains(true));
+    EXPECT_TRUE(index.contains(false));
+    EXPECT_TRUE(index.contains(nullptr));
+    EXPECT_TRUE(index.contains(json::array({1, 2})));
+    EXPECT_FALSE(index.contains(json::array({2, 1})));
+    EXPECT_TRUE(index.contains({{"k", "v"}}));
+    EXPECT_FALSE(index.contains("7"));
+    EXPECT_EQ(index.size(), 8u);
+}
+
+TEST_F(EnumIndexTest, NumbersMatchByValue)
+{
+    // Same as json ==: 3, 3u and 3.0 are one value
+    EnumIndex index(json::array({3, 4.0, json(18446744073709551615u)}));
+
+    EXPECT_TRUE(index.contains(3.0));
+    EXPECT_TRUE(index.contains(json(3u)));
+    EXPECT_TRUE(index.contains(4));
+    EXPECT_TRUE(index.contains(json(18446744073709551615u)));
+    EXPECT_FALSE(index.contains(3.5));
+    EXPECT_FALSE(index.contains(-3));
+}
+
+TEST_F(EnumIndexTest, LargeEnum)
+{
+    json codes = json::array();
+    for (int i = 0; i < 10000; ++i)
+    {
+        codes.push_back("SKU-" + std::to_string(i));
+    }
+    EnumIndex index(codes);
+
+    EXPECT_TRUE(index.contains("SKU-0"));
+    EXPECT_TRUE(index.contains("SKU-9999"));
+    EXPECT_FALSE(index.contains("SKU-10000"));
+}
+
+TEST_F(EnumIndexTest, ErrorMessageListsEntriesOnce)
+{
+    EnumIndex index(json::array({"a", 1, true, nullptr}));
+
+    const std::string& message = index.errorMessage();
+    EXPECT_EQ(message, "Value must be one of: \"a\", 1, true, null");
+    EXPECT_EQ(&index.errorMessage(), &message);
+}
+
+// ========== Bound EnumValidator Tests ==========
+
+TEST_F(EnumIndexTest, BoundValidatorUsesIndex)
+{
+    const json schema = {{"enum", json::array({"dev", "staging", "prod"})}};
+    EnumValidator validator(schema);
+    ASSERT_TRUE(validator.isBound());
+
+    EXPECT_TRUE(validator.validate("prod", schema).is_valid);
+    EXPECT_FALSE(validator.isValid("qa", schema));
+
+    const auto result = validator.validate("x", schema);
+    ASSERT_EQ(result.errors.size(), 1u);
+    EXPECT_EQ(result.errors[0].error_code, "ENUM_MISMATCH");
+    EXPECT_EQ(result.errors[0].message(), "Value must be one of: \"dev\", \"staging\", \"prod\"");
+
+    // Another schema is scanned, not looked up in the bound index
+    const json other = {{"enum", json::array({"qa", 1})}};
+    EXPECT_TRUE(validator.isValid("qa", other));
+    EXPECT_FALSE(validator.isValid("prod", other));
+    EXPECT_EQ(validator.validate("prod", other).errors[0].message(), "Value must be one of: \"qa\", 1");
+}
+
+TEST_F(EnumIndexTest, UnboundValidatorScans)
+{
+    EnumValidator validator;
+    EXPECT_FALSE(validator.isBound());
+
+    json schema = {{"enum", json::array({"a", 2})}};
+    EXPECT_TRUE(validator.isValid(2.0, schema));
+    EXPECT_FALSE(validator.isValid("b", schema));
+
+    // No snapshot: in-place edits are seen
+    schema["enum"][1] = "b";
+    EXPECT_TRUE(validator.isValid("b", schema));
+}
+
+TEST_F(EnumIndexTest, BoundValidatorIsASnapshot)
+{
+    json schema = {{"enum", json::array()}};
+    for (int i = 0; i < 1000; ++i)
+    {
+        schema["enum"].push_back("value_" + std::to_string(i));
+    }
+    EnumValidator validator(schema);
+    EXPECT_TRUE(validator.isValid("value_501", schema));
+
+    // A resized array is not looked up in the stale index
+    schema["enum"].push_back("appended");
+    EXPECT_TRUE(validator.isValid("appended", schema));
+
+    // Same-size edits need a new binding
+    schema["enum"][501] = "edited";
+    EnumValidator rebound(schema);
+    EXPECT_FALSE(rebound.isValid("value_501", schema));
+    EXPECT_TRUE(rebound.isValid("edited", schema));
+}
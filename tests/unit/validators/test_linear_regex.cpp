@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: MIT
+// Linear Regex Unit Tests
+
+#include <gtest/gtest.h>
+#include "src/validators/linear_regex.h"
+#include "src/validators/pattern_validator.h"
+#include <chrono>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace configgui::validators;
+
+class LinearRegexTest : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        PatternValidator::setRegexBackend(RegexBackend::Linear);
+    }
+
+    /// Results must agree with std::regex_match on every input
+    void expectSameAsStd(const std::string& pattern, const std::vector<std::string>& inputs)
+    {
+        const auto linear = LinearRegex::compile(pattern);
+        ASSERT_NE(linear, nullptr) << pattern;
+        const std::regex reference(pattern);
+        for (const auto& input : inputs)
+        {
+            EXPECT_EQ(linear->fullMatch(input), std::regex_match(input, reference))
+                << "pattern " << pattern << " input \"" << input << "\"";
+        }
+    }
+};
+
+// ========== Agreement With std::regex ==========
+
+TEST_F(LinearRegexTest, MatchesStdRegexOnSchemaPatterns)
+{
+    const std::vector<std::string> inputs = {
+        "", "a", "ab", "abc", "Abc", "hello", "hello world", "x_1", "1x", "192.168.0.1", "256.1.1.1",
+        "user@example.com", "bad@", "v1.2.3", "1.2", "a\nb", "a\rb", "\t", "-", "a-b", "aaaa", "abab",
+        "ABC-123", "foo.bar", "foobar", "{}", "a.b.c", "0x1F", "2024-01-31", "aaaaaaaaab"
+    };
+    const std::vector<std::string> patterns = {
+        "^[A-Z][a-z]*$", "[a-z_][a-z0-9_]*", "\\d+(\\.\\d+){3}", "^(\\d{1,3}\\.){3}\\d{1,3}$",
+        "[^@\\s]+@[^@\\s]+\\.[a-z]{2,}", "v?\\d+\\.\\d+(\\.\\d+)?", "a.b", ".*", ".+", "a|ab|abc",
+        "(a|b)*", "(ab)+", "a{2,3}", "a{2,}", "a{0}", "a*?b", "(?:foo|bar)(\\.baz)?", "[\\w-]+",
+        "\\s*\\S+\\s*", "[\\-a]+", "[a-]+", "[.]+", "\\.", "\\{\\}", "0x[0-9A-Fa-f]+",
+        "\\d{4}-\\d{2}-\\d{2}", "(a+)+b", "^$", "a$|b", "^a|b$", "(^a)(b$)", "\\x41\\u0062c", "[^a-z]*",
+        "a\\nb|a\\rb", "\\t", "foo\\b.*", ".*\\bbar", "\\Bb\\B", "\\b", "x?\\b"
+    };
+    for (const auto& pattern : patterns)
+    {
+        expectSameAsStd(pattern, inputs);
+    }
+}
+
+TEST_F(LinearRegexTest, MatchesStdRegexOnGeneratedInputs)
+{
+    // Every string over {a, b, -} up to length 6 against patterns with nested repetition
+    std::vector<std::string> inputs = {""};
+    for (std::size_t begin = 0, length = 0; length < 6; ++length)
+    {
+        const std::size_t end = inputs.size();
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            for (const char c : {'a', 'b', '-'})
+            {
+                inputs.push_back(inputs[i] + c);
+            }
+        }
+        begin = end;
+    }
+
+    for (const std::string pattern : {"(a|ab)(c|bcd)?(d*)", "(a*b?)*-?", "((a|b)-)*[ab]?", "(a+|b+)*-b{1,2}",
+                                      "\\ba+\\b-?b*", "[ab]{2,4}(-[ab])?"})
+    {
+        expectSameAsStd(pattern, inputs);
+    }
+}
+
+// ========== Engine Selection ==========
+
+TEST_F(LinearRegexTest, LeavesUnsupportedPatternsToStdRegex)
+{
+    for (const std::string pattern : {"(a)\\1", "a(?=b)", "a(?!b)", "[[:alpha:]]+", "\\u00e9", "\\cA", "a{2000}",
+                                      "a**", "*a", "(a", "a)"})
+    {
+        EXPECT_EQ(LinearRegex::compile(pattern), nullptr) << pattern;
+    }
+
+    EXPECT_STREQ(CompiledRegex::compile("(a)\\1", RegexBackend::Linear)->engine(), "std");
+    EXPECT_STREQ(CompiledRegex::compile("[a-z]+", RegexBackend::Linear)->engine(), "linear");
+    EXPECT_STREQ(CompiledRegex::compile("[a-z]+", RegexBackend::Std)->engine(), "std");
+    EXPECT_TRUE(CompiledRegex::compile("(ab)\\1", RegexBackend::Linear)->fullMatch("abab"));
+}
+
+TEST_F(LinearRegexTest, UsesDfaUnlessPatternNeedsWordBoundaries)
+{
+    EXPECT_TRUE(LinearRegex::compile("^[a-z]+(\\.[a-z]+)*$")->usesDfa());
+    EXPECT_FALSE(LinearRegex::compile("\\bfoo\\b")->usesDfa());
+}
+
+// ========== ReDoS Regression ==========
+
+TEST_F(LinearRegexTest, CatastrophicPatternsRunInLinearTime)
+{
+    // std::regex backtracks exponentially on these; 2^5000 steps would never finish
+    const std::string attack = std::string(5000, 'a') + "!";
+    PatternValidator validator;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const std::string pattern : {"(a+)+$", "(a|aa)+$", "(a|a?)+$", "(\\w+\\s?)*$", "^(a+)+b$"})
+    {
+        const auto result = validator.validate(attack, {{"pattern", pattern}});
+        EXPECT_FALSE(result.is_valid) << pattern;
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_LT(std::chrono::duration_cast<std::chrono::seconds>(elapsed).count(), 5);
+}
+
+TEST_F(LinearRegexTest, BackendSwitchRecompilesPatterns)
+{
+    PatternValidator validator;
+    EXPECT_TRUE(validator.validate("abc", {{"pattern", "[a-c]+"}}).is_valid);
+    EXPECT_STREQ(PatternValidator::getCachedRegex("[a-c]+")->engine(), "linear");
+
+    PatternValidator::setRegexBackend(RegexBackend::Std);
+    EXPECT_EQ(PatternValidator::getRegexBackend(), RegexBackend::Std);
+    EXPECT_STREQ(PatternValidator::getCachedRegex("[a-c]+")->engine(), "std");
+    EXPECT_FALSE(validator.validate("abd", {{"pattern", "[a-c]+"}}).is_valid);
+}
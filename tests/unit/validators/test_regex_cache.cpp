@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: MIT
+// Regex Cache Unit Tests
+
+#include <gtest/gtest.h>
+#include "src/validators/regex_cache.h"
+#include "src/validators/pattern_validator.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace configgui::validators;
+
+class RegexCacheTest : public ::testing::Test
+{
+protected:
+    void TearDown() override
+    {
+        PatternValidator::setCacheCapacity(RegexCache::kDefaultCapacity);
+        PatternValidator::clearCache();
+    }
+};
+
+// ========== Counting Tests ==========
+
+TEST_F(RegexCacheTest, CountsHitsAndMisses)
+{
+    RegexCache cache;
+    const auto first = cache.get("[a-z]+", RegexBackend::Linear);
+    const auto second = cache.get("[a-z]+", RegexBackend::Linear);
+    (void)cache.get("[0-9]+", RegexBackend::Linear);
+
+    EXPECT_EQ(first, second);
+    const auto stats = cache.stats();
+    EXPECT_EQ(stats.entries, 2u);
+    EXPECT_EQ(stats.misses, 2u);
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.lookups, 3u);
+    EXPECT_DOUBLE_EQ(stats.hitRate(), 1.0 / 3.0);
+}
+
+TEST_F(RegexCacheTest, KeysIncludeBackend)
+{
+    RegexCache cache;
+    EXPECT_STREQ(cache.get("a+", RegexBackend::Linear)->engine(), "linear");
+    EXPECT_STREQ(cache.get("a+", RegexBackend::Std)->engine(), "std");
+    EXPECT_STREQ(cache.get("a+", RegexBackend::Linear)->engine(), "linear");
+}
+
+TEST_F(RegexCacheTest, ClearResetsEntriesAndCounters)
+{
+    RegexCache cache;
+    const auto before = cache.get("x", RegexBackend::Linear);
+    cache.clear();
+
+    EXPECT_EQ(cache.stats().entries, 0u);
+    EXPECT_EQ(cache.stats().lookups, 0u);
+    EXPECT_NE(cache.get("x", RegexBackend::Linear), before);  // Snapshots retired too
+    EXPECT_EQ(cache.stats().misses, 1u);
+}
+
+// ========== Bound Tests ==========
+
+TEST_F(RegexCacheTest, StaysWithinCapacity)
+{
+    RegexCache cache(RegexCache::kShardCount * 2);
+    for (int i = 0; i < 1000; ++i)
+    {
+        (void)cache.get("pattern_" + std::to_string(i), RegexBackend::Linear);
+    }
+
+    const auto stats = cache.stats();
+    EXPECT_EQ(stats.capacity, RegexCache::kShardCount * 2);
+    EXPECT_LE(stats.entries, stats.capacity);
+    EXPECT_EQ(stats.misses, 1000u);
+    EXPECT_EQ(stats.evictions, 1000u - stats.entries);
+
+    cache.setCapacity(1);
+    EXPECT_LE(cache.stats().entries, RegexCache::kShardCount);
+}
+
+TEST_F(RegexCacheTest, PatternValidatorUsesBoundedCache)
+{
+    PatternValidator validator;
+    PatternValidator::clearCache();
+    PatternValidator::setCacheCapacity(RegexCache::kShardCount);
+
+    for (int i = 0; i < 200; ++i)
+    {
+        const std::string pattern = "user_" + std::to_string(i) + "[0-9]*";
+        EXPECT_TRUE(validator.validate("user_" + std::to_string(i) + "42", {{"pattern", pattern}}).is_valid);
+    }
+
+    const auto stats = PatternValidator::getCacheStats();
+    EXPECT_LE(stats.entries, RegexCache::kShardCount);
+    EXPECT_EQ(stats.misses, 200u);
+    EXPECT_GT(stats.evictions, 0u);
+}
+
+// ========== Concurrency Tests ==========
+
+TEST_F(RegexCacheTest, ConcurrentLookupsAreCountedExactly)
+{
+    RegexCache cache(64);
+    constexpr int kThreads = 4;
+    constexpr int kLookups = 5000;
+    std::atomic<int> mismatches{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back([&cache, &mismatches, t]() {
+            for (int i = 0; i < kLookups; ++i)
+            {
+                // A shared hot set plus a few patterns private to each thread
+                const std::string pattern = (i % 4 == 0) ? "t" + std::to_string(t) + "_" + std::to_string(i % 100)
+                                                         : "hot_" + std::to_string(i % 8) + "[a-z]*";
+                const auto regex = cache.get(pattern, RegexBackend::Linear);
+                const std::string probe = (i % 4 == 0) ? pattern : "hot_" + std::to_string(i % 8) + "abc";
+                if (!regex->fullMatch(probe))
+                {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    const auto stats = cache.stats();
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_EQ(stats.lookups, static_cast<uint64_t>(kThreads * kLookups));
+    EXPECT_LE(stats.entries, stats.capacity);
+}
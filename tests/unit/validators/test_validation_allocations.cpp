@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: MIT
+// Validation Allocation Unit Tests
+//
+// Replaces the global allocation functions to count heap allocations made
+// by the validators, and checks that validating a valid value makes none.
+
+#include <gtest/gtest.h>
+#include "src/validators/enum_validator.h"
+#include "src/validators/pattern_validator.h"
+#include "src/validators/range_validator.h"
+#include "src/validators/required_validator.h"
+#include "src/validators/type_validator.h"
+#include "src/validators/validator_program.h"
+#include <cstdlib>
+#include <new>
+
+#if defined(__GNUC__) && !defined(__clang__)
+// The replacements below pair malloc/free, which GCC cannot see through once inlined
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+namespace
+{
+
+thread_local bool t_counting = false;
+thread_local size_t t_allocations = 0;
+
+/// Heap allocations made by this thread while running fn
+template <typename Fn>
+size_t countAllocations(Fn&& fn)
+{
+    t_allocations = 0;
+    t_counting = true;
+    fn();
+    t_counting = false;
+    return t_allocations;
+}
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    if (t_counting)
+    {
+        ++t_allocations;
+    }
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+using namespace configgui::validators;
+
+class ValidationAllocationTest : public ::testing::Test
+{
+protected:
+    json schema_ = {
+        {"type", "object"},
+        {"required", json::array({"host", "port", "environment"})},
+    };
+    json port_schema_ = {{"type", "integer"}, {"minimum", 1}, {"maximum", 65535}, {"exclusiveMaximum", false}};
+    json name_schema_ = {{"type", "string"}, {"minLength", 3}, {"maxLength", 64}, {"pattern", "^[a-z][a-z0-9_-]*$"}};
+    json env_schema_ = {{"type", "string"}, {"enum", json::array({"development", "staging", "production"})}};
+    json config_ = {{"host", "db-primary.internal.example.com"}, {"port", 5432}, {"environment", "production"}};
+};
+
+TEST_F(ValidationAllocationTest, ValidatorsDoNotAllocateOnSuccess)
+{
+    TypeValidator type;
+    RangeValidator range;
+    EnumValidator enums;
+    PatternValidator pattern;
+    RequiredValidator required;
+    const json port = 5432;
+    const json name = "db_primary_replica_01";
+    const json env = "production";
+    const json nullable_schema = {{"type", json::array({"null", "string"})}};
+
+    auto validateAll = [&]() {
+        bool valid = true;
+        valid &= type.validate(config_, schema_).is_valid;
+        valid &= required.validate(config_, schema_).is_valid;
+        valid &= type.validate(port, port_schema_).is_valid;
+        valid &= range.validate(port, port_schema_).is_valid;
+        valid &= range.validate(name, name_schema_).is_valid;
+        valid &= pattern.validate(name, name_schema_).is_valid;
+        valid &= enums.validate(env, env_schema_).is_valid;
+        valid &= type.validate(env, nullable_schema).is_valid;
+        return valid;
+    };
+
+    ASSERT_TRUE(validateAll());  // Warm the regex and enum caches
+    bool valid = false;
+    EXPECT_EQ(countAllocations([&]() { valid = validateAll(); }), 0u);
+    EXPECT_TRUE(valid);
+}
+
+TEST_F(ValidationAllocationTest, ProgramDoesNotAllocateOnSuccessOrSingleErrors)
+{
+    const auto object_program = ValidatorProgram::compile(schema_);
+    const auto port_program = ValidatorProgram::compile(port_schema_);
+    const auto name_program = ValidatorProgram::compile(name_schema_);
+    const auto env_program = ValidatorProgram::compile(env_schema_);
+    const json port = 5432;
+    const json bad_port = 70000;
+    const json name = "db_primary_replica_01";
+    const json env = "production";
+    const json bad_env = "qa";
+
+    size_t errors = 0;
+    EXPECT_EQ(countAllocations([&]() {
+                  errors += object_program.run(config_).errors.size();
+                  errors += port_program.run(port).errors.size();
+                  errors += name_program.run(name).errors.size();
+                  errors += env_program.run(env).errors.size();
+              }),
+              0u);
+    EXPECT_EQ(errors, 0u);
+
+    // Errors carry codes and shared schema text, so reporting them is free too
+    EXPECT_EQ(countAllocations([&]() {
+                  errors += port_program.run(bad_port).errors.size();
+                  errors += env_program.run(bad_env).errors.size();
+                  errors += port_program.run(bad_env).errors.size();
+              }),
+              0u);
+    EXPECT_EQ(errors, 3u);
+}
+
+TEST_F(ValidationAllocationTest, BatchErrorBufferIsReused)
+{
+    const auto program = ValidatorProgram::compile(port_schema_);
+    const json values = json::array({80, 0, 443, 70000, 8080, -1});
+
+    BatchErrors errors;
+    program.runBatch(ValueSpan::of(values), errors);  // Sizes the buffer and the scratch space
+    ASSERT_EQ(errors.size(), 3u);
+
+    EXPECT_EQ(countAllocations([&]() {
+                  errors.clear();
+                  program.runBatch(ValueSpan::of(values), errors);
+              }),
+              0u);
+    EXPECT_EQ(errors.size(), 3u);
+}
+
+TEST_F(ValidationAllocationTest, MessagesAreFormattedOnDemand)
+{
+    const auto port_program = ValidatorProgram::compile(port_schema_);
+    const auto name_program = ValidatorProgram::compile(name_schema_);
+
+    auto result = port_program.run(0);
+    ASSERT_EQ(result.errors.size(), 1u);
+    EXPECT_EQ(result.errors[0].error_code, ErrorCode::BelowMinimum);
+    EXPECT_EQ(result.errors[0].error_code, "BELOW_MINIMUM");
+    EXPECT_EQ(result.errors[0].message(), "Value must be at least 1.00");
+
+    result = port_program.run("8080");
+    ASSERT_EQ(result.errors.size(), 1u);
+    EXPECT_EQ(result.errors[0].message(), "Expected type 'integer' but got 'string'");
+
+    result = name_program.run("X");
+    ASSERT_EQ(result.errors.size(), 2u);
+    EXPECT_EQ(result.errors[0].message(), "String must be at least 3 characters");
+    EXPECT_EQ(result.errors[1].message(), "String does not match pattern: ^[a-z][a-z0-9_-]*$");
+
+    const auto missing = ValidatorProgram::compile(schema_).run(json::object());
+    ASSERT_EQ(missing.errors.size(), 3u);
+    EXPECT_EQ(missing.errors[2].field, "environment");
+    EXPECT_EQ(missing.errors[2].message(), "Field 'environment' is required");
+}
+
+TEST_F(ValidationAllocationTest, ErrorListSpillsPastInlineCapacity)
+{
+    ErrorList errors;
+    const char* keys[] = {"a", "b", "c", "d", "e"};
+    for (const char* key : keys)
+    {
+        errors.push_back(ValidationError::requiredFieldMissing(key));
+    }
+
+    ASSERT_EQ(errors.size(), 5u);
+    size_t i = 0;
+    for (const auto& error : errors)
+    {
+        EXPECT_EQ(error.field, keys[i++]);
+        EXPECT_EQ(error.error_code, ErrorCode::RequiredFieldMissing);
+    }
+
+    const ErrorList copy = errors;
+    EXPECT_EQ(copy[4].field, "e");
+
+    errors.clear();
+    EXPECT_TRUE(errors.empty());
+    errors.push_back(ValidationError::stringTooLong(8));
+    EXPECT_EQ(errors[0].message(), "String must be at most 8 characters");
+}
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+// Validator Program Unit Tests
+
+#include <gtest/gtest.h>
+#include "src/validators/validator_program.h"
+#include "src/validators/enum_validator.h"
+#include "src/validators/pattern_validator.h"
+#include "src/validators/range_validator.h"
+#include "src/validators/required_validator.h"
+#include "src/validators/type_validator.h"
+#include <memory>
+#include <vector>
+
+using namespace configgui::validators;
+
+class ValidatorProgramTest : public ::testing::Test
+{
+protected:
+    /// The interpreted chain the program replaces, in the same order
+    ValidationResult interpret(const json& value, const json& schema)
+    {
+        ValidationResult combined{true, {}};
+        for (const auto& validator : chain_)
+        {
+            auto result = validator->validate(value, schema);
+            for (const auto& error : result.errors)
+            {
+                combined.errors.push_back(error);
+            }
+        }
+        combined.is_valid = combined.errors.empty();
+        return combined;
+    }
+
+    void expectSameAsChain(const json& value, const json& schema)
+    {
+        const auto expected = interpret(value, schema);
+        const auto program = ValidatorProgram::compile(schema);
+        const auto actual = program.run(value);
+
+        // The yes/no fast paths must agree with the full ones
+        EXPECT_EQ(program.isValid(value), expected.is_valid) << "value " << value.dump() << " schema " << schema.dump();
+        for (const auto& validator : chain_)
+        {
+            EXPECT_EQ(validator->isValid(value, schema), validator->validate(value, schema).is_valid)
+                << validator->getName() << " value " << value.dump() << " schema " << schema.dump();
+        }
+
+        ASSERT_EQ(actual.is_valid, expected.is_valid) << "value " << value.dump() << " schema " << schema.dump();
+        ASSERT_EQ(actual.errors.size(), expected.errors.size()) << value.dump();
+        for (size_t i = 0; i < expected.errors.size(); ++i)
+        {
+            EXPECT_EQ(actual.errors[i].field, expected.errors[i].field);
+            EXPECT_EQ(actual.errors[i].message(), expected.errors[i].message());
+            EXPECT_EQ(actual.errors[i].error_code, expected.errors[i].error_code);
+        }
+    }
+
+    std::vector<std::unique_ptr<IValidator>> chain_ = [] {
+        std::vector<std::unique_ptr<IValidator>> validators;
+        validators.push_back(std::make_unique<TypeValidator>());
+        validators.push_back(std::make_unique<RangeValidator>());
+        validators.push_back(std::make_unique<EnumValidator>());
+        validators.push_back(std::make_unique<PatternValidator>());
+        validators.push_back(std::make_unique<RequiredValidator>());
+        return validators;
+    }();
+};
+
+TEST_F(ValidatorProgramTest, MatchesInterpretedChain)
+{
+    const std::vector<json> schemas = {
+        {{"type", "integer"}, {"minimum", 0}, {"maximum", 100}},
+        {{"type", "number"}, {"minimum", 0.5}, {"exclusiveMinimum", true}, {"maximum", 2}, {"exclusiveMaximum", true}},
+        {{"type", "string"}, {"minLength", 2}, {"maxLength", 4}, {"pattern", "^[A-Z][a-z]*$"}},
+        {{"type", json::array({"string", "null"})}, {"enum", json::array({"dev", "prod", nullptr})}},
+        {{"type", "bogus"}},
+        {{"enum", json::array({1, 2.5, true, "x", json::array({1, 2}), {{"k", "v"}}})}},
+        {{"type", "object"}, {"required", json::array({"name", "port", 7})}},
+        {{"pattern", "("}},
+        json::object()
+    };
+    const std::vector<json> values = {
+        -1, 0, 1, 1.0, 1.5, 2, 100, 101, 2.5, true, nullptr, "", "A", "Ab", "Abcde", "ab", "dev", "x",
+        json::array({1, 2}), json::array({2, 1}), {{"k", "v"}}, {{"name", "a"}}, {{"name", "a"}, {"port", nullptr}},
+        {{"name", "a"}, {"port", 80}}
+    };
+
+    for (const auto& schema : schemas)
+    {
+        for (const auto& value : values)
+        {
+            expectSameAsChain(value, schema);
+        }
+    }
+}
+
+TEST_F(ValidatorProgramTest, EnumHashesNumbersByValue)
+{
+    // json == treats 3, 3u and 3.0 as equal; the hash set must agree
+    const auto program = ValidatorProgram::compile({{"enum", json::array({3, 4.0})}});
+
+    EXPECT_TRUE(program.run(3.0).is_valid);
+    EXPECT_TRUE(program.run(json(3u)).is_valid);
+    EXPECT_TRUE(program.run(4).is_valid);
+    EXPECT_FALSE(program.run(3.5).is_valid);
+    EXPECT_FALSE(program.run("3").is_valid);
+}
+
+TEST_F(ValidatorProgramTest, BindsOnlyPresentConstraints)
+{
+    EXPECT_EQ(ValidatorProgram::compile(json::object()).size(), 0u);
+    EXPECT_EQ(ValidatorProgram::compile("not a schema").size(), 0u);
+    EXPECT_EQ(ValidatorProgram::compile({{"pattern", "("}}).size(), 0u);
+
+    const auto program = ValidatorProgram::compile({{"type", json::array({"integer", "null"})}, {"minimum", 1}});
+    EXPECT_EQ(program.size(), 2u);
+    EXPECT_EQ(program.typeMask(),
+              static_cast<std::uint8_t>(TypeTag::Integer) | static_cast<std::uint8_t>(TypeTag::Null));
+}
+
+TEST_F(ValidatorProgramTest, ProgramOutlivesSchema)
+{
+    ValidatorProgram program;
+    {
+        json schema = {{"type", "string"}, {"pattern", "^v[0-9]+$"}, {"enum", json::array({"v1", "v2", "w"})}};
+        program = ValidatorProgram::compile(schema);
+    }
+
+    EXPECT_TRUE(program.run("v2").is_valid);
+
+    const auto result = program.run("w");
+    ASSERT_EQ(result.errors.size(), 1u);
+    EXPECT_EQ(result.errors[0].error_code, "PATTERN_MISMATCH");
+}